@@ -73,7 +73,10 @@ void PrintUsage(const std::string& executableName)
         << "\t--simulation-duration\tSets the simulation duration (virtual time) to SECONDS. Default: 1s" << std::endl
         << "\t--configuration\tPath and filename of the participant configuration YAML or JSON file. Default: empty"
         << std::endl
-        << "\t--write-csv\tPath and filename of csv file with benchmark results. Default: empty" << std::endl;
+        << "\t--write-csv\tPath and filename of csv file with benchmark results. Default: empty" << std::endl
+        << "\t--fan-out\tOnly the first participant publishes, all other participants subscribe to its topic. "
+           "Default: off"
+        << std::endl;
 }
 
 struct BenchmarkConfig
@@ -86,6 +89,7 @@ struct BenchmarkConfig
     std::string registryUri = "silkit://localhost:8500";
     std::string silKitConfigPath = "";
     std::string writeCsv = "";
+    bool fanOut = false;
 };
 
 bool Parse(int argc, char** argv, BenchmarkConfig& config)
@@ -118,6 +122,8 @@ bool Parse(int argc, char** argv, BenchmarkConfig& config)
         return false;
     }
 
+    config.fanOut = consumeFlag("--fan-out");
+
     // Some more human-readable shortcuts for the options.
     // Consume a named option and return its argument,
     // or throw if an invalid argument is given.
@@ -289,16 +295,24 @@ void ParticipantsThread(std::shared_ptr<SilKit::Config::IParticipantConfiguratio
     auto* lifecycleService = participant->CreateLifecycleService({OperationMode::Coordinated});
     auto* timeSyncService = lifecycleService->CreateTimeSyncService();
 
+    // In fan-out mode, only the first participant publishes and all other participants subscribe to its topic
+    const auto isPublisher = !benchmark.fanOut || participantIndex == 0;
+    const auto isSubscriber = !benchmark.fanOut || participantIndex != 0;
+
     const std::string topicPub = "Topic" + std::to_string(participantIndex);
     const std::string topicSub =
-        "Topic" + std::to_string(relateParticipant(participantIndex, benchmark.numberOfParticipants));
+        "Topic"
+        + std::to_string(benchmark.fanOut ? 0 : relateParticipant(participantIndex, benchmark.numberOfParticipants));
     SilKit::Services::PubSub::PubSubSpec dataSpec{topicPub, {}};
     SilKit::Services::PubSub::PubSubSpec matchingDataSpec{topicSub, {}};    
     auto publisher = participant->CreateDataPublisher("PubCtrl1", dataSpec, 0);
-    participant->CreateDataSubscriber("SubCtrl1", matchingDataSpec, [&messageCounter](auto*, auto&) {
-        // this is handled in I/O thread, so no data races on counter.
-        messageCounter++;
-    });
+    if (isSubscriber)
+    {
+        participant->CreateDataSubscriber("SubCtrl1", matchingDataSpec, [&messageCounter](auto*, auto&) {
+            // this is handled in I/O thread, so no data races on counter.
+            messageCounter++;
+        });
+    }
 
     const auto isVerbose = participantIndex == 0;
     timeSyncService->SetSimulationStepHandler(
@@ -319,7 +333,10 @@ void ParticipantsThread(std::shared_ptr<SilKit::Config::IParticipantConfiguratio
                     std::cout << ".";
                 }
             }
-            PublishMessages(publisher, benchmark.messageCount, benchmark.messageSizeInBytes);
+            if (isPublisher)
+            {
+                PublishMessages(publisher, benchmark.messageCount, benchmark.messageSizeInBytes);
+            }
         },
         stepSize);
 
@@ -343,6 +360,7 @@ void PrintParameters(BenchmarkConfig benchmark)
               << "This simulation run is repeated <K> times and averages over all runs are calculated." << std::endl
               << "The demo uses PubSub controllers with the same topic for the message exchange," << std::endl
               << "so each participant broadcasts the messages to all other participants." << std::endl
+              << "In fan-out mode, only the first participant publishes to <N>-1 subscribers." << std::endl
               << std::endl
               << "Running simulations with the following parameters:" << std::endl
               << std::endl
@@ -357,7 +375,8 @@ void PrintParameters(BenchmarkConfig benchmark)
               << std::left << std::setw(38) << "- Message size (bytes): " << benchmark.messageSizeInBytes << std::endl
               << std::left << std::setw(38) << "- Registry URI: " << benchmark.registryUri << std::endl
               << std::left << std::setw(38) << "- Configuration: " << benchmark.silKitConfigPath << std::endl
-              << std::left << std::setw(38) << "- CSV output: " << benchmark.writeCsv << std::endl;
+              << std::left << std::setw(38) << "- CSV output: " << benchmark.writeCsv << std::endl
+              << std::left << std::setw(38) << "- Fan-out: " << (benchmark.fanOut ? "on" : "off") << std::endl;
 }
 
 template <typename T>
@@ -0,0 +1,31 @@
+#!/bin/sh
+#Usage: ./run-bench-subscriber-scaling.sh <path/to/SilKitDemoBenchmark> <path/to/result.csv> [<path/to/SilKitConfig>]
+
+EXE=$1
+CSVFILE=$2
+CONFIGFILE=${3:-}
+CONFIGARG=""
+if [ ! -z "${CONFIGFILE}" ]; then
+    CONFIGARG="--configuration ${CONFIGFILE}"
+fi
+
+REPEAT=10
+SIMTIME=5
+MSGCOUNT=10
+MSGSIZE=100000
+
+# one publisher and 1..32 subscribers
+for numsub in 1 2 4 8 16 32
+do
+  NUMPART=$((numsub + 1))
+  echo "Run SilKitBenchmarkDemo with RUNS=${REPEAT}, T=${SIMTIME}s, SUBSCRIBERS=${numsub}, MSGCOUNT=${MSGCOUNT}, MSGSIZE=${MSGSIZE}B, CONFIG=${CONFIGFILE}, CSV=${CSVFILE}"
+  $EXE --number-simulation-runs ${REPEAT} \
+       --simulation-duration ${SIMTIME} \
+       --number-participants ${NUMPART} \
+       --message-count ${MSGCOUNT} \
+       --message-size ${MSGSIZE} \
+       --fan-out \
+       --write-csv ${CSVFILE} \
+       ${CONFIGARG} > /dev/null
+
+done
@@ -658,6 +658,19 @@ extern "C"
         return globalCapi->SilKit_TimeSyncService_Now(timeSyncService, outNanosecondsTime);
     }
 
+    SilKit_ReturnCode SilKitCALL SilKit_Experimental_TimeSyncService_SetNextEventTime(
+        SilKit_TimeSyncService* timeSyncService, SilKit_NanosecondsTime nextEventTime)
+    {
+        return globalCapi->SilKit_Experimental_TimeSyncService_SetNextEventTime(timeSyncService, nextEventTime);
+    }
+
+    SilKit_ReturnCode SilKitCALL SilKit_Experimental_TimeSyncService_GetRealTimePacingStatistics(
+        SilKit_TimeSyncService* timeSyncService, SilKit_Experimental_RealTimePacingStatistics* outStatistics)
+    {
+        return globalCapi->SilKit_Experimental_TimeSyncService_GetRealTimePacingStatistics(timeSyncService,
+                                                                                          outStatistics);
+    }
+
     // SystemMonitor
 
     SilKit_ReturnCode SilKitCALL SilKit_SystemMonitor_Create(SilKit_SystemMonitor** outSystemMonitor,
@@ -770,6 +783,12 @@ extern "C"
         return globalCapi->SilKit_Participant_GetLogger(outLogger, participant);
     }
 
+    SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_GetSendQueueStatus(
+        SilKit_Participant* participant, const char* participantName, SilKit_Experimental_SendQueueStatus* outStatus)
+    {
+        return globalCapi->SilKit_Experimental_Participant_GetSendQueueStatus(participant, participantName, outStatus);
+    }
+
     // ParticipantConfiguration
 
     SilKit_ReturnCode SilKitCALL SilKit_ParticipantConfiguration_FromString(
@@ -813,6 +832,23 @@ extern "C"
         return globalCapi->SilKit_DataPublisher_Publish(self, data);
     }
 
+    SilKit_ReturnCode SilKitCALL SilKit_Experimental_DataPublisher_LoanBuffer(
+        SilKit_DataPublisher* self, size_t size, SilKit_Experimental_DataPublisherLoan** outLoan, uint8_t** outData)
+    {
+        return globalCapi->SilKit_Experimental_DataPublisher_LoanBuffer(self, size, outLoan, outData);
+    }
+
+    SilKit_ReturnCode SilKitCALL SilKit_Experimental_DataPublisher_PublishLoan(SilKit_DataPublisher* self,
+                                                                              SilKit_Experimental_DataPublisherLoan* loan)
+    {
+        return globalCapi->SilKit_Experimental_DataPublisher_PublishLoan(self, loan);
+    }
+
+    SilKit_ReturnCode SilKitCALL SilKit_Experimental_DataPublisherLoan_Release(SilKit_Experimental_DataPublisherLoan* loan)
+    {
+        return globalCapi->SilKit_Experimental_DataPublisherLoan_Release(loan);
+    }
+
     // DataSubscriber
 
     SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_Create(SilKit_DataSubscriber** outSubscriber,
@@ -356,6 +356,13 @@ public:
     MOCK_METHOD(SilKit_ReturnCode, SilKit_TimeSyncService_Now,
                 (SilKit_TimeSyncService * timeSyncService, SilKit_NanosecondsTime* outNanosecondsTime));
 
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_Experimental_TimeSyncService_SetNextEventTime,
+                (SilKit_TimeSyncService * timeSyncService, SilKit_NanosecondsTime nextEventTime));
+
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_Experimental_TimeSyncService_GetRealTimePacingStatistics,
+                (SilKit_TimeSyncService * timeSyncService,
+                 SilKit_Experimental_RealTimePacingStatistics* outStatistics));
+
     // SystemMonitor
 
     MOCK_METHOD(SilKit_ReturnCode, SilKit_SystemMonitor_Create,
@@ -416,6 +423,10 @@ public:
     MOCK_METHOD(SilKit_ReturnCode, SilKit_Participant_GetLogger,
                 (SilKit_Logger * *outLogger, SilKit_Participant* participant));
 
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_Experimental_Participant_GetSendQueueStatus,
+                (SilKit_Participant * participant, const char* participantName,
+                 SilKit_Experimental_SendQueueStatus* outStatus));
+
     // ParticipantConfiguration
 
     MOCK_METHOD(SilKit_ReturnCode, SilKit_ParticipantConfiguration_FromString,
@@ -441,6 +452,16 @@ public:
     MOCK_METHOD(SilKit_ReturnCode, SilKit_DataPublisher_Publish,
                 (SilKit_DataPublisher * self, const SilKit_ByteVector* data));
 
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_Experimental_DataPublisher_LoanBuffer,
+                (SilKit_DataPublisher * self, size_t size, SilKit_Experimental_DataPublisherLoan** outLoan,
+                 uint8_t** outData));
+
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_Experimental_DataPublisher_PublishLoan,
+                (SilKit_DataPublisher * self, SilKit_Experimental_DataPublisherLoan* loan));
+
+    MOCK_METHOD(SilKit_ReturnCode, SilKit_Experimental_DataPublisherLoan_Release,
+                (SilKit_Experimental_DataPublisherLoan * loan));
+
     // DataSubscriber
 
     MOCK_METHOD(SilKit_ReturnCode, SilKit_DataSubscriber_Create,
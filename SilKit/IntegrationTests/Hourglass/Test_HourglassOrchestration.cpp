@@ -28,6 +28,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "silkit/detail/impl/ThrowOnError.hpp"
 #include "silkit/experimental/participant/ParticipantExtensions.hpp"
 #include "silkit/experimental/services/orchestration/ISystemController.hpp"
+#include "silkit/experimental/services/orchestration/TimeSyncServiceExtensions.hpp"
 
 #include "MockCapiTest.hpp"
 
@@ -437,6 +438,44 @@ TEST_F(Test_HourglassOrchestration, SilKit_TimeSyncService_Now)
     EXPECT_EQ(timeSyncService.Now(), nanoseconds);
 }
 
+TEST_F(Test_HourglassOrchestration, SilKit_Experimental_TimeSyncService_SetNextEventTime)
+{
+    const std::chrono::nanoseconds nextEventTime{0x123456};
+
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::Orchestration::TimeSyncService timeSyncService{
+        mockLifecycleService};
+
+    EXPECT_CALL(capi, SilKit_Experimental_TimeSyncService_SetNextEventTime(mockTimeSyncService, nextEventTime.count()))
+        .Times(1);
+
+    SilKit::Experimental::Services::Orchestration::SetNextEventTime(&timeSyncService, nextEventTime);
+}
+
+TEST_F(Test_HourglassOrchestration, SilKit_Experimental_TimeSyncService_GetRealTimePacingStatistics)
+{
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::Orchestration::TimeSyncService timeSyncService{
+        mockLifecycleService};
+
+    SilKit_Experimental_RealTimePacingStatistics cStatistics;
+    SilKit_Struct_Init(SilKit_Experimental_RealTimePacingStatistics, cStatistics);
+    cStatistics.steps = 10;
+    cStatistics.overruns = 2;
+    cStatistics.lastLag = 3;
+    cStatistics.maxLag = 4;
+    cStatistics.totalLag = 5;
+
+    EXPECT_CALL(capi, SilKit_Experimental_TimeSyncService_GetRealTimePacingStatistics(mockTimeSyncService, testing::_))
+        .WillOnce(DoAll(SetArgPointee<1>(cStatistics), Return(SilKit_ReturnCode_SUCCESS)));
+
+    const auto statistics =
+        SilKit::Experimental::Services::Orchestration::GetRealTimePacingStatistics(&timeSyncService);
+    EXPECT_EQ(statistics.steps, 10u);
+    EXPECT_EQ(statistics.overruns, 2u);
+    EXPECT_EQ(statistics.lastLag, std::chrono::nanoseconds{3});
+    EXPECT_EQ(statistics.maxLag, std::chrono::nanoseconds{4});
+    EXPECT_EQ(statistics.totalLag, std::chrono::nanoseconds{5});
+}
+
 // SystemMonitor
 
 TEST_F(Test_HourglassOrchestration, SilKit_SystemMonitor_Create)
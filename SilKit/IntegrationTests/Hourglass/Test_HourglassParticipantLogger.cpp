@@ -25,6 +25,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "silkit/SilKit.hpp"
 #include "silkit/detail/impl/ThrowOnError.hpp"
+#include "silkit/experimental/participant/ParticipantExtensions.hpp"
 
 #include "MockCapiTest.hpp"
 
@@ -129,6 +130,34 @@ TEST_F(Test_HourglassParticipantLogger, SilKit_Participant_GetLogger)
     participant->GetLogger();
 }
 
+TEST_F(Test_HourglassParticipantLogger, SilKit_Experimental_Participant_GetSendQueueStatus)
+{
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Participant participant{mockParticipant};
+
+    SilKit_Experimental_SendQueueStatus cStatus;
+    SilKit_Struct_Init(SilKit_Experimental_SendQueueStatus, cStatus);
+    cStatus.queuedMessages = 1;
+    cStatus.queuedBytes = 2;
+    cStatus.maxQueuedBytes = 3;
+    cStatus.droppedMessages = 4;
+    cStatus.rejectedMessages = 5;
+    cStatus.blockedSends = 6;
+    cStatus.conflatedMessages = 7;
+
+    EXPECT_CALL(capi, SilKit_Experimental_Participant_GetSendQueueStatus(mockParticipant, testing::StrEq("Other"),
+                                                                          testing::_))
+        .WillOnce(DoAll(SetArgPointee<2>(cStatus), Return(SilKit_ReturnCode_SUCCESS)));
+
+    const auto status = SilKit::Experimental::Participant::GetSendQueueStatus(&participant, "Other");
+    EXPECT_EQ(status.queuedMessages, 1u);
+    EXPECT_EQ(status.queuedBytes, 2u);
+    EXPECT_EQ(status.maxQueuedBytes, 3u);
+    EXPECT_EQ(status.droppedMessages, 4u);
+    EXPECT_EQ(status.rejectedMessages, 5u);
+    EXPECT_EQ(status.blockedSends, 6u);
+    EXPECT_EQ(status.conflatedMessages, 7u);
+}
+
 TEST_F(Test_HourglassParticipantLogger, SilKit_Logger_Log)
 {
     std::string name = "Participant1";
@@ -28,6 +28,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "silkit/SilKit.hpp"
 #include "silkit/detail/impl/ThrowOnError.hpp"
+#include "silkit/experimental/services/pubsub/DataPublisherExtensions.hpp"
 #include "silkit/util/Span.hpp"
 
 #include "MockCapiTest.hpp"
@@ -36,6 +37,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 namespace {
 
+using testing::_;
 using testing::DoAll;
 using testing::SetArgPointee;
 using testing::StrEq;
@@ -178,6 +180,52 @@ TEST_F(Test_HourglassPubSub, SilKit_DataPublisher_Publish)
     publisher.Publish(byteSpan);
 }
 
+TEST_F(Test_HourglassPubSub, SilKit_Experimental_DataPublisher_LoanBuffer_PublishLoan)
+{
+    auto* const participant = reinterpret_cast<SilKit_Participant*>(uintptr_t(123456));
+    auto* const mockLoan = reinterpret_cast<SilKit_Experimental_DataPublisherLoan*>(uintptr_t(0x12345678));
+
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::PubSub::DataPublisher publisher{
+        participant, "DataPublisher1", PubSubSpec{"Topic1", "MediaType1"}, 0x42};
+
+    std::vector<uint8_t> loanedData(9);
+
+    EXPECT_CALL(capi, SilKit_Experimental_DataPublisher_LoanBuffer(mockDataPublisher, loanedData.size(), _, _))
+        .WillOnce(DoAll(SetArgPointee<2>(mockLoan), SetArgPointee<3>(loanedData.data()),
+                        Return(SilKit_ReturnCode_SUCCESS)));
+    EXPECT_CALL(capi, SilKit_Experimental_DataPublisher_PublishLoan(mockDataPublisher, mockLoan)).Times(1);
+    EXPECT_CALL(capi, SilKit_Experimental_DataPublisherLoan_Release(_)).Times(0);
+
+    auto loan = SilKit::Experimental::Services::PubSub::LoanBuffer(&publisher, loanedData.size());
+    EXPECT_EQ(loan.Data().data(), loanedData.data());
+    EXPECT_EQ(loan.Data().size(), loanedData.size());
+
+    SilKit::Experimental::Services::PubSub::Publish(&publisher, std::move(loan));
+    EXPECT_EQ(loan.Data().size(), 0u);
+}
+
+TEST_F(Test_HourglassPubSub, SilKit_Experimental_DataPublisherLoan_Release)
+{
+    auto* const participant = reinterpret_cast<SilKit_Participant*>(uintptr_t(123456));
+    auto* const mockLoan = reinterpret_cast<SilKit_Experimental_DataPublisherLoan*>(uintptr_t(0x12345678));
+
+    SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Impl::Services::PubSub::DataPublisher publisher{
+        participant, "DataPublisher1", PubSubSpec{"Topic1", "MediaType1"}, 0x42};
+
+    std::vector<uint8_t> loanedData(9);
+
+    EXPECT_CALL(capi, SilKit_Experimental_DataPublisher_LoanBuffer(mockDataPublisher, loanedData.size(), _, _))
+        .WillOnce(DoAll(SetArgPointee<2>(mockLoan), SetArgPointee<3>(loanedData.data()),
+                        Return(SilKit_ReturnCode_SUCCESS)));
+    EXPECT_CALL(capi, SilKit_Experimental_DataPublisher_PublishLoan(_, _)).Times(0);
+    EXPECT_CALL(capi, SilKit_Experimental_DataPublisherLoan_Release(mockLoan)).Times(1);
+
+    {
+        auto loan = SilKit::Experimental::Services::PubSub::LoanBuffer(&publisher, loanedData.size());
+        auto movedLoan = std::move(loan);
+    }
+}
+
 // DataSubscriber
 
 TEST_F(Test_HourglassPubSub, SilKit_DataSubscriber_Create)
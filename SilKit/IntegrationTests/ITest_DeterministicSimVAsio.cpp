@@ -66,12 +66,14 @@ std::istream& operator>>(std::istream& in, nanoseconds& timestamp)
 class Publisher
 {
 public:
-    Publisher(const std::string&  registryUri, const uint32_t publisherIndex, const uint32_t testSize)
+    Publisher(const std::string& participantConfiguration, const std::string& registryUri,
+              const uint32_t publisherIndex, const uint32_t testSize)
         : _testSize{testSize}
     {
         _participantName = "Publisher" + std::to_string(publisherIndex);
-        _participant = SilKit::CreateParticipant(SilKit::Config::ParticipantConfigurationFromString(""),
-                                                 _participantName, registryUri);
+        _participant =
+            SilKit::CreateParticipant(SilKit::Config::ParticipantConfigurationFromString(participantConfiguration),
+                                      _participantName, registryUri);
 
         const auto topicName = "Topic" + std::to_string(publisherIndex);
         _lifecycleService =
@@ -130,14 +132,16 @@ private:
 class Subscriber
 {
 public:
-    Subscriber(const std::string& participantName, const std::string& registryUri, const uint32_t& publisherCount, const uint32_t testSize)
+    Subscriber(const std::string& participantConfiguration, const std::string& participantName,
+               const std::string& registryUri, const uint32_t& publisherCount, const uint32_t testSize)
         : _publisherCount{publisherCount}
         , _messageIndexes(publisherCount, 0u)
         , _testSize{testSize}
         , _participantName{participantName}
     {
-        _participant = SilKit::CreateParticipant(SilKit::Config::ParticipantConfigurationFromString(""),
-                                                 participantName, registryUri);
+        _participant =
+            SilKit::CreateParticipant(SilKit::Config::ParticipantConfigurationFromString(participantConfiguration),
+                                      participantName, registryUri);
 
         _systemController = SilKit::Experimental::Participant::CreateSystemController(_participant.get());
         _systemController->SetWorkflowConfiguration({syncParticipantNames});
@@ -246,16 +250,19 @@ protected:
         registryUri = MakeTestRegistryUri();
     }
 
+    void RunDeterministicSimulation(const std::string& participantConfiguration);
+
 protected:
     std::string registryUri;
 };
 
-TEST_F(ITest_DeterministicSimVAsio, deterministic_simulation_vasio)
+void ITest_DeterministicSimVAsio::RunDeterministicSimulation(const std::string& participantConfiguration)
 {
     const uint32_t publisherCount = 3;
     const uint32_t testSize = 5000;
 
     std::string subscriberName = "Subscriber";
+    syncParticipantNames.clear();
     syncParticipantNames.push_back(subscriberName);
     for (auto i = 0u; i < publisherCount; i++)
     {
@@ -266,14 +273,14 @@ TEST_F(ITest_DeterministicSimVAsio, deterministic_simulation_vasio)
     registry->StartListening(registryUri);
 
     // The subscriber assumes the role of the system controller and initiates simulation state changes
-    Subscriber subscriber(subscriberName, registryUri, publisherCount, testSize);
+    Subscriber subscriber(participantConfiguration, subscriberName, registryUri, publisherCount, testSize);
     auto subscriberFuture = subscriber.RunAsync();
 
     std::vector<Publisher> publishers;
     publishers.reserve(publisherCount);
     for (auto i = 0u; i < publisherCount; i++)
     {
-        publishers.emplace_back(registryUri, i, testSize);
+        publishers.emplace_back(participantConfiguration, registryUri, i, testSize);
         publishers[i].RunAsync();
     }
 
@@ -302,4 +309,19 @@ TEST_F(ITest_DeterministicSimVAsio, deterministic_simulation_vasio)
     }
 }
 
+TEST_F(ITest_DeterministicSimVAsio, deterministic_simulation_vasio)
+{
+    RunDeterministicSimulation("");
+}
+
+TEST_F(ITest_DeterministicSimVAsio, deterministic_simulation_vasio_with_message_batching)
+{
+    // the messages of a simulation step are sent in a single batch, which must not delay them to a later step
+    RunDeterministicSimulation(R"(
+Middleware:
+  EnableMessageBatching: true
+  MessageBatchMaxDelay: 1000
+)");
+}
+
 } // anonymous namespace
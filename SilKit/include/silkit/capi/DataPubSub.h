@@ -21,6 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 
 #pragma once
+#include <stddef.h>
 #include <stdint.h>
 #include "silkit/capi/SilKitMacros.h"
 #include "silkit/capi/Types.h"
@@ -107,6 +108,49 @@ SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_DataPublisher_Publish(SilKit_DataP
 
 typedef SilKit_ReturnCode (SilKitFPTR *SilKit_DataPublisher_Publish_t)(SilKit_DataPublisher* self, const SilKit_ByteVector* data);
 
+/*! \brief Represents a handle to a buffer loaned from a data publisher */
+typedef struct SilKit_Experimental_DataPublisherLoan SilKit_Experimental_DataPublisherLoan;
+
+/*! \brief Loan a buffer for the data of the next message from the provided DataPublisher
+*
+* The buffer is laid out like the message on the wire. After filling the data in place, the buffer is handed to the
+* network by \ref SilKit_Experimental_DataPublisher_PublishLoan without copying the data. A loan which is not
+* published must be released by \ref SilKit_Experimental_DataPublisherLoan_Release.
+*
+* \param self The DataPublisher that should publish the data.
+* \param size The size of the data in bytes.
+* \param outLoan Pointer to which the handle of the loaned buffer will be written.
+* \param outData Pointer to which the address of the data (size bytes) will be written.
+*/
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_Experimental_DataPublisher_LoanBuffer(
+    SilKit_DataPublisher* self, size_t size, SilKit_Experimental_DataPublisherLoan** outLoan, uint8_t** outData);
+
+typedef SilKit_ReturnCode(SilKitFPTR* SilKit_Experimental_DataPublisher_LoanBuffer_t)(
+    SilKit_DataPublisher* self, size_t size, SilKit_Experimental_DataPublisherLoan** outLoan, uint8_t** outData);
+
+/*! \brief Publish the data of a loaned buffer through the provided DataPublisher
+*
+* The loan is consumed, even if an error is returned. The data must not be accessed afterwards.
+*
+* \param self The DataPublisher that should publish the data.
+* \param loan The buffer obtained from \ref SilKit_Experimental_DataPublisher_LoanBuffer.
+*/
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_Experimental_DataPublisher_PublishLoan(
+    SilKit_DataPublisher* self, SilKit_Experimental_DataPublisherLoan* loan);
+
+typedef SilKit_ReturnCode(SilKitFPTR* SilKit_Experimental_DataPublisher_PublishLoan_t)(
+    SilKit_DataPublisher* self, SilKit_Experimental_DataPublisherLoan* loan);
+
+/*! \brief Release a loaned buffer without publishing it
+*
+* \param loan The buffer obtained from \ref SilKit_Experimental_DataPublisher_LoanBuffer.
+*/
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_Experimental_DataPublisherLoan_Release(
+    SilKit_Experimental_DataPublisherLoan* loan);
+
+typedef SilKit_ReturnCode(SilKitFPTR* SilKit_Experimental_DataPublisherLoan_Release_t)(
+    SilKit_Experimental_DataPublisherLoan* loan);
+
 /*! \brief Sets / overwrites the default handler to be called on data reception.
 * \param self The DataSubscriber for which the handler should be set.
 * \param context A user provided context, that is reobtained on data reception in the dataHandler.
@@ -261,17 +261,23 @@ typedef struct
 #define SilKit_LifecycleConfiguration_DATATYPE_ID 2
 #define SilKit_WorkflowConfiguration_DATATYPE_ID 3
 #define SilKit_ParticipantConnectionInformation_DATATYPE_ID 4
+#define SilKit_Experimental_SendQueueStatus_DATATYPE_ID 5
+#define SilKit_Experimental_RealTimePacingStatistics_DATATYPE_ID 6
 
 // Participant data type Versions
 #define SilKit_ParticipantStatus_VERSION 1
 #define SilKit_LifecycleConfiguration_VERSION 1
 #define SilKit_WorkflowConfiguration_VERSION 3
 #define SilKit_ParticipantConnectionInformation_VERSION 1
+#define SilKit_Experimental_SendQueueStatus_VERSION 1
+#define SilKit_Experimental_RealTimePacingStatistics_VERSION 1
 
 // Participant public API IDs
 #define SilKit_ParticipantStatus_STRUCT_VERSION            SK_ID_MAKE(Participant, SilKit_ParticipantStatus)
 #define SilKit_LifecycleConfiguration_STRUCT_VERSION       SK_ID_MAKE(Participant, SilKit_LifecycleConfiguration)
 #define SilKit_WorkflowConfiguration_STRUCT_VERSION        SK_ID_MAKE(Participant, SilKit_WorkflowConfiguration)
 #define SilKit_ParticipantConnectionInformation_STRUCT_VERSION        SK_ID_MAKE(Participant, SilKit_ParticipantConnectionInformation)
+#define SilKit_Experimental_SendQueueStatus_STRUCT_VERSION            SK_ID_MAKE(Participant, SilKit_Experimental_SendQueueStatus)
+#define SilKit_Experimental_RealTimePacingStatistics_STRUCT_VERSION   SK_ID_MAKE(Participant, SilKit_Experimental_RealTimePacingStatistics)
 
 SILKIT_END_DECLS
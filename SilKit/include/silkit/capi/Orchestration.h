@@ -528,6 +528,47 @@ SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_TimeSyncService_Now(SilKit_TimeSyn
 typedef SilKit_ReturnCode (SilKitFPTR *SilKit_TimeSyncService_Now_t)(SilKit_TimeSyncService* timeSyncService,
     SilKit_NanosecondsTime* outNanosecondsTime);
 
+/*! \brief Announce that nothing happens for this participant before the given simulation time
+ *
+ * The next simulation step is executed at nextEventTime, the steps in between are skipped. Called between the
+ * simulation steps, e.g., from a message handler, it only postpones the announced step. An earlier time applies after
+ * the announced step, no steps are skipped then.
+ *
+ * \param timeSyncService The time sync service obtained via \ref SilKit_TimeSyncService_Create.
+ * \param nextEventTime The simulation time of the next simulation step in nanoseconds.
+ */
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_Experimental_TimeSyncService_SetNextEventTime(
+    SilKit_TimeSyncService* timeSyncService, SilKit_NanosecondsTime nextEventTime);
+
+typedef SilKit_ReturnCode (SilKitFPTR *SilKit_Experimental_TimeSyncService_SetNextEventTime_t)(
+    SilKit_TimeSyncService* timeSyncService, SilKit_NanosecondsTime nextEventTime);
+
+/*! \brief Statistics of the real-time pacing of the simulation steps, see the TimeSynchronization/RealTimeFactor of
+ *         the participant configuration. */
+struct SilKit_Experimental_RealTimePacingStatistics
+{
+    SilKit_StructHeader structHeader; //!< The interface id specifying which version of this struct was obtained
+    uint64_t steps; //!< Number of paced simulation steps
+    uint64_t overruns; //!< Steps whose deadline had already passed when the participant got to execute them
+    SilKit_NanosecondsTime lastLag; //!< Delay between the deadline and the start of the last step
+    SilKit_NanosecondsTime maxLag; //!< Largest delay between the deadline and the start of a step
+    SilKit_NanosecondsTime totalLag; //!< Sum of the delays of all steps
+};
+typedef struct SilKit_Experimental_RealTimePacingStatistics SilKit_Experimental_RealTimePacingStatistics;
+
+/*! \brief Obtain the statistics of the real-time pacing of the simulation steps
+ *
+ * All statistics are zero if the simulation steps of the participant are not paced to the wall clock.
+ *
+ * \param timeSyncService The time sync service obtained via \ref SilKit_TimeSyncService_Create.
+ * \param outStatistics Pointer into which the statistics will be written (out parameter).
+ */
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_Experimental_TimeSyncService_GetRealTimePacingStatistics(
+    SilKit_TimeSyncService* timeSyncService, SilKit_Experimental_RealTimePacingStatistics* outStatistics);
+
+typedef SilKit_ReturnCode (SilKitFPTR *SilKit_Experimental_TimeSyncService_GetRealTimePacingStatistics_t)(
+    SilKit_TimeSyncService* timeSyncService, SilKit_Experimental_RealTimePacingStatistics* outStatistics);
+
 
 /*
  *
@@ -78,6 +78,35 @@ SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_Participant_GetLogger(SilKit_Logge
 
 typedef SilKit_ReturnCode (SilKitFPTR *SilKit_Participant_GetLogger_t)(SilKit_Logger** outLogger, SilKit_Participant* participant);
 
+/*! \brief Fill level and overflow counters of the send queue to another participant. */
+struct SilKit_Experimental_SendQueueStatus
+{
+    SilKit_StructHeader structHeader; //!< The interface id specifying which version of this struct was obtained
+    uint64_t queuedMessages; //!< Number of messages waiting to be written
+    uint64_t queuedBytes; //!< Number of bytes waiting to be written
+    uint64_t maxQueuedBytes; //!< Highest number of queued bytes observed so far
+    uint64_t droppedMessages; //!< Number of bus messages dropped by the DropOldest policy
+    uint64_t rejectedMessages; //!< Number of bus messages rejected by the Error policy
+    uint64_t blockedSends; //!< Number of sends which were blocked by the Block policy
+    uint64_t conflatedMessages; //!< Number of queued messages replaced by newer ones for latest-value subscribers
+};
+typedef struct SilKit_Experimental_SendQueueStatus SilKit_Experimental_SendQueueStatus;
+
+/*! \brief Obtain the status of the send queue to another participant of the simulation.
+ *
+ * \param participant The simulation participant which sends to the other participant.
+ * \param participantName The name of the other participant.
+ * \param outStatus Pointer into which the status of the send queue will be written (out parameter).
+ *
+ * \return SilKit_ReturnCode_SUCCESS, or an error code if the participant is not connected to a participant of the
+ *         given name.
+ */
+SilKitAPI SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_GetSendQueueStatus(
+    SilKit_Participant* participant, const char* participantName, SilKit_Experimental_SendQueueStatus* outStatus);
+
+typedef SilKit_ReturnCode (SilKitFPTR *SilKit_Experimental_Participant_GetSendQueueStatus_t)(
+    SilKit_Participant* participant, const char* participantName, SilKit_Experimental_SendQueueStatus* outStatus);
+
 SILKIT_END_DECLS
 
 #pragma pack(pop)
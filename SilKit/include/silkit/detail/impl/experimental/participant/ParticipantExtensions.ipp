@@ -24,6 +24,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "silkit/SilKitMacros.hpp"
 #include "silkit/participant/IParticipant.hpp"
 #include "silkit/experimental/services/orchestration/ISystemController.hpp"
+#include "silkit/experimental/participant/ParticipantDatatypesExtensions.hpp"
 
 #include "silkit/detail/impl/participant/Participant.hpp"
 #include "silkit/detail/impl/experimental/services/orchestration/SystemController.hpp"
@@ -42,6 +43,14 @@ auto CreateSystemController(SilKit::IParticipant* cppIParticipant)
     return cppParticipant.ExperimentalCreateSystemController();
 }
 
+auto GetSendQueueStatus(SilKit::IParticipant* cppIParticipant, const std::string& participantName)
+    -> SilKit::Experimental::Participant::SendQueueStatus
+{
+    auto& cppParticipant = dynamic_cast<Impl::Participant&>(*cppIParticipant);
+
+    return cppParticipant.ExperimentalGetSendQueueStatus(participantName);
+}
+
 } // namespace Participant
 } // namespace Experimental
 DETAIL_SILKIT_DETAIL_VN_NAMESPACE_CLOSE
@@ -52,6 +61,7 @@ namespace SilKit {
 namespace Experimental {
 namespace Participant {
 using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Participant::CreateSystemController;
+using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Participant::GetSendQueueStatus;
 } // namespace Participant
 } // namespace Experimental
 } // namespace SilKit
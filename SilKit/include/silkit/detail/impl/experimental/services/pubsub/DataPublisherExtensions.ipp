@@ -0,0 +1,123 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <utility>
+
+#include "silkit/capi/DataPubSub.h"
+
+#include "silkit/detail/impl/services/pubsub/DataPublisher.hpp"
+
+
+namespace SilKit {
+DETAIL_SILKIT_DETAIL_VN_NAMESPACE_BEGIN
+namespace Experimental {
+namespace Services {
+namespace PubSub {
+
+DataPublisherLoan::DataPublisherLoan(SilKit_Experimental_DataPublisherLoan* loan, uint8_t* data, size_t size)
+    : _loan{loan}
+    , _data{data}
+    , _size{size}
+{
+}
+
+DataPublisherLoan::DataPublisherLoan(DataPublisherLoan&& other) noexcept
+    : _loan{std::exchange(other._loan, nullptr)}
+    , _data{std::exchange(other._data, nullptr)}
+    , _size{std::exchange(other._size, 0)}
+{
+}
+
+DataPublisherLoan& DataPublisherLoan::operator=(DataPublisherLoan&& other) noexcept
+{
+    if (this != &other)
+    {
+        Reset();
+        _loan = std::exchange(other._loan, nullptr);
+        _data = std::exchange(other._data, nullptr);
+        _size = std::exchange(other._size, 0);
+    }
+    return *this;
+}
+
+DataPublisherLoan::~DataPublisherLoan()
+{
+    Reset();
+}
+
+auto DataPublisherLoan::Data() const -> SilKit::Util::Span<uint8_t>
+{
+    return {_data, _size};
+}
+
+auto DataPublisherLoan::Release() -> SilKit_Experimental_DataPublisherLoan*
+{
+    _data = nullptr;
+    _size = 0;
+    return std::exchange(_loan, nullptr);
+}
+
+void DataPublisherLoan::Reset()
+{
+    if (_loan != nullptr)
+    {
+        // the destructor must not throw, a failure to release the loan is ignored
+        (void)SilKit_Experimental_DataPublisherLoan_Release(Release());
+    }
+}
+
+auto LoanBuffer(SilKit::Services::PubSub::IDataPublisher* cppIDataPublisher, size_t size) -> DataPublisherLoan
+{
+    auto& cppDataPublisher = dynamic_cast<Impl::Services::PubSub::DataPublisher&>(*cppIDataPublisher);
+
+    uint8_t* data{nullptr};
+    auto* loan = cppDataPublisher.ExperimentalLoanBuffer(size, &data);
+    return DataPublisherLoan{loan, data, size};
+}
+
+void Publish(SilKit::Services::PubSub::IDataPublisher* cppIDataPublisher, DataPublisherLoan&& loan)
+{
+    auto& cppDataPublisher = dynamic_cast<Impl::Services::PubSub::DataPublisher&>(*cppIDataPublisher);
+
+    cppDataPublisher.ExperimentalPublishLoan(loan.Release());
+}
+
+} // namespace PubSub
+} // namespace Services
+} // namespace Experimental
+DETAIL_SILKIT_DETAIL_VN_NAMESPACE_CLOSE
+} // namespace SilKit
+
+
+namespace SilKit {
+namespace Experimental {
+namespace Services {
+namespace PubSub {
+using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Services::PubSub::DataPublisherLoan;
+using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Services::PubSub::LoanBuffer;
+using SilKit::DETAIL_SILKIT_DETAIL_NAMESPACE_NAME::Experimental::Services::PubSub::Publish;
+} // namespace PubSub
+} // namespace Services
+} // namespace Experimental
+} // namespace SilKit
@@ -23,6 +23,7 @@
 
 #include <memory>
 #include <mutex>
+#include <string>
 #include <vector>
 
 #include "silkit/capi/Participant.h"
@@ -51,6 +52,8 @@
 
 #include "silkit/detail/impl/experimental/services/orchestration/SystemController.hpp"
 
+#include "silkit/experimental/participant/ParticipantDatatypesExtensions.hpp"
+
 
 namespace SilKit {
 DETAIL_SILKIT_DETAIL_VN_NAMESPACE_BEGIN
@@ -100,6 +103,9 @@ public:
     inline auto ExperimentalCreateSystemController()
         -> SilKit::Experimental::Services::Orchestration::ISystemController*;
 
+    inline auto ExperimentalGetSendQueueStatus(const std::string& participantName)
+        -> SilKit::Experimental::Participant::SendQueueStatus;
+
 public:
     inline auto Get() const -> SilKit_Participant*;
 
@@ -243,6 +249,28 @@ auto Participant::ExperimentalCreateSystemController()
     return _systemController.get();
 }
 
+auto Participant::ExperimentalGetSendQueueStatus(const std::string& participantName)
+    -> SilKit::Experimental::Participant::SendQueueStatus
+{
+    SilKit_Experimental_SendQueueStatus cStatus;
+    SilKit_Struct_Init(SilKit_Experimental_SendQueueStatus, cStatus);
+
+    const auto returnCode =
+        SilKit_Experimental_Participant_GetSendQueueStatus(_participant, participantName.c_str(), &cStatus);
+    ThrowOnError(returnCode);
+
+    SilKit::Experimental::Participant::SendQueueStatus cppStatus{};
+    cppStatus.queuedMessages = cStatus.queuedMessages;
+    cppStatus.queuedBytes = cStatus.queuedBytes;
+    cppStatus.maxQueuedBytes = cStatus.maxQueuedBytes;
+    cppStatus.droppedMessages = cStatus.droppedMessages;
+    cppStatus.rejectedMessages = cStatus.rejectedMessages;
+    cppStatus.blockedSends = cStatus.blockedSends;
+    cppStatus.conflatedMessages = cStatus.conflatedMessages;
+
+    return cppStatus;
+}
+
 auto Participant::Get() const -> SilKit_Participant*
 {
     return _participant;
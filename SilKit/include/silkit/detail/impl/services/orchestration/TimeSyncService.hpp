@@ -25,6 +25,7 @@
 
 #include "silkit/participant/exception.hpp"
 #include "silkit/services/orchestration/ITimeSyncService.hpp"
+#include "silkit/experimental/services/orchestration/OrchestrationDatatypesExtensions.hpp"
 
 
 namespace SilKit {
@@ -48,6 +49,12 @@ public:
 
     inline auto Now() const -> std::chrono::nanoseconds override;
 
+public:
+    inline void ExperimentalSetNextEventTime(std::chrono::nanoseconds nextEventTime);
+
+    inline auto ExperimentalGetRealTimePacingStatistics()
+        -> SilKit::Experimental::Services::Orchestration::RealTimePacingStatistics;
+
 private:
     SilKit_TimeSyncService* _timeSyncService{nullptr};
 
@@ -136,6 +143,31 @@ auto TimeSyncService::Now() const -> std::chrono::nanoseconds
     return std::chrono::nanoseconds{nanosecondsTime};
 }
 
+void TimeSyncService::ExperimentalSetNextEventTime(std::chrono::nanoseconds nextEventTime)
+{
+    const auto returnCode = SilKit_Experimental_TimeSyncService_SetNextEventTime(_timeSyncService, nextEventTime.count());
+    ThrowOnError(returnCode);
+}
+
+auto TimeSyncService::ExperimentalGetRealTimePacingStatistics()
+    -> SilKit::Experimental::Services::Orchestration::RealTimePacingStatistics
+{
+    SilKit_Experimental_RealTimePacingStatistics cStatistics;
+    SilKit_Struct_Init(SilKit_Experimental_RealTimePacingStatistics, cStatistics);
+
+    const auto returnCode =
+        SilKit_Experimental_TimeSyncService_GetRealTimePacingStatistics(_timeSyncService, &cStatistics);
+    ThrowOnError(returnCode);
+
+    SilKit::Experimental::Services::Orchestration::RealTimePacingStatistics cppStatistics{};
+    cppStatistics.steps = cStatistics.steps;
+    cppStatistics.overruns = cStatistics.overruns;
+    cppStatistics.lastLag = std::chrono::nanoseconds{cStatistics.lastLag};
+    cppStatistics.maxLag = std::chrono::nanoseconds{cStatistics.maxLag};
+    cppStatistics.totalLag = std::chrono::nanoseconds{cStatistics.totalLag};
+    return cppStatistics;
+}
+
 } // namespace Orchestration
 } // namespace Services
 } // namespace Impl
@@ -26,6 +26,7 @@
 #include "silkit/capi/DataPubSub.h"
 
 #include "silkit/services/pubsub/IDataPublisher.hpp"
+#include "silkit/services/pubsub/PubSubSpec.hpp"
 
 
 namespace SilKit {
@@ -44,6 +45,11 @@ public:
 
     inline void Publish(Util::Span<const uint8_t> data) override;
 
+public:
+    inline auto ExperimentalLoanBuffer(size_t size, uint8_t** outData) -> SilKit_Experimental_DataPublisherLoan*;
+
+    inline void ExperimentalPublishLoan(SilKit_Experimental_DataPublisherLoan* loan);
+
 private:
     SilKit_DataPublisher* _dataPublisher{nullptr};
 };
@@ -93,6 +99,20 @@ void DataPublisher::Publish(Util::Span<const uint8_t> data)
     ThrowOnError(returnCode);
 }
 
+auto DataPublisher::ExperimentalLoanBuffer(size_t size, uint8_t** outData) -> SilKit_Experimental_DataPublisherLoan*
+{
+    SilKit_Experimental_DataPublisherLoan* loan{nullptr};
+    const auto returnCode = SilKit_Experimental_DataPublisher_LoanBuffer(_dataPublisher, size, &loan, outData);
+    ThrowOnError(returnCode);
+    return loan;
+}
+
+void DataPublisher::ExperimentalPublishLoan(SilKit_Experimental_DataPublisherLoan* loan)
+{
+    const auto returnCode = SilKit_Experimental_DataPublisher_PublishLoan(_dataPublisher, loan);
+    ThrowOnError(returnCode);
+}
+
 } // namespace PubSub
 } // namespace Services
 } // namespace Impl
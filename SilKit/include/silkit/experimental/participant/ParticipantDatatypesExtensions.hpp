@@ -0,0 +1,48 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <cstdint>
+
+namespace SilKit {
+namespace Experimental {
+namespace Participant {
+
+/*! \brief Fill level and overflow counters of the send queue to another participant.
+ *
+ * The queue is limited by the SendQueueHighWatermark of the middleware configuration. The counters
+ * of the SendQueuePolicy show how often bus messages were dropped, rejected or blocked because of it.
+ */
+struct SendQueueStatus
+{
+    uint64_t queuedMessages{0}; //!< Number of messages waiting to be written
+    uint64_t queuedBytes{0}; //!< Number of bytes waiting to be written
+    uint64_t maxQueuedBytes{0}; //!< Highest number of queued bytes observed so far
+    uint64_t droppedMessages{0}; //!< Number of bus messages dropped by the DropOldest policy
+    uint64_t rejectedMessages{0}; //!< Number of bus messages rejected by the Error policy
+    uint64_t blockedSends{0}; //!< Number of sends which were blocked by the Block policy
+    uint64_t conflatedMessages{0}; //!< Number of queued messages replaced by newer ones for latest-value subscribers
+};
+
+} // namespace Participant
+} // namespace Experimental
+} // namespace SilKit
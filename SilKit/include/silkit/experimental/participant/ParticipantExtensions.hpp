@@ -24,6 +24,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "silkit/SilKitMacros.hpp"
 #include "silkit/participant/IParticipant.hpp"
 #include "silkit/experimental/services/orchestration/ISystemController.hpp"
+#include "silkit/experimental/participant/ParticipantDatatypesExtensions.hpp"
 
 #include "silkit/detail/macros.hpp"
 
@@ -42,6 +43,16 @@ namespace Participant {
 DETAIL_SILKIT_CPP_API auto CreateSystemController(SilKit::IParticipant* participant)
     -> SilKit::Experimental::Services::Orchestration::ISystemController*;
 
+/*! \brief Return the status of the send queue to another participant of the simulation.
+*
+* \param participant The participant instance which sends to the other participant
+* \param participantName The name of the other participant
+*
+* \throw SilKit::SilKitError The participant is invalid, or it is not connected to a participant of the given name.
+*/
+DETAIL_SILKIT_CPP_API auto GetSendQueueStatus(SilKit::IParticipant* participant, const std::string& participantName)
+    -> SilKit::Experimental::Participant::SendQueueStatus;
+
 } // namespace Participant
 } // namespace Experimental
 DETAIL_SILKIT_DETAIL_VN_NAMESPACE_CLOSE
@@ -0,0 +1,46 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace SilKit {
+namespace Experimental {
+namespace Services {
+namespace Orchestration {
+
+//! \brief Statistics of the real-time pacing of the simulation steps, see the TimeSynchronization/RealTimeFactor
+//! of the participant configuration.
+struct RealTimePacingStatistics
+{
+    uint64_t steps{0}; //!< Number of paced simulation steps
+    uint64_t overruns{0}; //!< Steps whose deadline had already passed when the participant got to execute them
+    std::chrono::nanoseconds lastLag{0}; //!< Delay between the deadline and the start of the last step
+    std::chrono::nanoseconds maxLag{0}; //!< Largest delay between the deadline and the start of a step
+    std::chrono::nanoseconds totalLag{0}; //!< Sum of the delays of all steps
+};
+
+} // namespace Orchestration
+} // namespace Services
+} // namespace Experimental
+} // namespace SilKit
@@ -0,0 +1,77 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <chrono>
+
+#include "silkit/services/orchestration/ITimeSyncService.hpp"
+#include "silkit/experimental/services/orchestration/OrchestrationDatatypesExtensions.hpp"
+
+#include "silkit/detail/macros.hpp"
+
+
+namespace SilKit {
+DETAIL_SILKIT_DETAIL_VN_NAMESPACE_BEGIN
+namespace Experimental {
+namespace Services {
+namespace Orchestration {
+
+/*! \brief Announce that nothing happens for this participant before the given simulation time.
+ *
+ * The next simulation step is executed at nextEventTime instead of after the duration of the current step. The steps
+ * in between are skipped and the other participants are not blocked by this participant until then.
+ * Called from the simulation step handler (or before CompleteSimulationStep), it moves the next step.
+ * Called between the simulation steps, e.g., from a message handler, the next step was already announced to the other
+ * participants. A later time postpones the announced step. An earlier time does not wake up the participant before the
+ * announced step, because the other participants may already have advanced beyond it. Instead, no steps are skipped
+ * after the announced step. Times before the end of the current simulation step schedule the next step at the end of
+ * the current step.
+ *
+ * \param timeSyncService The time synchronization service of the participant.
+ * \param nextEventTime The simulation time of the next simulation step.
+ *
+ * \throws SilKit::StateError if the lifecycle of the participant was not yet started.
+ */
+DETAIL_SILKIT_CPP_API void SetNextEventTime(SilKit::Services::Orchestration::ITimeSyncService* timeSyncService,
+                                            std::chrono::nanoseconds nextEventTime);
+
+/*! \brief Return the statistics of the real-time pacing of the simulation steps.
+ *
+ * The simulation steps are paced to the wall clock if TimeSynchronization/RealTimeFactor is configured for the
+ * participant. Otherwise, all statistics are zero.
+ *
+ * \param timeSyncService The time synchronization service of the participant.
+ */
+DETAIL_SILKIT_CPP_API auto GetRealTimePacingStatistics(SilKit::Services::Orchestration::ITimeSyncService* timeSyncService)
+    -> SilKit::Experimental::Services::Orchestration::RealTimePacingStatistics;
+
+} // namespace Orchestration
+} // namespace Services
+} // namespace Experimental
+DETAIL_SILKIT_DETAIL_VN_NAMESPACE_CLOSE
+} // namespace SilKit
+
+
+//! \cond DOCUMENT_HEADER_ONLY_DETAILS
+#include "silkit/detail/impl/experimental/services/orchestration/TimeSyncServiceExtensions.ipp"
+//! \endcond
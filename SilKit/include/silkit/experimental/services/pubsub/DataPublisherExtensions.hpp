@@ -0,0 +1,102 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "silkit/capi/DataPubSub.h"
+#include "silkit/services/pubsub/IDataPublisher.hpp"
+#include "silkit/util/Span.hpp"
+
+#include "silkit/detail/macros.hpp"
+
+
+namespace SilKit {
+DETAIL_SILKIT_DETAIL_VN_NAMESPACE_BEGIN
+namespace Experimental {
+namespace Services {
+namespace PubSub {
+
+/*! \brief Buffer loaned from a DataPublisher by \ref LoanBuffer.
+ *
+ * The buffer is laid out like the message on the wire, so publishing it hands the data to the network without
+ * copying it. The loan is move-only. A loan which is not published is released by its destructor.
+ */
+class DataPublisherLoan
+{
+public:
+    DataPublisherLoan() = default;
+    inline DataPublisherLoan(SilKit_Experimental_DataPublisherLoan* loan, uint8_t* data, size_t size);
+
+    DataPublisherLoan(const DataPublisherLoan&) = delete;
+    DataPublisherLoan& operator=(const DataPublisherLoan&) = delete;
+    inline DataPublisherLoan(DataPublisherLoan&& other) noexcept;
+    inline DataPublisherLoan& operator=(DataPublisherLoan&& other) noexcept;
+
+    inline ~DataPublisherLoan();
+
+    //! The data to be filled in place before publishing the loan. Empty if the loan was published.
+    inline auto Data() const -> SilKit::Util::Span<uint8_t>;
+
+    //! Give up the ownership of the loaned buffer without releasing it
+    inline auto Release() -> SilKit_Experimental_DataPublisherLoan*;
+
+private:
+    inline void Reset();
+
+private:
+    SilKit_Experimental_DataPublisherLoan* _loan{nullptr};
+    uint8_t* _data{nullptr};
+    size_t _size{0};
+};
+
+/*! \brief Loan a buffer for the data of the next message of the given DataPublisher.
+ *
+ * \param dataPublisher The DataPublisher that publishes the data.
+ * \param size The size of the data in bytes.
+ *
+ * \return The loaned buffer, whose data is filled in place and published by \ref Publish.
+ */
+DETAIL_SILKIT_CPP_API auto LoanBuffer(SilKit::Services::PubSub::IDataPublisher* dataPublisher, size_t size)
+    -> DataPublisherLoan;
+
+/*! \brief Publish the data of a loaned buffer without copying it.
+ *
+ * The loan is consumed, even if an exception is thrown.
+ *
+ * \param dataPublisher The DataPublisher that publishes the data.
+ * \param loan The buffer obtained from \ref LoanBuffer.
+ */
+DETAIL_SILKIT_CPP_API void Publish(SilKit::Services::PubSub::IDataPublisher* dataPublisher, DataPublisherLoan&& loan);
+
+} // namespace PubSub
+} // namespace Services
+} // namespace Experimental
+DETAIL_SILKIT_DETAIL_VN_NAMESPACE_CLOSE
+} // namespace SilKit
+
+
+//! \cond DOCUMENT_HEADER_ONLY_DETAILS
+#include "silkit/detail/impl/experimental/services/pubsub/DataPublisherExtensions.ipp"
+//! \endcond
@@ -25,6 +25,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "silkit/services/orchestration/all.hpp"
 #include "silkit/services/pubsub/all.hpp"
 
+#include "services/pubsub/DataPublisherExtensionsImpl.hpp"
+
 #include "CapiImpl.hpp"
 #include "TypeConversion.hpp"
 
@@ -68,6 +70,53 @@ try
 CAPI_CATCH_EXCEPTIONS
 
 
+SilKit_ReturnCode SilKitCALL SilKit_Experimental_DataPublisher_LoanBuffer(SilKit_DataPublisher* self, size_t size,
+                                                                         SilKit_Experimental_DataPublisherLoan** outLoan,
+                                                                         uint8_t** outData)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(self);
+    ASSERT_VALID_OUT_PARAMETER(outLoan);
+    ASSERT_VALID_OUT_PARAMETER(outData);
+
+    auto cppPublisher = reinterpret_cast<SilKit::Services::PubSub::IDataPublisher*>(self);
+    auto loan = SilKit::Experimental::Services::PubSub::LoanBufferImpl(cppPublisher, size);
+    *outData = loan->data;
+    *outLoan = reinterpret_cast<SilKit_Experimental_DataPublisherLoan*>(loan.release());
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
+SilKit_ReturnCode SilKitCALL SilKit_Experimental_DataPublisher_PublishLoan(SilKit_DataPublisher* self,
+                                                                          SilKit_Experimental_DataPublisherLoan* loan)
+try
+{
+    // the loan is consumed, even if the publisher is invalid
+    std::unique_ptr<SilKit::Experimental::Services::PubSub::DataPublisherLoanImpl> cppLoan{
+        reinterpret_cast<SilKit::Experimental::Services::PubSub::DataPublisherLoanImpl*>(loan)};
+
+    ASSERT_VALID_POINTER_PARAMETER(self);
+    ASSERT_VALID_POINTER_PARAMETER(loan);
+
+    auto cppPublisher = reinterpret_cast<SilKit::Services::PubSub::IDataPublisher*>(self);
+    SilKit::Experimental::Services::PubSub::PublishLoanImpl(cppPublisher, std::move(cppLoan));
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
+SilKit_ReturnCode SilKitCALL SilKit_Experimental_DataPublisherLoan_Release(SilKit_Experimental_DataPublisherLoan* loan)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(loan);
+
+    delete reinterpret_cast<SilKit::Experimental::Services::PubSub::DataPublisherLoanImpl*>(loan);
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
 SilKit_ReturnCode SilKitCALL SilKit_DataSubscriber_Create(SilKit_DataSubscriber** outSubscriber, SilKit_Participant* participant,
                                                const char* controllerName, SilKit_DataSpec* dataSpec,
                                                void* defaultDataHandlerContext,
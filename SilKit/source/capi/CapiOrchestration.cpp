@@ -23,8 +23,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "silkit/SilKit.hpp"
 #include "silkit/services/orchestration/all.hpp"
 #include "silkit/participant/exception.hpp"
+#include "silkit/experimental/services/orchestration/OrchestrationDatatypesExtensions.hpp"
 
 #include "participant/ParticipantExtensionsImpl.hpp"
+#include "services/orchestration/TimeSyncServiceExtensionsImpl.hpp"
 
 #include "CapiImpl.hpp"
 #include "TypeConversion.hpp"
@@ -450,6 +452,42 @@ try
 CAPI_CATCH_EXCEPTIONS
 
 
+SilKit_ReturnCode SilKitCALL SilKit_Experimental_TimeSyncService_SetNextEventTime(
+    SilKit_TimeSyncService* cTimeSyncService, SilKit_NanosecondsTime nextEventTime)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(cTimeSyncService);
+
+    auto* timeSyncService = reinterpret_cast<SilKit::Services::Orchestration::ITimeSyncService*>(cTimeSyncService);
+    SilKit::Experimental::Services::Orchestration::SetNextEventTimeImpl(timeSyncService,
+                                                                        std::chrono::nanoseconds{nextEventTime});
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
+SilKit_ReturnCode SilKitCALL SilKit_Experimental_TimeSyncService_GetRealTimePacingStatistics(
+    SilKit_TimeSyncService* cTimeSyncService, SilKit_Experimental_RealTimePacingStatistics* outStatistics)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(cTimeSyncService);
+    ASSERT_VALID_OUT_PARAMETER(outStatistics);
+
+    auto* timeSyncService = reinterpret_cast<SilKit::Services::Orchestration::ITimeSyncService*>(cTimeSyncService);
+    const auto cppStatistics =
+        SilKit::Experimental::Services::Orchestration::GetRealTimePacingStatisticsImpl(timeSyncService);
+
+    SilKit_Struct_Init(SilKit_Experimental_RealTimePacingStatistics, *outStatistics);
+    outStatistics->steps = cppStatistics.steps;
+    outStatistics->overruns = cppStatistics.overruns;
+    outStatistics->lastLag = static_cast<SilKit_NanosecondsTime>(cppStatistics.lastLag.count());
+    outStatistics->maxLag = static_cast<SilKit_NanosecondsTime>(cppStatistics.maxLag.count());
+    outStatistics->totalLag = static_cast<SilKit_NanosecondsTime>(cppStatistics.totalLag.count());
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
 SilKit_ReturnCode SilKitCALL SilKit_LifecycleService_Pause(SilKit_LifecycleService* clifecycleService, const char* reason)
 try
 {
@@ -22,11 +22,13 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "ParticipantConfiguration.hpp"
 #include "ParticipantConfigurationFromXImpl.hpp"
 #include "CreateParticipantImpl.hpp"
+#include "participant/ParticipantExtensionsImpl.hpp"
 
 #include "silkit/capi/SilKit.h"
 #include "silkit/SilKit.hpp"
 #include "silkit/services/logging/ILogger.hpp"
 #include "silkit/services/orchestration/all.hpp"
+#include "silkit/experimental/participant/ParticipantDatatypesExtensions.hpp"
 
 #include "CapiImpl.hpp"
 #include "TypeConversion.hpp"
@@ -102,6 +104,30 @@ try
 CAPI_CATCH_EXCEPTIONS
 
 
+SilKit_ReturnCode SilKitCALL SilKit_Experimental_Participant_GetSendQueueStatus(
+    SilKit_Participant* participant, const char* participantName, SilKit_Experimental_SendQueueStatus* outStatus)
+try
+{
+    ASSERT_VALID_POINTER_PARAMETER(participant);
+    ASSERT_VALID_POINTER_PARAMETER(participantName);
+    ASSERT_VALID_OUT_PARAMETER(outStatus);
+
+    auto cppParticipant = reinterpret_cast<SilKit::IParticipant*>(participant);
+    const auto cppStatus = SilKit::Experimental::Participant::GetSendQueueStatusImpl(cppParticipant, participantName);
+
+    SilKit_Struct_Init(SilKit_Experimental_SendQueueStatus, *outStatus);
+    outStatus->queuedMessages = cppStatus.queuedMessages;
+    outStatus->queuedBytes = cppStatus.queuedBytes;
+    outStatus->maxQueuedBytes = cppStatus.maxQueuedBytes;
+    outStatus->droppedMessages = cppStatus.droppedMessages;
+    outStatus->rejectedMessages = cppStatus.rejectedMessages;
+    outStatus->blockedSends = cppStatus.blockedSends;
+    outStatus->conflatedMessages = cppStatus.conflatedMessages;
+    return SilKit_ReturnCode_SUCCESS;
+}
+CAPI_CATCH_EXCEPTIONS
+
+
 SilKit_ReturnCode SilKitCALL SilKit_ParticipantConfiguration_FromString(
     SilKit_ParticipantConfiguration** outParticipantConfiguration,
     const char* participantConfigurationString)
@@ -51,6 +51,9 @@ SilKit_HandlerId id;
 (void) SilKit_DataPublisher_Create(nullptr, nullptr,"",nullptr,0);
 (void) SilKit_DataSubscriber_Create(nullptr, nullptr, "", nullptr, nullptr, nullptr);
 (void) SilKit_DataPublisher_Publish(nullptr, nullptr);
+(void) SilKit_Experimental_DataPublisher_LoanBuffer(nullptr, 0, nullptr, nullptr);
+(void) SilKit_Experimental_DataPublisher_PublishLoan(nullptr, nullptr);
+(void) SilKit_Experimental_DataPublisherLoan_Release(nullptr);
 (void) SilKit_DataSubscriber_SetDataMessageHandler(nullptr, nullptr, nullptr);
 (void) SilKit_EthernetController_Create(nullptr, nullptr, "", "");
 (void) SilKit_EthernetController_Activate(nullptr);
@@ -117,6 +120,8 @@ SilKit_HandlerId id;
 (void) SilKit_TimeSyncService_SetSimulationStepHandler(nullptr, nullptr, nullptr, 0);
 (void) SilKit_TimeSyncService_SetSimulationStepHandlerAsync(nullptr, nullptr, nullptr, 0);
 (void) SilKit_TimeSyncService_CompleteSimulationStep(nullptr);
+(void) SilKit_Experimental_TimeSyncService_SetNextEventTime(nullptr, 0);
+(void) SilKit_Experimental_TimeSyncService_GetRealTimePacingStatistics(nullptr, nullptr);
 (void) SilKit_LifecycleService_Pause(nullptr, "");
 (void) SilKit_LifecycleService_Continue(nullptr);
 (void) SilKit_LifecycleService_Stop(nullptr, "");
@@ -140,6 +145,7 @@ SilKit_HandlerId id;
 (void) SilKit_RpcClient_SetCallResultHandler(nullptr, nullptr, nullptr);
 (void) SilKit_ReturnCodeToString(nullptr, SilKit_ReturnCode_BADPARAMETER);
 (void) SilKit_Participant_GetLogger(nullptr, nullptr);
+(void) SilKit_Experimental_Participant_GetSendQueueStatus(nullptr, nullptr, nullptr);
 (void)SilKit_GetLastErrorString();
 }
 
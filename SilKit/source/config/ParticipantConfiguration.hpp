@@ -140,14 +140,37 @@ struct DataPublisher
     Replay replay;
 };
 
+//! \brief Predicate on the data received by a DataSubscriber: the bytes at the offset are equal to the value,
+//! compared bitwise under the mask. An empty mask compares all bits.
+struct DataContentPredicate
+{
+    size_t offset{0};
+    std::vector<uint8_t> value;
+    std::vector<uint8_t> mask;
+};
+
 //! \brief Subscriber configuration for the Data communication service
 struct DataSubscriber
 {
     static constexpr auto GetNetworkType() -> NetworkType { return NetworkType::Data; }
 
+    enum class DeliveryMode
+    {
+        //! Every published message is delivered
+        All,
+        //! Messages of a DataPublisher which are still queued for sending are replaced by newer ones
+        LatestValue,
+    };
+
     std::string name;
     SilKit::Util::Optional<std::string> topic;
 
+    //! \brief Only data matching all predicates is received. The filter is sent to the DataPublishers, which do not
+    //! send data that does not match it.
+    std::vector<DataContentPredicate> contentFilter;
+
+    DeliveryMode deliveryMode{DeliveryMode::All};
+
     std::vector<std::string> useTraceSinks;
     Replay replay;
 };
@@ -191,6 +214,35 @@ struct HealthCheck
     SilKit::Util::Optional<std::chrono::milliseconds> hardResponseTimeout;
 };
 
+// ================================================================================
+//  Time synchronization
+// ================================================================================
+
+//! \brief Distributed time synchronization
+struct TimeSynchronization
+{
+    //! Pacing of a participant which lags behind its real-time schedule
+    enum class RealTimeCatchUp
+    {
+        Burst, //!< Execute the late simulation steps without waiting, until the schedule is met again
+        Skip //!< Drop the lag and continue the schedule from the late simulation step
+    };
+
+    //! Minimum delay in simulation time between receiving a message and sending a reaction to it. Other participants
+    //! may advance their time up to this far beyond the next simulation step of this participant. Disabled if 0.
+    std::chrono::nanoseconds lookahead{0};
+    //! Name of the participant which coordinates the time synchronization. If set, the participants report their next
+    //! simulation step to the coordinator only, instead of broadcasting it. Must be the same for all participants.
+    std::string coordinator;
+    //! Paces the simulation steps to the wall clock, e.g., 1.0 for real time, 0.5 for half speed, 10.0 for ten times
+    //! the speed. Disabled if 0.
+    double realTimeFactor{0.0};
+    RealTimeCatchUp realTimeCatchUp{RealTimeCatchUp::Burst};
+    //! Number of asynchronous simulation steps which may be outstanding, i.e., not yet completed by
+    //! CompleteSimulationStep, while the next simulation step is announced and executed. Disabled if 0.
+    int asyncPipelineDepth{0};
+};
+
 // ================================================================================
 //  Tracing service
 // ================================================================================
@@ -219,6 +271,14 @@ struct Extensions
 
 struct Middleware
 {
+    //! Behavior of a connection's send queue once it exceeds the send queue high watermark
+    enum class SendQueuePolicy
+    {
+        Block, //!< Block the sending thread until the queue is drained to the low watermark
+        DropOldest, //!< Drop the oldest queued bus frames until the queue is drained to the low watermark
+        Error //!< Reject bus frames with an exception until the queue is drained to the low watermark
+    };
+
     std::string registryUri{}; //!< Registry URI to connect to (configuration has priority)
     int connectAttempts{ 1 }; //!<  Number of connection attempts to the registry a participant should perform.
     int tcpReceiveBufferSize{ -1 };
@@ -229,6 +289,41 @@ struct Middleware
     std::vector<std::string> acceptorUris{}; //!< Explicit list of endpoints this participant will accept connections on.
     //! By default, communication with other participants using the registry as a proxy is enabled.
     bool registryAsFallbackProxy{ true };
+    //! Upper bound of bytes a peer gathers from its send queue into a single socket write.
+    int sendBatchMaxBytes{ 1024 * 1024 };
+    //! Upper bound of buffers a peer gathers from its send queue into a single socket write.
+    int sendBatchMaxBuffers{ 64 };
+    //! Number of queued bytes per connection which triggers the send queue policy. Unbounded if 0.
+    int sendQueueHighWatermark{ 0 };
+    //! Number of queued bytes per connection at which an overflowing send queue is considered drained.
+    int sendQueueLowWatermark{ 0 };
+    SendQueuePolicy sendQueuePolicy{ SendQueuePolicy::Block };
+    //! Number of threads running the socket I/O. By default, a single thread handles all I/O and callbacks.
+    int ioWorkerThreads{ 1 };
+    //! Handle received messages and callbacks on a dedicated thread, separate from the I/O worker threads.
+    bool dedicatedDispatchThread{ false };
+    //! Transfer the messages between participants on the same host through shared memory, if both support it.
+    bool enableSharedMemory{ false };
+    //! Size of the ring buffer per direction and connection when using shared memory.
+    int sharedMemoryRingSize{ 1024 * 1024 };
+    //! Connect participants in the same process directly in memory instead of through the local-domain socket.
+    bool enableInProcessTransport{ true };
+    //! Pack the simulation messages sent to a participant into a single container until the next flush point.
+    bool enableMessageBatching{ false };
+    //! Size of a message batch in bytes, at which it is sent without waiting for the flush point.
+    int messageBatchMaxBytes{ 64 * 1024 };
+    //! Maximum time in milliseconds a message waits in a batch before the batch is sent.
+    int messageBatchMaxDelay{ 1 };
+    //! Collect counters and histograms of the transport, e.g., sent messages and send latency per connection.
+    bool enableTransportMetrics{ false };
+    //! Interval in milliseconds of writing the transport metrics to the log or file. Disabled if 0.
+    int transportMetricsInterval{ 0 };
+    //! File the transport metrics are appended to. If empty, they are logged with level Info.
+    std::string transportMetricsFile{};
+    //! Send the participant states entered during the startup as compact status, without name and refresh time.
+    bool enableCompactStartupStatus{ false };
+    //! Share one internal subscriber and link per publisher among all DataSubscribers of the participant.
+    bool enableTopicMultiplexing{ false };
 };
 
 // ================================================================================
@@ -267,6 +362,7 @@ struct ParticipantConfiguration
 
     Logging logging;
     HealthCheck healthCheck;
+    TimeSynchronization timeSynchronization;
     Tracing tracing;
     Extensions extensions;
     Middleware middleware;
@@ -277,10 +373,12 @@ bool operator==(const LinController& lhs, const LinController& rhs);
 bool operator==(const EthernetController& lhs, const EthernetController& rhs);
 bool operator==(const FlexrayController& lhs, const FlexrayController& rhs);
 bool operator==(const DataPublisher& lhs, const DataPublisher& rhs);
+bool operator==(const DataContentPredicate& lhs, const DataContentPredicate& rhs);
 bool operator==(const DataSubscriber& lhs, const DataSubscriber& rhs);
 bool operator==(const RpcServer& lhs, const RpcServer& rhs);
 bool operator==(const RpcClient& lhs, const RpcClient& rhs);
 bool operator==(const HealthCheck& lhs, const HealthCheck& rhs);
+bool operator==(const TimeSynchronization& lhs, const TimeSynchronization& rhs);
 bool operator==(const Tracing& lhs, const Tracing& rhs);
 bool operator==(const Extensions& lhs, const Extensions& rhs);
 bool operator==(const Middleware& lhs, const Middleware& rhs);
@@ -106,9 +106,16 @@ bool operator==(const DataPublisher& lhs, const DataPublisher& rhs)
     return lhs.useTraceSinks == rhs.useTraceSinks && lhs.replay == rhs.replay;
 }
 
+bool operator==(const DataContentPredicate& lhs, const DataContentPredicate& rhs)
+{
+    return lhs.offset == rhs.offset && lhs.value == rhs.value && lhs.mask == rhs.mask;
+}
+
 bool operator==(const DataSubscriber& lhs, const DataSubscriber& rhs)
 {
-    return lhs.useTraceSinks == rhs.useTraceSinks && lhs.replay == rhs.replay;
+    return lhs.useTraceSinks == rhs.useTraceSinks && lhs.replay == rhs.replay
+           && lhs.contentFilter == rhs.contentFilter
+           && lhs.deliveryMode == rhs.deliveryMode;
 }
 
 bool operator==(const RpcServer& lhs, const RpcServer& rhs)
@@ -126,6 +133,13 @@ bool operator==(const HealthCheck& lhs, const HealthCheck& rhs)
     return lhs.softResponseTimeout == rhs.softResponseTimeout && lhs.hardResponseTimeout == rhs.hardResponseTimeout;
 }
 
+bool operator==(const TimeSynchronization& lhs, const TimeSynchronization& rhs)
+{
+    return lhs.lookahead == rhs.lookahead && lhs.coordinator == rhs.coordinator
+           && lhs.realTimeFactor == rhs.realTimeFactor && lhs.realTimeCatchUp == rhs.realTimeCatchUp
+           && lhs.asyncPipelineDepth == rhs.asyncPipelineDepth;
+}
+
 bool operator==(const Tracing& lhs, const Tracing& rhs)
 {
     return lhs.traceSinks == rhs.traceSinks && lhs.traceSources == rhs.traceSources;
@@ -142,7 +156,22 @@ bool operator==(const Middleware& lhs, const Middleware& rhs)
     return lhs.registryUri == rhs.registryUri && lhs.connectAttempts == rhs.connectAttempts
            && lhs.enableDomainSockets == rhs.enableDomainSockets && lhs.tcpNoDelay == rhs.tcpNoDelay
            && lhs.tcpQuickAck == rhs.tcpQuickAck && lhs.tcpReceiveBufferSize == rhs.tcpReceiveBufferSize
-           && lhs.tcpSendBufferSize == rhs.tcpSendBufferSize && lhs.acceptorUris == rhs.acceptorUris;
+           && lhs.tcpSendBufferSize == rhs.tcpSendBufferSize && lhs.acceptorUris == rhs.acceptorUris
+           && lhs.sendBatchMaxBytes == rhs.sendBatchMaxBytes && lhs.sendBatchMaxBuffers == rhs.sendBatchMaxBuffers
+           && lhs.sendQueueHighWatermark == rhs.sendQueueHighWatermark
+           && lhs.sendQueueLowWatermark == rhs.sendQueueLowWatermark && lhs.sendQueuePolicy == rhs.sendQueuePolicy
+           && lhs.ioWorkerThreads == rhs.ioWorkerThreads && lhs.dedicatedDispatchThread == rhs.dedicatedDispatchThread
+           && lhs.enableSharedMemory == rhs.enableSharedMemory
+           && lhs.sharedMemoryRingSize == rhs.sharedMemoryRingSize
+           && lhs.enableInProcessTransport == rhs.enableInProcessTransport
+           && lhs.enableMessageBatching == rhs.enableMessageBatching
+           && lhs.messageBatchMaxBytes == rhs.messageBatchMaxBytes
+           && lhs.messageBatchMaxDelay == rhs.messageBatchMaxDelay
+           && lhs.enableTransportMetrics == rhs.enableTransportMetrics
+           && lhs.transportMetricsInterval == rhs.transportMetricsInterval
+           && lhs.transportMetricsFile == rhs.transportMetricsFile
+           && lhs.enableCompactStartupStatus == rhs.enableCompactStartupStatus
+           && lhs.enableTopicMultiplexing == rhs.enableTopicMultiplexing;
 }
 
 bool operator==(const ParticipantConfiguration& lhs, const ParticipantConfiguration& rhs)
@@ -152,7 +181,7 @@ bool operator==(const ParticipantConfiguration& lhs, const ParticipantConfigurat
            && lhs.flexrayControllers == rhs.flexrayControllers && lhs.dataPublishers == rhs.dataPublishers
            && lhs.dataSubscribers == rhs.dataSubscribers && lhs.rpcClients == rhs.rpcClients
            && lhs.rpcServers == rhs.rpcServers && lhs.logging == rhs.logging && lhs.healthCheck == rhs.healthCheck
-           && lhs.tracing == rhs.tracing && lhs.extensions == rhs.extensions;
+           && lhs.timeSynchronization == rhs.timeSynchronization && lhs.tracing == rhs.tracing && lhs.extensions == rhs.extensions;
 }
 
 } // inline namespace v1
@@ -163,6 +163,13 @@ DataPublishers:
 DataSubscribers:
 - Name: Subscriber1
   Topic: Temperature
+  ContentFilter:
+  - Offset: 2
+    Value: [0x12, 0x34]
+    Mask: [0xFF, 0xF0]
+  - Offset: 8
+    Value: [7]
+  DeliveryMode: LatestValue
   UseTraceSinks:
   - Sink1
 RpcServers:
@@ -185,6 +192,12 @@ Logging:
 HealthCheck:
   SoftResponseTimeout: 500
   HardResponseTimeout: 5000
+TimeSynchronization:
+  Lookahead: 1000000
+  Coordinator: TimeSyncCoordinator
+  RealTimeFactor: 0.5
+  RealTimeCatchUp: Skip
+  AsyncPipelineDepth: 1
 Tracing:
   TraceSinks:
   - Name: Sink1
@@ -207,6 +220,24 @@ Middleware:
   TcpSendBufferSize: 3456
   TcpReceiveBufferSize: 3456
   RegistryAsFallbackProxy: false
+  SendBatchMaxBytes: 65536
+  SendBatchMaxBuffers: 32
+  SendQueueHighWatermark: 1048576
+  SendQueueLowWatermark: 524288
+  SendQueuePolicy: DropOldest
+  IoWorkerThreads: 4
+  DedicatedDispatchThread: true
+  EnableSharedMemory: true
+  SharedMemoryRingSize: 65536
+  EnableInProcessTransport: false
+  EnableMessageBatching: true
+  MessageBatchMaxBytes: 32768
+  MessageBatchMaxDelay: 2
+  EnableTransportMetrics: true
+  TransportMetricsInterval: 5000
+  TransportMetricsFile: TransportMetrics.txt
+  EnableCompactStartupStatus: true
+  EnableTopicMultiplexing: true
 
 )raw";
 
@@ -238,6 +269,15 @@ TEST_F(Test_YamlParser, yaml_complete_configuration)
     EXPECT_TRUE(config.dataPublishers.at(0).topic.has_value() && 
         config.dataPublishers.at(0).topic.value() == "Temperature");
 
+    EXPECT_TRUE(config.dataSubscribers.size() == 1);
+    EXPECT_TRUE(config.dataSubscribers.at(0).contentFilter.size() == 2);
+    EXPECT_TRUE(config.dataSubscribers.at(0).contentFilter.at(0).offset == 2);
+    EXPECT_TRUE((config.dataSubscribers.at(0).contentFilter.at(0).value == std::vector<uint8_t>{0x12, 0x34}));
+    EXPECT_TRUE((config.dataSubscribers.at(0).contentFilter.at(0).mask == std::vector<uint8_t>{0xFF, 0xF0}));
+    EXPECT_TRUE(config.dataSubscribers.at(0).contentFilter.at(1).offset == 8);
+    EXPECT_TRUE(config.dataSubscribers.at(0).contentFilter.at(1).mask.empty());
+    EXPECT_TRUE(config.dataSubscribers.at(0).deliveryMode == DataSubscriber::DeliveryMode::LatestValue);
+
     EXPECT_TRUE(config.logging.sinks.size() == 1);
     EXPECT_TRUE(config.logging.sinks.at(0).type == Sink::Type::File);
     EXPECT_TRUE(config.logging.sinks.at(0).level == SilKit::Services::Logging::Level::Critical);
@@ -246,6 +286,12 @@ TEST_F(Test_YamlParser, yaml_complete_configuration)
     EXPECT_TRUE(config.healthCheck.softResponseTimeout.value() == 500ms);
     EXPECT_TRUE(config.healthCheck.hardResponseTimeout.value() == 5000ms);
 
+    EXPECT_TRUE(config.timeSynchronization.lookahead == 1ms);
+    EXPECT_TRUE(config.timeSynchronization.coordinator == "TimeSyncCoordinator");
+    EXPECT_TRUE(config.timeSynchronization.realTimeFactor == 0.5);
+    EXPECT_TRUE(config.timeSynchronization.realTimeCatchUp == TimeSynchronization::RealTimeCatchUp::Skip);
+    EXPECT_TRUE(config.timeSynchronization.asyncPipelineDepth == 1);
+
     EXPECT_TRUE(config.tracing.traceSinks.size() == 1);
     EXPECT_TRUE(config.tracing.traceSinks.at(0).name == "Sink1");
     EXPECT_TRUE(config.tracing.traceSinks.at(0).outputPath == "FlexrayDemo_node0.mf4");
@@ -267,6 +313,24 @@ TEST_F(Test_YamlParser, yaml_complete_configuration)
     EXPECT_TRUE(config.middleware.tcpReceiveBufferSize == 3456);
     EXPECT_TRUE(config.middleware.tcpSendBufferSize == 3456);
     EXPECT_FALSE(config.middleware.registryAsFallbackProxy);
+    EXPECT_TRUE(config.middleware.sendBatchMaxBytes == 65536);
+    EXPECT_TRUE(config.middleware.sendBatchMaxBuffers == 32);
+    EXPECT_TRUE(config.middleware.sendQueueHighWatermark == 1048576);
+    EXPECT_TRUE(config.middleware.sendQueueLowWatermark == 524288);
+    EXPECT_TRUE(config.middleware.sendQueuePolicy == Middleware::SendQueuePolicy::DropOldest);
+    EXPECT_TRUE(config.middleware.ioWorkerThreads == 4);
+    EXPECT_TRUE(config.middleware.dedicatedDispatchThread == true);
+    EXPECT_TRUE(config.middleware.enableSharedMemory == true);
+    EXPECT_TRUE(config.middleware.sharedMemoryRingSize == 65536);
+    EXPECT_TRUE(config.middleware.enableInProcessTransport == false);
+    EXPECT_TRUE(config.middleware.enableMessageBatching == true);
+    EXPECT_TRUE(config.middleware.messageBatchMaxBytes == 32768);
+    EXPECT_TRUE(config.middleware.messageBatchMaxDelay == 2);
+    EXPECT_TRUE(config.middleware.enableTransportMetrics == true);
+    EXPECT_TRUE(config.middleware.transportMetricsInterval == 5000);
+    EXPECT_TRUE(config.middleware.transportMetricsFile == "TransportMetrics.txt");
+    EXPECT_TRUE(config.middleware.enableCompactStartupStatus == true);
+    EXPECT_TRUE(config.middleware.enableTopicMultiplexing == true);
 }
 
 const auto emptyConfiguration = R"raw(
@@ -41,6 +41,30 @@ void optional_encode(const Replay& value, YAML::Node& node, const std::string& f
     }
 }
 
+auto EncodeContentBytes(const std::vector<uint8_t>& bytes) -> YAML::Node
+{
+    YAML::Node node;
+    for (auto byte : bytes)
+    {
+        node.push_back(static_cast<int>(byte));
+    }
+    return node;
+}
+
+auto DecodeContentBytes(const YAML::Node& node) -> std::vector<uint8_t>
+{
+    std::vector<uint8_t> bytes;
+    for (auto&& value : parse_as<std::vector<int>>(node))
+    {
+        if (value < 0 || value > 0xFF)
+        {
+            throw ConversionError(node, "DataContentPredicate: Value and Mask must be a list of bytes.");
+        }
+        bytes.push_back(static_cast<uint8_t>(value));
+    }
+    return bytes;
+}
+
 } // anonymous namespace
 
 // YAML type conversion helpers for ParticipantConfiguration data types
@@ -697,6 +721,38 @@ bool Converter::decode(const Node& node, DataPublisher& obj)
     return true;
 }
 
+template <>
+Node Converter::encode(const DataContentPredicate& obj)
+{
+    Node node;
+    node["Offset"] = obj.offset;
+    node["Value"] = EncodeContentBytes(obj.value);
+    if (!obj.mask.empty())
+    {
+        node["Mask"] = EncodeContentBytes(obj.mask);
+    }
+    return node;
+}
+template <>
+bool Converter::decode(const Node& node, DataContentPredicate& obj)
+{
+    obj.offset = parse_as<size_t>(node["Offset"]);
+    obj.value = DecodeContentBytes(node["Value"]);
+    if (node["Mask"])
+    {
+        obj.mask = DecodeContentBytes(node["Mask"]);
+    }
+    if (obj.value.empty())
+    {
+        throw ConversionError(node, "DataContentPredicate: Value must not be empty.");
+    }
+    if (!obj.mask.empty() && obj.mask.size() != obj.value.size())
+    {
+        throw ConversionError(node, "DataContentPredicate: Mask must have as many bytes as Value.");
+    }
+    return true;
+}
+
 template <>
 Node Converter::encode(const DataSubscriber& obj)
 {
@@ -704,6 +760,8 @@ Node Converter::encode(const DataSubscriber& obj)
     Node node;
     node["Name"] = obj.name;
     optional_encode(obj.topic, node, "Topic");
+    optional_encode(obj.contentFilter, node, "ContentFilter");
+    non_default_encode(obj.deliveryMode, node, "DeliveryMode", defaultObj.deliveryMode);
     optional_encode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_encode(obj.replay, node, "Replay");
     return node;
@@ -713,11 +771,53 @@ bool Converter::decode(const Node& node, DataSubscriber& obj)
 {
     obj.name = parse_as<std::string>(node["Name"]);
     optional_decode(obj.topic, node, "Topic");
+    optional_decode(obj.contentFilter, node, "ContentFilter");
+    optional_decode(obj.deliveryMode, node, "DeliveryMode");
     optional_decode(obj.useTraceSinks, node, "UseTraceSinks");
     optional_decode(obj.replay, node, "Replay");
     return true;
 }
 
+template <>
+Node Converter::encode(const DataSubscriber::DeliveryMode& obj)
+{
+    Node node;
+    switch (obj)
+    {
+    case DataSubscriber::DeliveryMode::All:
+        node = "All";
+        break;
+    case DataSubscriber::DeliveryMode::LatestValue:
+        node = "LatestValue";
+        break;
+    default:
+        break;
+    }
+    return node;
+}
+template <>
+bool Converter::decode(const Node& node, DataSubscriber::DeliveryMode& obj)
+{
+    if (!node.IsScalar())
+    {
+        throw ConversionError(node, "DataSubscriber::DeliveryMode should be a string of All|LatestValue.");
+    }
+    auto&& str = parse_as<std::string>(node);
+    if (str == "All")
+    {
+        obj = DataSubscriber::DeliveryMode::All;
+    }
+    else if (str == "LatestValue")
+    {
+        obj = DataSubscriber::DeliveryMode::LatestValue;
+    }
+    else
+    {
+        throw ConversionError(node, "Unknown DataSubscriber::DeliveryMode: " + str + ".");
+    }
+    return true;
+}
+
 template <>
 Node Converter::encode(const RpcServer& obj)
 {
@@ -776,6 +876,37 @@ bool Converter::decode(const Node& node, HealthCheck& obj)
     return true;
 }
 
+template <>
+Node Converter::encode(const TimeSynchronization& obj)
+{
+    static const TimeSynchronization defaultObj{};
+    Node node;
+    non_default_encode(obj.lookahead, node, "Lookahead", defaultObj.lookahead);
+    non_default_encode(obj.coordinator, node, "Coordinator", defaultObj.coordinator);
+    non_default_encode(obj.realTimeFactor, node, "RealTimeFactor", defaultObj.realTimeFactor);
+    non_default_encode(obj.realTimeCatchUp, node, "RealTimeCatchUp", defaultObj.realTimeCatchUp);
+    non_default_encode(obj.asyncPipelineDepth, node, "AsyncPipelineDepth", defaultObj.asyncPipelineDepth);
+    return node;
+}
+template <>
+bool Converter::decode(const Node& node, TimeSynchronization& obj)
+{
+    optional_decode(obj.lookahead, node, "Lookahead");
+    optional_decode(obj.coordinator, node, "Coordinator");
+    optional_decode(obj.realTimeFactor, node, "RealTimeFactor");
+    if (obj.realTimeFactor < 0.0)
+    {
+        throw ConversionError(node, "TimeSynchronization::RealTimeFactor must not be negative.");
+    }
+    optional_decode(obj.realTimeCatchUp, node, "RealTimeCatchUp");
+    optional_decode(obj.asyncPipelineDepth, node, "AsyncPipelineDepth");
+    if (obj.asyncPipelineDepth < 0)
+    {
+        throw ConversionError(node, "TimeSynchronization::AsyncPipelineDepth must not be negative.");
+    }
+    return true;
+}
+
 template<>
 Node Converter::encode(const Tracing& obj)
 {
@@ -957,6 +1088,27 @@ Node Converter::encode(const Middleware& obj)
     non_default_encode(obj.enableDomainSockets, node, "EnableDomainSockets", defaultObj.enableDomainSockets);
     non_default_encode(obj.acceptorUris, node, "acceptorUris", defaultObj.acceptorUris);
     non_default_encode(obj.registryAsFallbackProxy, node, "RegistryAsFallbackProxy", defaultObj.registryAsFallbackProxy);
+    non_default_encode(obj.sendBatchMaxBytes, node, "SendBatchMaxBytes", defaultObj.sendBatchMaxBytes);
+    non_default_encode(obj.sendBatchMaxBuffers, node, "SendBatchMaxBuffers", defaultObj.sendBatchMaxBuffers);
+    non_default_encode(obj.sendQueueHighWatermark, node, "SendQueueHighWatermark", defaultObj.sendQueueHighWatermark);
+    non_default_encode(obj.sendQueueLowWatermark, node, "SendQueueLowWatermark", defaultObj.sendQueueLowWatermark);
+    non_default_encode(obj.sendQueuePolicy, node, "SendQueuePolicy", defaultObj.sendQueuePolicy);
+    non_default_encode(obj.ioWorkerThreads, node, "IoWorkerThreads", defaultObj.ioWorkerThreads);
+    non_default_encode(obj.dedicatedDispatchThread, node, "DedicatedDispatchThread", defaultObj.dedicatedDispatchThread);
+    non_default_encode(obj.enableSharedMemory, node, "EnableSharedMemory", defaultObj.enableSharedMemory);
+    non_default_encode(obj.sharedMemoryRingSize, node, "SharedMemoryRingSize", defaultObj.sharedMemoryRingSize);
+    non_default_encode(obj.enableInProcessTransport, node, "EnableInProcessTransport",
+                       defaultObj.enableInProcessTransport);
+    non_default_encode(obj.enableMessageBatching, node, "EnableMessageBatching", defaultObj.enableMessageBatching);
+    non_default_encode(obj.messageBatchMaxBytes, node, "MessageBatchMaxBytes", defaultObj.messageBatchMaxBytes);
+    non_default_encode(obj.messageBatchMaxDelay, node, "MessageBatchMaxDelay", defaultObj.messageBatchMaxDelay);
+    non_default_encode(obj.enableTransportMetrics, node, "EnableTransportMetrics", defaultObj.enableTransportMetrics);
+    non_default_encode(obj.transportMetricsInterval, node, "TransportMetricsInterval",
+                       defaultObj.transportMetricsInterval);
+    non_default_encode(obj.transportMetricsFile, node, "TransportMetricsFile", defaultObj.transportMetricsFile);
+    non_default_encode(obj.enableCompactStartupStatus, node, "EnableCompactStartupStatus", defaultObj.enableCompactStartupStatus);
+    non_default_encode(obj.enableTopicMultiplexing, node, "EnableTopicMultiplexing",
+                       defaultObj.enableTopicMultiplexing);
     return node;
 }
 template<>
@@ -971,6 +1123,111 @@ bool Converter::decode(const Node& node, Middleware& obj)
     optional_decode(obj.enableDomainSockets, node, "EnableDomainSockets");
     optional_decode(obj.acceptorUris, node, "AcceptorUris");
     optional_decode(obj.registryAsFallbackProxy, node, "RegistryAsFallbackProxy");
+    optional_decode(obj.sendBatchMaxBytes, node, "SendBatchMaxBytes");
+    optional_decode(obj.sendBatchMaxBuffers, node, "SendBatchMaxBuffers");
+    optional_decode(obj.sendQueueHighWatermark, node, "SendQueueHighWatermark");
+    optional_decode(obj.sendQueueLowWatermark, node, "SendQueueLowWatermark");
+    optional_decode(obj.sendQueuePolicy, node, "SendQueuePolicy");
+    optional_decode(obj.ioWorkerThreads, node, "IoWorkerThreads");
+    optional_decode(obj.dedicatedDispatchThread, node, "DedicatedDispatchThread");
+    optional_decode(obj.enableSharedMemory, node, "EnableSharedMemory");
+    optional_decode(obj.sharedMemoryRingSize, node, "SharedMemoryRingSize");
+    optional_decode(obj.enableInProcessTransport, node, "EnableInProcessTransport");
+    optional_decode(obj.enableMessageBatching, node, "EnableMessageBatching");
+    optional_decode(obj.messageBatchMaxBytes, node, "MessageBatchMaxBytes");
+    optional_decode(obj.messageBatchMaxDelay, node, "MessageBatchMaxDelay");
+    optional_decode(obj.enableTransportMetrics, node, "EnableTransportMetrics");
+    optional_decode(obj.transportMetricsInterval, node, "TransportMetricsInterval");
+    optional_decode(obj.transportMetricsFile, node, "TransportMetricsFile");
+    optional_decode(obj.enableCompactStartupStatus, node, "EnableCompactStartupStatus");
+    optional_decode(obj.enableTopicMultiplexing, node, "EnableTopicMultiplexing");
+    return true;
+}
+
+template<>
+Node Converter::encode(const Middleware::SendQueuePolicy& obj)
+{
+    Node node;
+    switch (obj)
+    {
+    case Middleware::SendQueuePolicy::Block:
+        node = "Block";
+        break;
+    case Middleware::SendQueuePolicy::DropOldest:
+        node = "DropOldest";
+        break;
+    case Middleware::SendQueuePolicy::Error:
+        node = "Error";
+        break;
+    default:
+        break;
+    }
+    return node;
+}
+template<>
+bool Converter::decode(const Node& node, Middleware::SendQueuePolicy& obj)
+{
+    if (!node.IsScalar())
+    {
+        throw ConversionError(node, "Middleware::SendQueuePolicy should be a string of Block|DropOldest|Error.");
+    }
+    auto&& str = parse_as<std::string>(node);
+    if (str == "Block")
+    {
+        obj = Middleware::SendQueuePolicy::Block;
+    }
+    else if (str == "DropOldest")
+    {
+        obj = Middleware::SendQueuePolicy::DropOldest;
+    }
+    else if (str == "Error")
+    {
+        obj = Middleware::SendQueuePolicy::Error;
+    }
+    else
+    {
+        throw ConversionError(node, "Unknown Middleware::SendQueuePolicy: " + str + ".");
+    }
+    return true;
+}
+
+template<>
+Node Converter::encode(const TimeSynchronization::RealTimeCatchUp& obj)
+{
+    Node node;
+    switch (obj)
+    {
+    case TimeSynchronization::RealTimeCatchUp::Burst:
+        node = "Burst";
+        break;
+    case TimeSynchronization::RealTimeCatchUp::Skip:
+        node = "Skip";
+        break;
+    default:
+        break;
+    }
+    return node;
+}
+template<>
+bool Converter::decode(const Node& node, TimeSynchronization::RealTimeCatchUp& obj)
+{
+    if (!node.IsScalar())
+    {
+        throw ConversionError(node, "TimeSynchronization::RealTimeCatchUp should be a string of Burst|Skip.");
+    }
+    auto&& str = parse_as<std::string>(node);
+    if (str == "Burst")
+    {
+        obj = TimeSynchronization::RealTimeCatchUp::Burst;
+    }
+    else if (str == "Skip")
+    {
+        obj = TimeSynchronization::RealTimeCatchUp::Skip;
+    }
+    else
+    {
+        throw ConversionError(node, "Unknown TimeSynchronization::RealTimeCatchUp: " + str + ".");
+    }
     return true;
 }
 
@@ -1000,6 +1257,7 @@ Node Converter::encode(const ParticipantConfiguration& obj)
 
     non_default_encode(obj.logging, node, "Logging", defaultObj.logging);
     non_default_encode(obj.healthCheck, node, "Extensions", defaultObj.healthCheck);
+    non_default_encode(obj.timeSynchronization, node, "TimeSynchronization", defaultObj.timeSynchronization);
     non_default_encode(obj.tracing, node, "Extensions", defaultObj.tracing);
     non_default_encode(obj.extensions, node, "Extensions", defaultObj.extensions);
     non_default_encode(obj.middleware, node, "Middleware", defaultObj.middleware);
@@ -1023,6 +1281,7 @@ bool Converter::decode(const Node& node, ParticipantConfiguration& obj)
 
     optional_decode(obj.logging, node, "Logging");
     optional_decode(obj.healthCheck, node, "HealthCheck");
+    optional_decode(obj.timeSynchronization, node, "TimeSynchronization");
     optional_decode(obj.tracing, node, "Tracing");
     optional_decode(obj.extensions, node, "Extensions");
     optional_decode(obj.middleware, node, "Middleware");
@@ -64,12 +64,16 @@ DEFINE_SILKIT_CONVERT(FlexrayController);
 DEFINE_SILKIT_CONVERT(SilKit::Services::MatchingLabel::Kind);
 DEFINE_SILKIT_CONVERT(SilKit::Services::MatchingLabel);
 DEFINE_SILKIT_CONVERT(DataPublisher);
+DEFINE_SILKIT_CONVERT(DataContentPredicate);
 DEFINE_SILKIT_CONVERT(DataSubscriber);
+DEFINE_SILKIT_CONVERT(DataSubscriber::DeliveryMode);
 DEFINE_SILKIT_CONVERT(RpcServer);
 DEFINE_SILKIT_CONVERT(RpcClient);
 
 DEFINE_SILKIT_CONVERT(HealthCheck);
 
+DEFINE_SILKIT_CONVERT(TimeSynchronization);
+
 DEFINE_SILKIT_CONVERT(Tracing);
 DEFINE_SILKIT_CONVERT(TraceSink);
 DEFINE_SILKIT_CONVERT(TraceSink::Type);
@@ -77,6 +81,8 @@ DEFINE_SILKIT_CONVERT(TraceSource);
 DEFINE_SILKIT_CONVERT(TraceSource::Type);
 
 DEFINE_SILKIT_CONVERT(Middleware);
+DEFINE_SILKIT_CONVERT(Middleware::SendQueuePolicy);
+DEFINE_SILKIT_CONVERT(TimeSynchronization::RealTimeCatchUp);
 
 DEFINE_SILKIT_CONVERT(Extensions);
 
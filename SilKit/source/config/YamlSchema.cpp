@@ -183,6 +183,13 @@ auto MakeYamlSchema() -> YamlSchemaElem
         {"DataSubscribers", {
                 {"Name"},
                 {"Topic"},
+                {"ContentFilter", {
+                        {"Offset"},
+                        {"Value"},
+                        {"Mask"},
+                    }
+                },
+                {"DeliveryMode"},
                 {"UseTraceSinks"},
                 replay,
             }
@@ -207,6 +214,14 @@ auto MakeYamlSchema() -> YamlSchemaElem
                 {"HardResponseTimeout"},
             }
         },
+        {"TimeSynchronization", {
+                {"Lookahead"},
+                {"Coordinator"},
+                {"RealTimeFactor"},
+                {"RealTimeCatchUp"},
+                {"AsyncPipelineDepth"},
+            }
+        },
         {"Tracing", {
                 traceSinks,
                 traceSources
@@ -226,6 +241,24 @@ auto MakeYamlSchema() -> YamlSchemaElem
                 {"EnableDomainSockets"},
                 {"AcceptorUris"},
                 {"RegistryAsFallbackProxy"},
+                {"SendBatchMaxBytes"},
+                {"SendBatchMaxBuffers"},
+                {"SendQueueHighWatermark"},
+                {"SendQueueLowWatermark"},
+                {"SendQueuePolicy"},
+                {"IoWorkerThreads"},
+                {"DedicatedDispatchThread"},
+                {"EnableSharedMemory"},
+                {"SharedMemoryRingSize"},
+                {"EnableInProcessTransport"},
+                {"EnableMessageBatching"},
+                {"MessageBatchMaxBytes"},
+                {"MessageBatchMaxDelay"},
+                {"EnableTransportMetrics"},
+                {"TransportMetricsInterval"},
+                {"TransportMetricsFile"},
+                {"EnableCompactStartupStatus"},
+                {"EnableTopicMultiplexing"},
             }
         }
     };
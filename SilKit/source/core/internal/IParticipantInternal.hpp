@@ -40,6 +40,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "WireRpcMessages.hpp"
 
 #include "ISimulator.hpp"
+#include "TransportMetrics.hpp"
 
 
 // forwards
@@ -119,6 +120,7 @@ public:
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Services::Orchestration::NextSimTask& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Services::Orchestration::ParticipantStatus& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Services::Orchestration::CompactParticipantStatus& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Services::Orchestration::SystemCommand& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const Services::Orchestration::WorkflowConfiguration& msg) = 0;
 
@@ -171,6 +173,7 @@ public:
 
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, const Services::Orchestration::NextSimTask& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, const Services::Orchestration::ParticipantStatus& msg) = 0;
+    virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, const Services::Orchestration::CompactParticipantStatus& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, const Services::Orchestration::SystemCommand& msg) = 0;
     virtual void SendMsg(const SilKit::Core::IServiceEndpoint* from, const std::string& targetParticipantName, const Services::Orchestration::WorkflowConfiguration& msg) = 0;
 
@@ -187,6 +190,12 @@ public:
     virtual void OnAllMessagesDelivered(std::function<void()> callback) = 0;
     virtual void FlushSendBuffers() = 0;
     virtual void ExecuteDeferred(std::function<void()> callback) = 0;
+    //! Like ExecuteDeferred, but not before the steady clock reached the deadline
+    virtual void ExecuteDeferredAt(std::chrono::steady_clock::time_point deadline, std::function<void()> callback) = 0;
+    //! Counters and histograms of the transport, empty unless enabled in the middleware configuration
+    virtual auto GetTransportMetrics() -> TransportMetrics = 0;
+    //! Send queue status of the connections to the other participants, by participant name
+    virtual auto GetSendQueueStatus() -> std::map<std::string, SendQueueStatus> = 0;
 
     // Service discovery for dynamic, configuration-less simulations
     virtual auto GetServiceDiscovery() -> Discovery::IServiceDiscovery* = 0;
@@ -194,13 +203,14 @@ public:
     virtual auto GetRequestReplyService() -> RequestReply::IRequestReplyService* = 0;
     virtual auto GetParticipantRepliesProcedure()->RequestReply::IParticipantReplies* = 0;
 
-	// Internal DataSubscriber that is only created on a matching data connection
+	// Internal DataSubscriber that is only created on a matching data connection. If shareable (the publisher keeps no
+	// history), it may be shared by all DataSubscribers of the participant which match the same publisher.
     virtual auto CreateDataSubscriberInternal(
         const std::string& topic, const std::string& linkName,
         const std::string& mediaType,
         const std::vector<SilKit::Services::MatchingLabel>& publisherLabels,
         Services::PubSub::DataMessageHandler callback,
-        Services::PubSub::IDataSubscriber* parent) -> Services::PubSub::DataSubscriberInternal*  = 0;
+        Services::PubSub::IDataSubscriber* parent, bool shareable) -> Services::PubSub::DataSubscriberInternal*  = 0;
 
     // Internal Rpc server that is only created on a matching rpc connection
     virtual auto CreateRpcServerInternal(const std::string& functionName, const std::string& linkName,
@@ -30,6 +30,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <cstring>
 #include <stdexcept>
 #include <map>
+#include <memory>
 
 #include "silkit/util/Span.hpp"
 
@@ -72,6 +73,9 @@ public:
     // Constructors and Destructor
     inline MessageBuffer() = default;
     inline MessageBuffer(std::vector<uint8_t> data);
+    //! Read-only view of [offset, offset + size) of a shared buffer, which is kept alive by the MessageBuffer.
+    //! The data is only copied if the MessageBuffer is written to or its storage is released.
+    inline MessageBuffer(std::shared_ptr<const std::vector<uint8_t>> sharedData, size_t offset, size_t size);
 
     MessageBuffer(const MessageBuffer& other) = default;
     MessageBuffer(MessageBuffer&& other) = default;
@@ -92,7 +96,7 @@ public:
 
     //! Set the format version to use for ser/des.
     inline void SetProtocolVersion(ProtocolVersion version);
-    inline auto GetProtocolVersion() -> ProtocolVersion;
+    inline auto GetProtocolVersion() const -> ProtocolVersion;
 
     inline void SetReadPos(size_t newReadPos);
 
@@ -103,6 +107,8 @@ public:
     //! \brief Return the underlying data storage by std::move and reset pointers
     inline auto ReleaseStorage() -> std::vector<uint8_t>;
     inline auto RemainingBytesLeft() const noexcept -> size_t;
+    //! Number of bytes written to the buffer
+    inline auto WritePos() const -> size_t;
 public:
     // ----------------------------------------
     // Elementary streaming operators
@@ -112,6 +118,7 @@ public:
     template<typename IntegerT, typename std::enable_if_t<std::is_integral<IntegerT>::value, int> = 0>
     inline MessageBuffer& operator<<(IntegerT t)
     {
+        DetachSharedData();
         if (_wPos + sizeof(IntegerT) > _storage.size())
         {
             _storage.resize(_storage.size() + sizeof(IntegerT));
@@ -125,10 +132,11 @@ public:
     template<typename IntegerT, typename std::enable_if_t<std::is_integral<IntegerT>::value, int> = 0>
     inline MessageBuffer& operator>>(IntegerT& t)
     {
-        if (_rPos + sizeof(IntegerT) > _storage.size())
+        const auto data = ReadData();
+        if (_rPos + sizeof(IntegerT) > data.size())
             throw end_of_buffer{};
 
-        std::memcpy(&t, _storage.data() + _rPos, sizeof(IntegerT));
+        std::memcpy(&t, data.data() + _rPos, sizeof(IntegerT));
         _rPos += sizeof(IntegerT);
 
         return *this;
@@ -141,6 +149,7 @@ public:
     {
         static_assert(std::numeric_limits<double>::is_iec559, "This compiler does not support IEEE 754 standard for floating points.");
 
+        DetachSharedData();
         if (_wPos + sizeof(DoubleT) > _storage.size())
         {
             _storage.resize(_storage.size() + sizeof(DoubleT));
@@ -156,10 +165,11 @@ public:
     {
         static_assert(std::numeric_limits<double>::is_iec559, "This compiler does not support IEEE 754 standard for floating points.");
 
-        if (_rPos + sizeof(DoubleT) > _storage.size())
+        const auto data = ReadData();
+        if (_rPos + sizeof(DoubleT) > data.size())
             throw end_of_buffer{};
 
-        std::memcpy(&t, _storage.data() + _rPos, sizeof(DoubleT));
+        std::memcpy(&t, data.data() + _rPos, sizeof(DoubleT));
         _rPos += sizeof(DoubleT);
 
         return *this;
@@ -250,13 +260,25 @@ public:
 public:
     void IncreaseCapacity(size_t capacity)
     {
+        DetachSharedData();
         _storage.reserve( _storage.size() + capacity);
     }
+private:
+    // ----------------------------------------
+    // private methods
+
+    //! The readable data, either the owned storage or the view of the shared data.
+    inline auto ReadData() const -> Util::Span<const uint8_t>;
+    //! Copy the view of the shared data into the owned storage, before modifying it.
+    inline void DetachSharedData();
+
 private:
     // ----------------------------------------
     // private members
     ProtocolVersion _protocolVersion{CurrentProtocolVersion()};
     std::vector<uint8_t> _storage;
+    std::shared_ptr<const std::vector<uint8_t>> _sharedData;
+    Util::Span<const uint8_t> _sharedDataView;
     std::size_t _wPos{0u};
     std::size_t _rPos{0u};
 };
@@ -271,8 +293,20 @@ MessageBuffer::MessageBuffer(std::vector<uint8_t> data)
 {
 }
 
+MessageBuffer::MessageBuffer(std::shared_ptr<const std::vector<uint8_t>> sharedData, size_t offset, size_t size)
+    : _sharedData{std::move(sharedData)}
+    , _wPos{size}
+    , _rPos{0u}
+{
+    if (_sharedData == nullptr || offset + size > _sharedData->size())
+        throw end_of_buffer{};
+
+    _sharedDataView = Util::Span<const uint8_t>{_sharedData->data() + offset, size};
+}
+
 auto MessageBuffer::ReleaseStorage() -> std::vector<uint8_t>
 {
+    DetachSharedData();
     _wPos = 0u;
     _rPos = 0u;
     return std::move(_storage);
@@ -280,7 +314,34 @@ auto MessageBuffer::ReleaseStorage() -> std::vector<uint8_t>
 
 inline auto MessageBuffer::RemainingBytesLeft() const noexcept -> size_t
 {
-    return (_rPos > _storage.size()) ? 0 : (_storage.size() - _rPos);
+    const auto size = ReadData().size();
+    return (_rPos > size) ? 0 : (size - _rPos);
+}
+
+inline auto MessageBuffer::WritePos() const -> size_t
+{
+    return _wPos;
+}
+
+auto MessageBuffer::ReadData() const -> Util::Span<const uint8_t>
+{
+    if (_sharedData != nullptr)
+    {
+        return _sharedDataView;
+    }
+    return _storage;
+}
+
+void MessageBuffer::DetachSharedData()
+{
+    if (_sharedData == nullptr)
+    {
+        return;
+    }
+
+    _storage.assign(_sharedDataView.begin(), _sharedDataView.end());
+    _sharedData.reset();
+    _sharedDataView = Util::Span<const uint8_t>{};
 }
 
 // --------------------------------------------------------------------------------
@@ -309,10 +370,11 @@ MessageBuffer& MessageBuffer::operator>>(std::string& str)
     uint32_t strLength{0u};
     *this >> strLength;
 
-    if (_rPos + strLength > _storage.size())
+    const auto data = ReadData();
+    if (_rPos + strLength > data.size())
         throw end_of_buffer{};
 
-    str = std::string(_storage.begin() + _rPos, _storage.begin() + _rPos + strLength);
+    str = std::string(data.begin() + _rPos, data.begin() + _rPos + strLength);
     _rPos += strLength;
 
     return *this;
@@ -330,10 +392,11 @@ MessageBuffer& MessageBuffer::operator>>(std::vector<uint8_t>& vector)
     uint32_t vectorSize{0u};
     *this >> vectorSize;
 
-    if (_rPos + vectorSize > _storage.size())
+    const auto data = ReadData();
+    if (_rPos + vectorSize > data.size())
         throw end_of_buffer{};
 
-    vector = std::vector<uint8_t>(_storage.begin() + _rPos, _storage.begin() + _rPos + vectorSize);
+    vector = std::vector<uint8_t>(data.begin() + _rPos, data.begin() + _rPos + vectorSize);
     _rPos += vectorSize;
 
     return *this;
@@ -364,7 +427,7 @@ MessageBuffer& MessageBuffer::operator>>(std::vector<ValueT>& vector)
     uint32_t vectorSize{0u};
     *this >> vectorSize;
 
-    if (_rPos + vectorSize > _storage.size())
+    if (_rPos + vectorSize > ReadData().size())
         throw end_of_buffer{};
 
     vector.resize(vectorSize);
@@ -451,6 +514,7 @@ MessageBuffer& MessageBuffer::operator<<(const std::array<uint8_t, SIZE>& array)
     if (array.size() > std::numeric_limits<uint32_t>::max())
         throw end_of_buffer{};
 
+    DetachSharedData();
     if (_wPos + array.size() > _storage.size())
     {
         _storage.resize(_wPos + array.size());
@@ -464,10 +528,11 @@ MessageBuffer& MessageBuffer::operator<<(const std::array<uint8_t, SIZE>& array)
 template<size_t SIZE>
 MessageBuffer& MessageBuffer::operator>>(std::array<uint8_t, SIZE>& array)
 {
-    if (_rPos + array.size() > _storage.size())
+    const auto data = ReadData();
+    if (_rPos + array.size() > data.size())
         throw end_of_buffer{};
 
-    std::copy(_storage.begin() + _rPos, _storage.begin() + _rPos + array.size(), array.begin());
+    std::copy(data.begin() + _rPos, data.begin() + _rPos + array.size(), array.begin());
     _rPos += array.size();
 
     return *this;
@@ -489,7 +554,7 @@ MessageBuffer& MessageBuffer::operator<<(const std::array<ValueT, SIZE>& array)
 template<typename ValueT, size_t SIZE>
 MessageBuffer& MessageBuffer::operator>>(std::array<ValueT, SIZE>& array)
 {
-    if (_rPos + array.size() > _storage.size())
+    if (_rPos + array.size() > ReadData().size())
         throw end_of_buffer{};
 
     for (auto&& value : array)
@@ -614,7 +679,7 @@ inline void MessageBuffer::SetProtocolVersion(ProtocolVersion version)
 {
     _protocolVersion = version;
 }
-inline auto MessageBuffer::GetProtocolVersion() -> ProtocolVersion
+inline auto MessageBuffer::GetProtocolVersion() const -> ProtocolVersion
 {
     return _protocolVersion;
 }
@@ -622,7 +687,7 @@ inline auto MessageBuffer::GetProtocolVersion() -> ProtocolVersion
 
 inline auto MessageBuffer::PeekData() const  -> SilKit::Util::Span<const uint8_t>
 {
-    return _storage;
+    return ReadData();
 }
 inline auto MessageBuffer::ReadPos() const -> size_t
 {
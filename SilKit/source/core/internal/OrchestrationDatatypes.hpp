@@ -23,6 +23,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include <chrono>
 #include <string>
+#include <vector>
 
 #include "silkit/services/orchestration/OrchestrationDatatypes.hpp"
 
@@ -38,6 +39,15 @@ struct NextSimTask
     std::chrono::nanoseconds duration{0};
 };
 
+//! Compact form of a ParticipantStatus update during the startup of a participant. The participant is identified by
+//! the sender of the message, the refresh time equals the enter time.
+struct CompactParticipantStatus
+{
+    ParticipantState state;
+    std::string enterReason;
+    std::chrono::system_clock::time_point enterTime;
+};
+
 //! System-wide command for the simulation flow.
 struct SystemCommand
 {
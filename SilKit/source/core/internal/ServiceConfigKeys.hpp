@@ -46,6 +46,8 @@ const std::string supplKeyDataPublisherTopic = "PubSub::topic";
 const std::string supplKeyDataPublisherPubUUID = "PubSub::pubUUID";
 const std::string supplKeyDataPublisherMediaType = "PubSub::pubMediaType";
 const std::string supplKeyDataPublisherPubLabels = "PubSub::pubLabels";
+const std::string supplKeyDataPublisherPubLabelsBinary = "PubSub::pubLabelsBin";
+const std::string supplKeyDataPublisherHistory = "PubSub::pubHistory";
 
 const std::string controllerTypeDataSubscriber = "DataSubscriber";
 const std::string supplKeyDataSubscriberTopic = "PubSub::topic";
@@ -53,6 +55,9 @@ const std::string supplKeyDataSubscriberMediaType = "PubSub::subMediaType";
 const std::string supplKeyDataSubscriberSubLabels = "PubSub::subLabels";
 const std::string controllerTypeDataSubscriberInternal = "DataSubscriberInternal";
 const std::string supplKeyDataSubscriberInternalParentServiceID = "PubSub::subIntParentServiceId";
+const std::string supplKeyDataSubscriberInternalContentFilter = "PubSub::subIntContentFilter";
+const std::string supplKeyDataSubscriberInternalDeliveryMode = "PubSub::subIntDeliveryMode";
+const std::string supplValueDataSubscriberInternalDeliveryModeLatestValue = "LatestValue";
 
 // RPC types
 const std::string controllerTypeRpcServer = "RpcServer";
@@ -64,6 +69,7 @@ const std::string controllerTypeRpcClient = "RpcClient";
 const std::string supplKeyRpcClientFunctionName = "Rpc::client::functionName";
 const std::string supplKeyRpcClientMediaType = "Rpc::client::mediaType";
 const std::string supplKeyRpcClientLabels = "Rpc::client::labels";
+const std::string supplKeyRpcClientLabelsBinary = "Rpc::client::labelsBin";
 const std::string supplKeyRpcClientUUID = "Rpc::client::UUID";
 
 const std::string controllerTypeRpcServerInternal = "RpcServerInternal";
@@ -86,6 +92,8 @@ const std::string controllerTypeOther = "Other";
 // Lifecycle & TimeSync
 const std::string lifecycleIsCoordinated = "LifecycleIsCoordinated";
 const std::string timeSyncActive = "TimeSyncActive";
+const std::string timeSyncLookahead = "TimeSyncLookahead";
+const std::string timeSyncCoordinator = "TimeSyncCoordinator";
 
 } // namespace Discovery
 } // namespace Core
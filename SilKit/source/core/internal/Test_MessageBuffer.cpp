@@ -236,3 +236,38 @@ TEST(Test_MessageBuffer, mixed_types)
 
     EXPECT_EQ(in, out);
 }
+
+TEST(Test_MessageBuffer, shared_data_view)
+{
+    SilKit::Core::MessageBuffer writer;
+    writer << uint32_t{0xdeadbeef} << std::string{"borrowed"};
+    auto blob = writer.ReleaseStorage();
+
+    // surround the serialized data with unrelated bytes, only the view must be readable
+    std::vector<uint8_t> data(3, 0xff);
+    data.insert(data.end(), blob.begin(), blob.end());
+    data.insert(data.end(), 5, 0xff);
+    auto sharedData = std::make_shared<const std::vector<uint8_t>>(std::move(data));
+
+    SilKit::Core::MessageBuffer buffer{sharedData, 3, blob.size()};
+    EXPECT_EQ(buffer.PeekData().data(), sharedData->data() + 3);
+    EXPECT_EQ(buffer.RemainingBytesLeft(), blob.size());
+
+    uint32_t number{0};
+    std::string str;
+    buffer >> number >> str;
+    EXPECT_EQ(number, 0xdeadbeef);
+    EXPECT_EQ(str, "borrowed");
+    EXPECT_EQ(buffer.RemainingBytesLeft(), 0u);
+    EXPECT_THROW(buffer >> number, SilKit::Core::end_of_buffer);
+
+    // writing copies the view into the owned storage
+    buffer << uint8_t{7};
+    EXPECT_NE(buffer.PeekData().data(), sharedData->data() + 3);
+    auto storage = buffer.ReleaseStorage();
+    ASSERT_EQ(storage.size(), blob.size() + 1);
+    EXPECT_TRUE(std::equal(blob.begin(), blob.end(), storage.begin()));
+    EXPECT_EQ(storage.back(), 7);
+
+    EXPECT_THROW((SilKit::Core::MessageBuffer{sharedData, 4, sharedData->size()}), SilKit::Core::end_of_buffer);
+}
@@ -0,0 +1,232 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+namespace SilKit {
+namespace Core {
+
+//! Fill level and overflow counters of the send queue of a peer
+struct SendQueueStatus
+{
+    size_t queuedMessages{0}; //!< Number of messages waiting to be written
+    size_t queuedBytes{0}; //!< Number of bytes waiting to be written
+    size_t maxQueuedBytes{0}; //!< Highest number of queued bytes observed so far
+    uint64_t droppedMessages{0}; //!< Number of bus frames dropped by the DropOldest policy
+    uint64_t rejectedMessages{0}; //!< Number of bus frames rejected by the Error policy
+    uint64_t blockedSends{0}; //!< Number of sends which were blocked by the Block policy
+    uint64_t conflatedMessages{0}; //!< Number of queued messages replaced by newer ones for latest-value subscribers
+};
+
+//! Counters of a BufferPool, e.g., to verify that sending does not allocate in the steady state.
+struct BufferPoolStatistics
+{
+    uint64_t acquired{0}; //!< Number of acquired buffers
+    uint64_t allocated{0}; //!< Number of acquired buffers which had to be allocated, because the pool was empty
+    uint64_t released{0}; //!< Number of buffers returned to the pool
+    uint64_t discarded{0}; //!< Number of returned buffers which were freed, because they did not fit into the pool
+};
+
+//! Distribution of measured durations in buckets of powers of two nanoseconds
+struct DurationHistogram
+{
+    static constexpr size_t NumBuckets{40};
+
+    uint64_t count{0}; //!< Number of measured durations
+    std::chrono::nanoseconds total{0}; //!< Sum of all measured durations
+    std::chrono::nanoseconds min{0};
+    std::chrono::nanoseconds max{0};
+    //! Bucket i counts the durations of [2^(i-1), 2^i) ns, bucket 0 the durations of 0 ns. The last bucket also
+    //! counts all longer durations.
+    std::array<uint64_t, NumBuckets> buckets{};
+
+    inline auto Mean() const -> std::chrono::nanoseconds;
+    //! Upper bound of the bucket containing the given percentile (0 to 100), at most the maximum duration
+    inline auto Percentile(double percentile) const -> std::chrono::nanoseconds;
+};
+
+//! Traffic of the connection to another participant
+struct PeerMetrics
+{
+    uint64_t messagesSent{0}; //!< Number of messages written to the socket
+    uint64_t bytesSent{0};
+    uint64_t messagesReceived{0}; //!< Number of messages read from the socket
+    uint64_t bytesReceived{0};
+    SendQueueStatus sendQueue;
+    //! Time from queueing a message for the peer until it was written to the socket
+    DurationHistogram sendLatency;
+};
+
+//! Traffic of a link, i.e., the messages of one type on one network
+struct LinkMetrics
+{
+    uint64_t messagesSent{0}; //!< Number of messages sent by local services
+    uint64_t messagesReceived{0}; //!< Number of messages received from other participants
+    //! Time to serialize a sent message and queue it for all remote receivers
+    DurationHistogram serializationTime;
+    //! Time to deserialize a received message
+    DurationHistogram deserializationTime;
+    //! Time to deliver a received message to all local receivers, which includes the user callbacks
+    DurationHistogram callbackTime;
+};
+
+//! Snapshot of the transport metrics of a participant, which are collected if enabled in the middleware configuration
+struct TransportMetrics
+{
+    //! Time since collecting the metrics started
+    std::chrono::nanoseconds elapsed{0};
+    //! Time the I/O thread spent sending and processing messages
+    std::chrono::nanoseconds ioBusyTime{0};
+    //! Time from sending a message until the I/O thread picks it up
+    DurationHistogram sendDispatchDelay;
+    //! Per participant name
+    std::map<std::string, PeerMetrics> peers;
+    //! Per link, named 'MessageType[network]'
+    std::map<std::string, LinkMetrics> links;
+    BufferPoolStatistics bufferPool;
+
+    inline auto IoBusyRatio() const -> double;
+};
+
+inline std::string to_string(const DurationHistogram& histogram);
+inline std::string to_string(const TransportMetrics& metrics);
+
+inline std::ostream& operator<<(std::ostream& out, const DurationHistogram& histogram);
+inline std::ostream& operator<<(std::ostream& out, const TransportMetrics& metrics);
+
+// ================================================================================
+//  Inline Implementations
+// ================================================================================
+
+auto DurationHistogram::Mean() const -> std::chrono::nanoseconds
+{
+    if (count == 0)
+    {
+        return std::chrono::nanoseconds{0};
+    }
+    return total / count;
+}
+
+auto DurationHistogram::Percentile(double percentile) const -> std::chrono::nanoseconds
+{
+    const auto rank = static_cast<uint64_t>(static_cast<double>(count) * percentile / 100.0 + 0.5);
+
+    uint64_t accumulated{0};
+    for (size_t index = 0; index != NumBuckets; ++index)
+    {
+        accumulated += buckets[index];
+        if (accumulated != 0 && accumulated >= rank && index != NumBuckets - 1)
+        {
+            const auto upperBound = std::chrono::nanoseconds{(int64_t{1} << index) - 1};
+            return (std::min)(upperBound, max);
+        }
+    }
+    return max;
+}
+
+auto TransportMetrics::IoBusyRatio() const -> double
+{
+    if (elapsed.count() <= 0)
+    {
+        return 0.0;
+    }
+    return static_cast<double>(ioBusyTime.count()) / static_cast<double>(elapsed.count());
+}
+
+std::string to_string(const DurationHistogram& histogram)
+{
+    std::stringstream outStream;
+    outStream << histogram;
+    return outStream.str();
+}
+
+std::string to_string(const TransportMetrics& metrics)
+{
+    std::stringstream outStream;
+    outStream << metrics;
+    return outStream.str();
+}
+
+std::ostream& operator<<(std::ostream& out, const DurationHistogram& histogram)
+{
+    const auto toMicroseconds = [](std::chrono::nanoseconds duration) {
+        return std::chrono::duration<double, std::micro>{duration}.count();
+    };
+
+    const auto flags = out.flags();
+    out << std::fixed << std::setprecision(1) << "n=" << histogram.count
+        << " mean=" << toMicroseconds(histogram.Mean()) << "us"
+        << " p50=" << toMicroseconds(histogram.Percentile(50)) << "us"
+        << " p99=" << toMicroseconds(histogram.Percentile(99)) << "us"
+        << " max=" << toMicroseconds(histogram.max) << "us";
+    out.flags(flags);
+    return out;
+}
+
+std::ostream& operator<<(std::ostream& out, const TransportMetrics& metrics)
+{
+    const auto flags = out.flags();
+    out << std::fixed << std::setprecision(1) << "TransportMetrics{elapsed="
+        << std::chrono::duration<double>{metrics.elapsed}.count() << "s"
+        << ", ioBusy=" << 100.0 * metrics.IoBusyRatio() << "%"
+        << ", sendDispatchDelay={" << metrics.sendDispatchDelay << "}"
+        << ", bufferPool={acquired=" << metrics.bufferPool.acquired
+        << " allocated=" << metrics.bufferPool.allocated << "}";
+    out.flags(flags);
+
+    for (const auto& kv : metrics.peers)
+    {
+        const auto& peer = kv.second;
+        out << "\n  peer '" << kv.first << "': sent=" << peer.messagesSent << " (" << peer.bytesSent << " B)"
+            << " received=" << peer.messagesReceived << " (" << peer.bytesReceived << " B)"
+            << " queued=" << peer.sendQueue.queuedMessages << " (" << peer.sendQueue.queuedBytes << " B, max "
+            << peer.sendQueue.maxQueuedBytes << " B)"
+            << " dropped=" << peer.sendQueue.droppedMessages << " rejected=" << peer.sendQueue.rejectedMessages
+            << " blocked=" << peer.sendQueue.blockedSends << " conflated=" << peer.sendQueue.conflatedMessages
+            << " sendLatency={" << peer.sendLatency << "}";
+    }
+
+    for (const auto& kv : metrics.links)
+    {
+        const auto& link = kv.second;
+        out << "\n  link " << kv.first << ": sent=" << link.messagesSent << " received=" << link.messagesReceived
+            << " serialization={" << link.serializationTime << "}"
+            << " deserialization={" << link.deserializationTime << "}"
+            << " callbacks={" << link.callbackTime << "}";
+    }
+
+    out << "}";
+    return out;
+}
+
+} // namespace Core
+} // namespace SilKit
@@ -30,10 +30,12 @@ namespace Services {
 namespace Orchestration {
 
 inline std::string to_string(const NextSimTask& nextTask);
+inline std::string to_string(const CompactParticipantStatus& compactStatus);
 inline std::string to_string(SystemCommand::Kind command);
 inline std::string to_string(const SystemCommand& command);
 
 inline std::ostream& operator<<(std::ostream& out, const NextSimTask& nextTask);
+inline std::ostream& operator<<(std::ostream& out, const CompactParticipantStatus& compactStatus);
 inline std::ostream& operator<<(std::ostream& out, SystemCommand::Kind command);
 inline std::ostream& operator<<(std::ostream& out, const SystemCommand& command);
 
@@ -58,6 +60,20 @@ std::ostream& operator<<(std::ostream& out, const NextSimTask& nextTask)
     return out;
 }
 
+std::string to_string(const CompactParticipantStatus& compactStatus)
+{
+    std::stringstream outStream;
+    outStream << compactStatus;
+    return outStream.str();
+}
+
+std::ostream& operator<<(std::ostream& out, const CompactParticipantStatus& compactStatus)
+{
+    out << "Orchestration::CompactParticipantStatus{state=" << compactStatus.state << ", enterReason=\"" << compactStatus.enterReason
+        << "\"}";
+    return out;
+}
+
 std::string to_string(SystemCommand::Kind command)
 {
     switch (command)
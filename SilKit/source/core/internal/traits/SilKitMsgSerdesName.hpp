@@ -42,6 +42,7 @@ DefineSilKitMsgTrait_SerdesName(SilKit::Services::Orchestration::SystemCommand,
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Orchestration::ParticipantStatus, "PARTICIPANTSTATUS" );
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Orchestration::WorkflowConfiguration, "WORKFLOWCONFIGURATION" );
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Orchestration::NextSimTask, "NEXTSIMTASK" );
+DefineSilKitMsgTrait_SerdesName(SilKit::Services::Orchestration::CompactParticipantStatus, "COMPACTPARTICIPANTSTATUS" );
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::PubSub::WireDataMessageEvent, "DATAMESSAGEEVENT" );
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Rpc::FunctionCall, "FUNCTIONCALL" );
 DefineSilKitMsgTrait_SerdesName(SilKit::Services::Rpc::FunctionCallResponse, "FUNCTIONCALLRESPONSE" );
@@ -50,6 +50,7 @@ template <class MsgT> struct SilKitMsgTraitTypeName { static constexpr const cha
 template <class MsgT> struct SilKitMsgTraitHistSize { static constexpr std::size_t HistSize() { return 0; } };
 template <class MsgT> struct SilKitMsgTraitEnforceSelfDelivery { static constexpr bool IsSelfDeliveryEnforced() { return false; } };
 template <class MsgT> struct SilKitMsgTraitForbidSelfDelivery { static constexpr bool IsSelfDeliveryForbidden() { return false; } };
+template <class MsgT> struct SilKitMsgTraitDroppable { static constexpr bool IsDroppable() { return false; } };
 
 // The final message traits
 template <class MsgT> struct SilKitMsgTraits
@@ -59,6 +60,7 @@ template <class MsgT> struct SilKitMsgTraits
     , SilKitMsgTraitVersion<MsgT>
     , SilKitMsgTraitSerdesName<MsgT>
     , SilKitMsgTraitForbidSelfDelivery<MsgT>
+    , SilKitMsgTraitDroppable<MsgT>
 {
 };
 
@@ -74,12 +76,16 @@ template <class MsgT> struct SilKitMsgTraits
 #define DefineSilKitMsgTrait_ForbidSelfDelivery(Namespace, MsgName) template<> struct SilKitMsgTraitForbidSelfDelivery<Namespace::MsgName>{\
     static constexpr bool IsSelfDeliveryForbidden() { return true; }\
     };
+#define DefineSilKitMsgTrait_Droppable(Namespace, MsgName) template<> struct SilKitMsgTraitDroppable<Namespace::MsgName>{\
+    static constexpr bool IsDroppable() { return true; }\
+    };
 
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Logging, LogMsg)
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Orchestration, SystemCommand)
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Orchestration, ParticipantStatus)
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Orchestration, WorkflowConfiguration)
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Orchestration, NextSimTask)
+DefineSilKitMsgTrait_TypeName(SilKit::Services::Orchestration, CompactParticipantStatus)
 DefineSilKitMsgTrait_TypeName(SilKit::Services::PubSub, WireDataMessageEvent)
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Rpc, FunctionCall)
 DefineSilKitMsgTrait_TypeName(SilKit::Services::Rpc, FunctionCallResponse)
@@ -116,6 +122,7 @@ DefineSilKitMsgTrait_TypeName(SilKit::Core::RequestReply, RequestReplyCallReturn
 
 // Messages with history
 DefineSilKitMsgTrait_HistSize(SilKit::Services::Orchestration, ParticipantStatus, 1)
+DefineSilKitMsgTrait_HistSize(SilKit::Services::Orchestration, CompactParticipantStatus, 1)
 DefineSilKitMsgTrait_HistSize(SilKit::Core::Discovery, ParticipantDiscoveryEvent, 1)
 DefineSilKitMsgTrait_HistSize(SilKit::Services::PubSub, WireDataMessageEvent, 1)
 DefineSilKitMsgTrait_HistSize(SilKit::Services::Orchestration, WorkflowConfiguration, 1)
@@ -123,10 +130,16 @@ DefineSilKitMsgTrait_HistSize(SilKit::Services::Lin, WireLinControllerConfig, 1)
 
 // Messages with enforced self delivery
 DefineSilKitMsgTrait_EnforceSelfDelivery(SilKit::Services::Orchestration, ParticipantStatus)
+DefineSilKitMsgTrait_EnforceSelfDelivery(SilKit::Services::Orchestration, CompactParticipantStatus)
 DefineSilKitMsgTrait_EnforceSelfDelivery(SilKit::Services::Lin, LinSendFrameHeaderRequest)
 
 // Messages with forbidden self delivery
 DefineSilKitMsgTrait_ForbidSelfDelivery(SilKit::Services::Orchestration, SystemCommand)
 
+// History-less bus frames, which may be dropped from an overflowing send queue
+DefineSilKitMsgTrait_Droppable(SilKit::Services::Can, WireCanFrameEvent)
+DefineSilKitMsgTrait_Droppable(SilKit::Services::Ethernet, WireEthernetFrameEvent)
+DefineSilKitMsgTrait_Droppable(SilKit::Services::Flexray, WireFlexrayFrameEvent)
+
 } // namespace Core
 } // namespace SilKit
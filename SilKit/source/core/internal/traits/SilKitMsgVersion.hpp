@@ -41,6 +41,7 @@ DefineSilKitMsgTrait_Version(SilKit::Services::Orchestration::SystemCommand, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Orchestration::ParticipantStatus, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Orchestration::WorkflowConfiguration, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Orchestration::NextSimTask, 1);
+DefineSilKitMsgTrait_Version(SilKit::Services::Orchestration::CompactParticipantStatus, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::PubSub::WireDataMessageEvent, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Rpc::FunctionCall, 1);
 DefineSilKitMsgTrait_Version(SilKit::Services::Rpc::FunctionCallResponse, 1);
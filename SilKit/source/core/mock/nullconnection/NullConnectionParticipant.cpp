@@ -50,6 +50,13 @@ struct NullConnection
     template <class SilKitServiceT>
     inline void SetHistoryLengthForLink(size_t /*history*/, SilKitServiceT* /*service*/) {}
 
+    template <class SilKitServiceT>
+    inline void SetRemoteSubscriptionForLink(SilKitServiceT* /*service*/, const std::string& /*participantName*/,
+                                             Core::EndpointId /*subscriberId*/,
+                                             std::shared_ptr<const Core::RemoteSubscription> /*subscription*/)
+    {
+    }
+
     template<typename SilKitMessageT>
     void SendMsg(const Core::IServiceEndpoint* /*from*/, SilKitMessageT&& /*msg*/) {}
 
@@ -59,6 +66,9 @@ struct NullConnection
     void OnAllMessagesDelivered(std::function<void()> /*callback*/) {}
     void FlushSendBuffers() {}
     void ExecuteDeferred(std::function<void()> /*callback*/) {}
+    void ExecuteDeferredAt(std::chrono::steady_clock::time_point /*deadline*/, std::function<void()> /*callback*/) {}
+    auto GetTransportMetrics() -> TransportMetrics { return {}; }
+    auto GetSendQueueStatus() -> std::map<std::string, SendQueueStatus> { return {}; }
     void NotifyShutdown() {}
 
     void RegisterMessageReceiver(std::function<void(IVAsioPeer* /*peer*/, ParticipantAnnouncement)> /*callback*/) {}
@@ -22,6 +22,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 #include <chrono>
+#include <functional>
+#include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -131,6 +134,12 @@ public:
 class MockServiceDiscovery : public Discovery::IServiceDiscovery
 {
 public:
+    MockServiceDiscovery()
+    {
+        ON_CALL(*this, GetServiceLabels(testing::_))
+            .WillByDefault(testing::Return(std::make_shared<const Util::CompiledLabels>()));
+    }
+
     MOCK_METHOD(void, NotifyServiceCreated, (const ServiceDescriptor& serviceDescriptor), (override));
     MOCK_METHOD(void, NotifyServiceRemoved, (const ServiceDescriptor& serviceDescriptor), (override));
     MOCK_METHOD(void, RegisterServiceDiscoveryHandler, (SilKit::Core::Discovery::ServiceDiscoveryHandler handler), (override));
@@ -140,7 +149,8 @@ public:
                 (override));
     MOCK_METHOD(std::vector<ServiceDescriptor>, GetServices, (), (const, override));
     MOCK_METHOD(void, OnParticpantRemoval, (const std::string& participantName), (override));
-
+    MOCK_METHOD(std::shared_ptr<const Util::CompiledLabels>, GetServiceLabels,
+                (const ServiceDescriptor& serviceDescriptor), (const, override));
 };
 
 class MockRequestReplyService : public RequestReply::IRequestReplyService
@@ -213,7 +223,7 @@ public:
                                       const std::string& /*mediaType*/,
                                       const std::vector<SilKit::Services::MatchingLabel>& /*publisherLabels*/,
                                       Services::PubSub::DataMessageHandler /*callback*/,
-                                      Services::PubSub::IDataSubscriber* /*parent*/)
+                                      Services::PubSub::IDataSubscriber* /*parent*/, bool /*shareable*/)
         -> Services::PubSub::DataSubscriberInternal* override
     {
         return nullptr;
@@ -296,6 +306,7 @@ public:
 
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::Orchestration::NextSimTask& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::Orchestration::ParticipantStatus& /*msg*/)  override{}
+    void SendMsg(const IServiceEndpoint* /*from*/, const Services::Orchestration::CompactParticipantStatus& /*msg*/)  override{}
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::Orchestration::SystemCommand& /*msg*/)  override{}
     void SendMsg(const IServiceEndpoint* /*from*/, const Services::Orchestration::WorkflowConfiguration& /*msg*/)  override{}
 
@@ -349,6 +360,7 @@ public:
 
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, const Services::Orchestration::NextSimTask& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, const Services::Orchestration::ParticipantStatus& /*msg*/) override {}
+    void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, const Services::Orchestration::CompactParticipantStatus& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, const Services::Orchestration::SystemCommand& /*msg*/) override {}
     void SendMsg(const IServiceEndpoint* /*from*/, const std::string& /*targetParticipantName*/, const Services::Orchestration::WorkflowConfiguration& /*msg*/) override {}
 
@@ -368,6 +380,13 @@ public:
     {
         callback();
     }
+    //! The callbacks are kept until the test executes them, regardless of their deadline
+    void ExecuteDeferredAt(std::chrono::steady_clock::time_point deadline, std::function<void()> callback) override
+    {
+        deferredAtCallbacks.emplace_back(deadline, std::move(callback));
+    }
+    auto GetTransportMetrics() -> TransportMetrics override { return {}; }
+    auto GetSendQueueStatus() -> std::map<std::string, SendQueueStatus> override { return {}; }
 
     auto GetParticipantName() const -> const std::string& override { return _name; }
     auto GetRegistryUri() const -> const std::string& override { return _registryUri; }
@@ -414,6 +433,7 @@ public:
     testing::NiceMock<MockServiceDiscovery> mockServiceDiscovery;
     MockRequestReplyService mockRequestReplyService;
     MockParticipantReplies mockParticipantReplies;
+    std::vector<std::pair<std::chrono::steady_clock::time_point, std::function<void()>>> deferredAtCallbacks;
 };
 
 // ================================================================================
@@ -27,6 +27,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <vector>
 #include <unordered_map>
 #include <map>
+#include <mutex>
 #include <tuple>
 
 #include "silkit/services/all.hpp"
@@ -133,7 +134,8 @@ public:
     auto CreateDataSubscriberInternal(const std::string& canonicalName, const std::string& linkName,
                                       const std::string& mediaType,
                                       const std::vector<SilKit::Services::MatchingLabel>& publisherLabels,
-                                      Services::PubSub::DataMessageHandler callback, Services::PubSub::IDataSubscriber* parent)
+                                      Services::PubSub::DataMessageHandler callback, Services::PubSub::IDataSubscriber* parent,
+                                      bool shareable)
         -> Services::PubSub::DataSubscriberInternal* override;
 
     auto CreateRpcClient(const std::string& canonicalName, const SilKit::Services::Rpc::RpcSpec& dataSpec, Services::Rpc::RpcCallResultHandler handler)
@@ -197,6 +199,7 @@ public:
 
     void SendMsg(const IServiceEndpoint*, const Services::Orchestration::NextSimTask& msg) override;
     void SendMsg(const IServiceEndpoint*, const Services::Orchestration::ParticipantStatus& msg) override;
+    void SendMsg(const IServiceEndpoint*, const Services::Orchestration::CompactParticipantStatus& msg) override;
     void SendMsg(const IServiceEndpoint*, const Services::Orchestration::SystemCommand& msg) override;
     void SendMsg(const IServiceEndpoint*, const Services::Orchestration::WorkflowConfiguration& msg) override;
 
@@ -248,6 +251,7 @@ public:
 
     void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName, const Services::Orchestration::NextSimTask& msg) override;
     void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName, const Services::Orchestration::ParticipantStatus& msg) override;
+    void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName, const Services::Orchestration::CompactParticipantStatus& msg) override;
     void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName, const Services::Orchestration::SystemCommand& msg) override;
     void SendMsg(const IServiceEndpoint*, const std::string& targetParticipantName, const Services::Orchestration::WorkflowConfiguration& msg) override;
 
@@ -270,6 +274,9 @@ public:
     void OnAllMessagesDelivered(std::function<void()> callback) override;
     void FlushSendBuffers() override;
     void ExecuteDeferred(std::function<void()> callback) override;
+    void ExecuteDeferredAt(std::chrono::steady_clock::time_point deadline, std::function<void()> callback) override;
+    auto GetTransportMetrics() -> TransportMetrics override;
+    auto GetSendQueueStatus() -> std::map<std::string, SendQueueStatus> override;
 
     void SetAsyncSubscriptionsCompletionHandler(std::function<void()> handler) override;
 
@@ -403,6 +410,10 @@ private:
 
     SilKitConnectionT _connection;
 
+    // With topic multiplexing, the internal subscribers shared by the DataSubscribers, by the network of the publisher
+    std::recursive_mutex _sharedDataSubscriberInternalsMx;
+    std::unordered_map<std::string, Services::PubSub::DataSubscriberInternal*> _sharedDataSubscriberInternals;
+
     // control variables to prevent multiple create accesses by public API 
     std::atomic<bool> _isSystemMonitorCreated{false};
     std::atomic<bool> _isSystemControllerCreated{false};
@@ -46,6 +46,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "RequestReplyService.hpp"
 #include "ParticipantConfiguration.hpp"
 #include "YamlParser.hpp"
+#include "LabelMatching.hpp"
+#include "ContentFilter.hpp"
 
 #include "tuple_tools/bind.hpp"
 #include "tuple_tools/for_each.hpp"
@@ -371,23 +373,106 @@ auto Participant<SilKitConnectionT>::CreateLinController(const std::string& cano
     return controller;
 }
 
+static inline auto MakeContentFilter(const std::vector<SilKit::Config::DataContentPredicate>& predicates)
+    -> Util::ContentFilter
+{
+    Util::ContentFilter filter;
+    for (const auto& predicate : predicates)
+    {
+        filter.push_back(Util::ContentPredicate{predicate.offset, predicate.value, predicate.mask});
+    }
+    return filter;
+}
+
+static inline auto DecodeRemoteSubscription(const Core::ServiceDescriptor& serviceDescriptor,
+                                            Logging::ILogger* logger) -> Core::RemoteSubscription
+{
+    Core::RemoteSubscription subscription;
+
+    std::string deliveryMode;
+    if (serviceDescriptor.GetSupplementalDataItem(Core::Discovery::supplKeyDataSubscriberInternalDeliveryMode,
+                                                  deliveryMode))
+    {
+        subscription.latestValueOnly =
+            deliveryMode == Core::Discovery::supplValueDataSubscriberInternalDeliveryModeLatestValue;
+    }
+
+    std::string encodedFilter;
+    if (!serviceDescriptor.GetSupplementalDataItem(Core::Discovery::supplKeyDataSubscriberInternalContentFilter,
+                                                   encodedFilter))
+    {
+        return subscription;
+    }
+
+    try
+    {
+        subscription.contentFilter = Util::DecodeContentFilter(encodedFilter);
+    }
+    catch (const SilKitError& error)
+    {
+        // Sending all data is always correct, the subscriber filters it again
+        Logging::Warn(logger, "Ignoring the content filter of {}: {}", serviceDescriptor.to_string(), error.what());
+    }
+    return subscription;
+}
+
 template <class SilKitConnectionT>
 auto Participant<SilKitConnectionT>::CreateDataSubscriberInternal(const std::string& topic, const std::string& linkName,
                                                              const std::string& mediaType,
                                                              const std::vector<SilKit::Services::MatchingLabel>& publisherLabels,
                                                              Services::PubSub::DataMessageHandler defaultHandler,
-                                                             Services::PubSub::IDataSubscriber* parent)
+                                                             Services::PubSub::IDataSubscriber* parent,
+                                                             bool shareable)
     -> Services::PubSub::DataSubscriberInternal*
 {
+    auto parentDataSubscriber = dynamic_cast<Services::PubSub::DataSubscriber*>(parent);
+
+    // The content filter of the DataSubscriber is announced to the publisher, which only sends the matching data
+    auto contentFilter =
+        parentDataSubscriber ? MakeContentFilter(parentDataSubscriber->GetConfig().contentFilter) : Util::ContentFilter{};
+    // The publisher only keeps the latest of its queued messages for latest-value subscribers
+    const bool latestValueOnly = parentDataSubscriber
+                                 && parentDataSubscriber->GetConfig().deliveryMode
+                                        == Config::DataSubscriber::DeliveryMode::LatestValue;
+
+    // With topic multiplexing, the DataSubscribers matching the same publisher share one internal subscriber, i.e.,
+    // one service and link per publisher and participant. Replaying, filtering and latest-value subscribers keep their
+    // own.
+    const bool shareInternalSubscriber =
+        shareable && _participantConfig.middleware.enableTopicMultiplexing && parentDataSubscriber
+        && !Tracing::IsReplayEnabledFor(parentDataSubscriber->GetConfig().replay, Config::Replay::Direction::Receive)
+        && contentFilter.empty() && !latestValueOnly;
+
+    std::unique_lock<decltype(_sharedDataSubscriberInternalsMx)> lock{_sharedDataSubscriberInternalsMx,
+                                                                      std::defer_lock};
+    if (shareInternalSubscriber)
+    {
+        lock.lock();
+        auto sharedIt = _sharedDataSubscriberInternals.find(linkName);
+        if (sharedIt != _sharedDataSubscriberInternals.end() && sharedIt->second->AddSubscriber(parent, defaultHandler))
+        {
+            return sharedIt->second;
+        }
+    }
+
     Core::SupplementalData supplementalData;
     supplementalData[SilKit::Core::Discovery::controllerType] =
         SilKit::Core::Discovery::controllerTypeDataSubscriberInternal;
-    auto parentDataSubscriber = dynamic_cast<Services::PubSub::DataSubscriber*>(parent);
     if (parentDataSubscriber)
     {
         supplementalData[SilKit::Core::Discovery::supplKeyDataSubscriberInternalParentServiceID] =
             std::to_string(parentDataSubscriber->GetServiceDescriptor().GetServiceId());
     }
+    if (!contentFilter.empty())
+    {
+        supplementalData[SilKit::Core::Discovery::supplKeyDataSubscriberInternalContentFilter] =
+            Util::EncodeContentFilter(contentFilter);
+    }
+    if (latestValueOnly)
+    {
+        supplementalData[SilKit::Core::Discovery::supplKeyDataSubscriberInternalDeliveryMode] =
+            SilKit::Core::Discovery::supplValueDataSubscriberInternalDeliveryModeLatestValue;
+    }
     SilKit::Config::DataSubscriber controllerConfig;
 
     // Use a unique name to avoid collisions of several subscribers on same topic on one participant
@@ -396,7 +481,12 @@ auto Participant<SilKitConnectionT>::CreateDataSubscriberInternal(const std::str
 
     auto controller = CreateController<PubSub::DataSubscriberInternal>(
         controllerConfig, network, std::move(supplementalData), true, &_timeProvider,
-        topic, mediaType, publisherLabels, defaultHandler, parent);
+        topic, mediaType, publisherLabels, defaultHandler, parent, std::move(contentFilter));
+
+    if (shareInternalSubscriber)
+    {
+        _sharedDataSubscriberInternals[linkName] = controller;
+    }
 
     //Restore original DataSubscriber config for replay
     auto&& parentConfig = parentDataSubscriber->GetConfig();
@@ -477,6 +567,8 @@ auto Participant<SilKitConnectionT>::CreateDataPublisher(const std::string& cano
     supplementalData[SilKit::Core::Discovery::supplKeyDataPublisherMediaType] = configuredDataNodeSpec.MediaType();
     auto labelStr = SilKit::Config::Serialize<std::decay_t<decltype(labels)>>(labels);
     supplementalData[SilKit::Core::Discovery::supplKeyDataPublisherPubLabels] = labelStr;
+    supplementalData[SilKit::Core::Discovery::supplKeyDataPublisherPubLabelsBinary] = Util::EncodeLabels(labels);
+    supplementalData[SilKit::Core::Discovery::supplKeyDataPublisherHistory] = std::to_string(history);
 
     auto controller = CreateController<Services::PubSub::DataPublisher>(
         controllerConfig,
@@ -490,6 +582,22 @@ auto Participant<SilKitConnectionT>::CreateDataPublisher(const std::string& cano
 
     _connection.SetHistoryLengthForLink(history, controller);
 
+    // Only send data to the participants of the subscribers matching their content filters, and only the latest
+    // queued data to latest-value subscribers
+    GetServiceDiscovery()->RegisterSpecificServiceDiscoveryHandler(
+        [this, controller](Core::Discovery::ServiceDiscoveryEvent::Type discoveryType,
+                           const Core::ServiceDescriptor& serviceDescriptor) {
+            std::shared_ptr<const Core::RemoteSubscription> subscription;
+            if (discoveryType == Core::Discovery::ServiceDiscoveryEvent::Type::ServiceCreated)
+            {
+                subscription = std::make_shared<const Core::RemoteSubscription>(
+                    DecodeRemoteSubscription(serviceDescriptor, GetLogger()));
+            }
+            _connection.SetRemoteSubscriptionForLink(controller, serviceDescriptor.GetParticipantName(),
+                                                     serviceDescriptor.GetServiceId(), std::move(subscription));
+        },
+        Core::Discovery::controllerTypeDataSubscriberInternal, network, {});
+
     if (GetLogger()->GetLogLevel() <= Logging::Level::Trace)
     {
         Logging::Trace(
@@ -619,6 +727,7 @@ auto Participant<SilKitConnectionT>::CreateRpcClient(const std::string& canonica
     const auto& labels = dataSpec.Labels();
     auto labelStr = SilKit::Config::Serialize<std::decay_t<decltype(labels)>>(labels);
     supplementalData[SilKit::Core::Discovery::supplKeyRpcClientLabels] = labelStr;
+    supplementalData[SilKit::Core::Discovery::supplKeyRpcClientLabelsBinary] = Util::EncodeLabels(labels);
     supplementalData[SilKit::Core::Discovery::supplKeyRpcClientUUID] = network;
 
     SilKit::Services::Rpc::RpcSpec configuredDataSpec{controllerConfig.functionName.value(), dataSpec.MediaType()};
@@ -713,7 +822,8 @@ auto Participant<SilKitConnectionT>::CreateTimeSyncService(Orchestration::Lifecy
     config.name = Discovery::controllerTypeTimeSyncService;
     config.network = "default";
     timeSyncService = CreateController<Orchestration::TimeSyncService>(
-        config, std::move(timeSyncSupplementalData), false, &_timeProvider, _participantConfig.healthCheck, lifecycleService);
+        config, std::move(timeSyncSupplementalData), false, &_timeProvider, _participantConfig.healthCheck, lifecycleService,
+        _participantConfig.timeSynchronization);
 
     return timeSyncService;
 }
@@ -733,7 +843,7 @@ auto Participant<SilKitConnectionT>::GetLifecycleService() -> Services::Orchestr
         config.name = Discovery::controllerTypeLifecycleService;
         config.network = "default";
         lifecycleService = CreateController<Orchestration::LifecycleService>(
-            config, std::move(lifecycleSupplementalData), false);
+            config, std::move(lifecycleSupplementalData), false, _participantConfig.middleware.enableCompactStartupStatus);
     }
     return lifecycleService;
 }
@@ -1118,6 +1228,12 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const
     SendMsgImpl(from, msg);
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const Services::Orchestration::CompactParticipantStatus& msg)
+{
+    SendMsgImpl(from, msg);
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const Services::Orchestration::SystemCommand& msg)
 {
@@ -1380,6 +1496,12 @@ void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const
     SendMsgImpl(from, targetParticipantName, msg);
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName, const Services::Orchestration::CompactParticipantStatus& msg)
+{
+    SendMsgImpl(from, targetParticipantName, msg);
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName, const Services::Orchestration::SystemCommand& msg)
 {
@@ -1604,6 +1726,25 @@ void Participant<SilKitConnectionT>::ExecuteDeferred(std::function<void()> callb
     _connection.ExecuteDeferred(std::move(callback));
 }
 
+template <class SilKitConnectionT>
+void Participant<SilKitConnectionT>::ExecuteDeferredAt(std::chrono::steady_clock::time_point deadline,
+                                                       std::function<void()> callback)
+{
+    _connection.ExecuteDeferredAt(deadline, std::move(callback));
+}
+
+template <class SilKitConnectionT>
+auto Participant<SilKitConnectionT>::GetTransportMetrics() -> TransportMetrics
+{
+    return _connection.GetTransportMetrics();
+}
+
+template <class SilKitConnectionT>
+auto Participant<SilKitConnectionT>::GetSendQueueStatus() -> std::map<std::string, SendQueueStatus>
+{
+    return _connection.GetSendQueueStatus();
+}
+
 template <class SilKitConnectionT>
 void Participant<SilKitConnectionT>::SetAsyncSubscriptionsCompletionHandler(std::function<void()> handler)
 {
@@ -22,9 +22,11 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <vector>
 
 #include "ServiceDatatypes.hpp"
+#include "LabelMatching.hpp"
 
 namespace SilKit {
 namespace Core {
@@ -53,6 +55,9 @@ public:
     virtual std::vector<ServiceDescriptor> GetServices() const = 0;
     //!< React on a participant shutdown
     virtual void OnParticpantRemoval(const std::string& participantName) = 0;
+    //!< Labels of a DataPublisher or RpcClient, prepared for matching. They are decoded once per known service.
+    virtual auto GetServiceLabels(const ServiceDescriptor& serviceDescriptor) const
+        -> std::shared_ptr<const Util::CompiledLabels> = 0;
 
 };
 
@@ -214,6 +214,13 @@ void ServiceDiscovery::OnServiceRemoval(const ServiceDescriptor& serviceDescript
     CallHandlers(ServiceDiscoveryEvent::Type::ServiceRemoved, serviceDescriptor);
 }
 
+auto ServiceDiscovery::GetServiceLabels(const ServiceDescriptor& serviceDescriptor) const
+    -> std::shared_ptr<const Util::CompiledLabels>
+{
+    std::unique_lock<decltype(_discoveryMx)> lock(_discoveryMx);
+    return _specificDiscoveryStore.GetServiceLabels(serviceDescriptor);
+}
+
 void ServiceDiscovery::CallHandlers(ServiceDiscoveryEvent::Type eventType, const ServiceDescriptor& serviceDescriptor) const
 {
     // CallHandlers must be used with a lock on _discoveryMx
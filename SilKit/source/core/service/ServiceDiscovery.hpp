@@ -69,6 +69,10 @@ public: //IServiceDiscovery
     //!< React on a leaving participant, called via RegisterPeerShutdownCallback 
     void OnParticpantRemoval(const std::string& participantName) override;
 
+    //!< Labels of a DataPublisher or RpcClient, cached by the specific discovery store
+    auto GetServiceLabels(const ServiceDescriptor& serviceDescriptor) const
+        -> std::shared_ptr<const Util::CompiledLabels> override;
+
 public: // Interfaces
 
     // IServiceEndpoint
@@ -43,7 +43,6 @@ void SpecificDiscoveryStore::ServiceChange(ServiceDiscoveryEvent::Type changeTyp
         {
             std::string key;
             std::string mediaType;
-            std::vector<SilKit::Services::MatchingLabel> labels;
 
             // extract relevant information depending on controllerType
             if (supplControllerTypeName == controllerTypeRpcServerInternal)
@@ -55,26 +54,31 @@ void SpecificDiscoveryStore::ServiceChange(ServiceDiscoveryEvent::Type changeTyp
             {
                 serviceDescriptor.GetSupplementalDataItem(supplKeyRpcClientFunctionName, key);
                 serviceDescriptor.GetSupplementalDataItem(supplKeyRpcClientMediaType, mediaType);
-
-                // Add labels
-                std::string labelsStr;
-                if(serviceDescriptor.GetSupplementalDataItem(supplKeyRpcClientLabels, labelsStr))
-                {
-                    labels = SilKit::Config::Deserialize<decltype(labels)>(labelsStr);
-                }
             }
             else if (supplControllerTypeName == controllerTypeDataPublisher)
             {
                 serviceDescriptor.GetSupplementalDataItem(supplKeyDataPublisherTopic, key);
                 serviceDescriptor.GetSupplementalDataItem(supplKeyDataPublisherMediaType, mediaType);
+            }
+            else if (supplControllerTypeName == controllerTypeDataSubscriberInternal)
+            {
+                // The link of a DataSubscriberInternal is named after the UUID of its DataPublisher
+                key = serviceDescriptor.GetNetworkName();
+            }
 
-                // Add labels
-                std::string labelsStr;
-                if(serviceDescriptor.GetSupplementalDataItem(supplKeyDataPublisherPubLabels, labelsStr))
-                {
-                    labels = SilKit::Config::Deserialize<decltype(labels)>(labelsStr);
-                }
+            // The labels are decoded once per service and kept for the handlers and the removal of the service
+            const auto serviceKey = std::make_pair(serviceDescriptor.GetParticipantName(), serviceDescriptor.GetServiceId());
+            std::shared_ptr<const Util::CompiledLabels> compiledLabels;
+            if (changeType == ServiceDiscoveryEvent::Type::ServiceCreated)
+            {
+                compiledLabels = std::make_shared<const Util::CompiledLabels>(DecodeServiceLabels(serviceDescriptor));
+                _labelsByService[serviceKey] = compiledLabels;
             }
+            else
+            {
+                compiledLabels = GetServiceLabels(serviceDescriptor);
+            }
+            const auto& labels = compiledLabels->labels;
 
             CallHandlersOnServiceChange(changeType, supplControllerTypeName, key, labels, serviceDescriptor);
             if (changeType == ServiceDiscoveryEvent::Type::ServiceCreated)
@@ -84,11 +88,59 @@ void SpecificDiscoveryStore::ServiceChange(ServiceDiscoveryEvent::Type changeTyp
             else if (changeType == ServiceDiscoveryEvent::Type::ServiceRemoved)
             {
                 RemoveLookupNode(supplControllerTypeName, key, serviceDescriptor);
+                _labelsByService.erase(serviceKey);
             }
         }
     }
 }
 
+auto SpecificDiscoveryStore::GetServiceLabels(const ServiceDescriptor& serviceDescriptor) const
+    -> std::shared_ptr<const Util::CompiledLabels>
+{
+    const auto it =
+        _labelsByService.find(std::make_pair(serviceDescriptor.GetParticipantName(), serviceDescriptor.GetServiceId()));
+    if (it != _labelsByService.end())
+    {
+        return it->second;
+    }
+    return std::make_shared<const Util::CompiledLabels>(DecodeServiceLabels(serviceDescriptor));
+}
+
+auto DecodeServiceLabels(const ServiceDescriptor& serviceDescriptor) -> Util::CompiledLabels
+{
+    std::string supplControllerTypeName;
+    serviceDescriptor.GetSupplementalDataItem(Core::Discovery::controllerType, supplControllerTypeName);
+
+    std::string binaryKey;
+    std::string yamlKey;
+    if (supplControllerTypeName == controllerTypeDataPublisher)
+    {
+        binaryKey = supplKeyDataPublisherPubLabelsBinary;
+        yamlKey = supplKeyDataPublisherPubLabels;
+    }
+    else if (supplControllerTypeName == controllerTypeRpcClient)
+    {
+        binaryKey = supplKeyRpcClientLabelsBinary;
+        yamlKey = supplKeyRpcClientLabels;
+    }
+    else
+    {
+        return {};
+    }
+
+    std::string labelsStr;
+    if (serviceDescriptor.GetSupplementalDataItem(binaryKey, labelsStr))
+    {
+        return Util::DecodeLabels(labelsStr);
+    }
+    // Older participants only provide the YAML form
+    if (serviceDescriptor.GetSupplementalDataItem(yamlKey, labelsStr))
+    {
+        return Util::CompileLabels(SilKit::Config::Deserialize<std::vector<SilKit::Services::MatchingLabel>>(labelsStr));
+    }
+    return {};
+}
+
 // A new subscriber shows up -> notify of all earlier services
 void SpecificDiscoveryStore::CallHandlerOnHandlerRegistration(const ServiceDiscoveryHandler& handler,
                                                               const std::string& controllerType_, const std::string& key,
@@ -30,6 +30,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "IServiceDiscovery.hpp"
 #include "Hash.hpp"
+#include "LabelMatching.hpp"
 
 namespace SilKit {
 namespace Core {
@@ -99,6 +100,10 @@ public:
                                                  const std::string& key,
                                                  const std::vector<SilKit::Services::MatchingLabel>& labels);
 
+    //! Labels of a DataPublisher or RpcClient, prepared for matching. They are cached while the service is known.
+    auto GetServiceLabels(const ServiceDescriptor& serviceDescriptor) const
+        -> std::shared_ptr<const Util::CompiledLabels>;
+
 private: //methods
 
     //!< Trigger relevant handler calls when a service has changed
@@ -150,13 +155,21 @@ private: //member
 
     //!< SpecificDiscoveryStore is only available to a a sub set of controllers
     const std::unordered_set<std::string> _allowedControllers = {
-        controllerTypeDataPublisher, controllerTypeRpcServerInternal, controllerTypeRpcClient};
+        controllerTypeDataPublisher, controllerTypeRpcServerInternal, controllerTypeRpcClient,
+        controllerTypeDataSubscriberInternal};
+
+    //!< Decoded labels of the known services by participant name and service id
+    std::map<std::pair<std::string, EndpointId>, std::shared_ptr<const Util::CompiledLabels>> _labelsByService;
 
 protected:
     //! NB: container is not thread safe, all public API interactions must be secured with a common mutex
     std::unordered_map<FilterType, DiscoveryKeyNode, FilterTypeHash> _lookup;
 };
 
+//! Decode the labels of a DataPublisher or RpcClient from its supplemental data. Services of older participants only
+//! provide the labels in YAML, which are parsed instead.
+auto DecodeServiceLabels(const ServiceDescriptor& serviceDescriptor) -> Util::CompiledLabels;
+
 } // namespace Discovery
 } // namespace Core
 } // namespace SilKit
@@ -84,7 +84,6 @@ TEST_F(Test_SpecificDiscoveryStore, no_reaction_on_irrelevant_services)
 {
     std::string controllerTypes[] = {controllerTypeServiceDiscovery,
                                      controllerTypeCan,
-                                     controllerTypeDataSubscriberInternal,
                                      controllerTypeEthernet,
                                      controllerTypeFlexray,
                                      controllerTypeLifecycleService,
@@ -256,6 +255,33 @@ TEST_F(Test_SpecificDiscoveryStore, lookup_entries_rpc_server_internal)
     ASSERT_EQ(entry.allCluster.nodes.size(), 0);
 }
 
+TEST_F(Test_SpecificDiscoveryStore, lookup_entries_data_subscriber_internal)
+{
+    std::string uuid = "5b1c7a0e-2f4d-4c3a-9d8e-1a2b3c4d5e6f";
+    ServiceDescriptor baseDescriptor{};
+    baseDescriptor.SetParticipantNameAndComputeId("ParticipantA");
+    baseDescriptor.SetNetworkName(uuid);
+    baseDescriptor.SetServiceName("ServiceDiscovery");
+    baseDescriptor.SetSupplementalDataItem(Core::Discovery::controllerType, controllerTypeDataSubscriberInternal);
+
+    ServiceDescriptor testDescriptor{baseDescriptor};
+    testDescriptor.SetServiceId(1);
+
+    TestWrapperSpecificDiscoveryStore testStore;
+    testStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceCreated, testDescriptor);
+
+    auto& lookup = testStore.GetLookup();
+    ASSERT_EQ(lookup.size(), 1);
+    auto& entry = lookup[std::make_tuple(controllerTypeDataSubscriberInternal, uuid)];
+    ASSERT_EQ(entry.allCluster.nodes.size(), 1);
+    ASSERT_EQ(entry.allCluster.nodes[0], testDescriptor);
+
+    testStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceRemoved, testDescriptor);
+    //refresh lookup and entry
+    entry = lookup[std::make_tuple(controllerTypeDataSubscriberInternal, uuid)];
+    ASSERT_EQ(entry.allCluster.nodes.size(), 0);
+}
+
 TEST_F(Test_SpecificDiscoveryStore, lookup_handler_then_service_discovery)
 {
     TestWrapperSpecificDiscoveryStore testStore;
@@ -408,4 +434,49 @@ TEST_F(Test_SpecificDiscoveryStore, lookup_service_discovery_then_handler_issues
         controllerTypeDataPublisher, "Topic1", optionalSubscriberLabels2);
 }
 
+TEST_F(Test_SpecificDiscoveryStore, service_labels_prefer_binary_form_and_fall_back_to_yaml)
+{
+    TestWrapperSpecificDiscoveryStore testStore;
+
+    ServiceDescriptor baseDescriptor{};
+    baseDescriptor.SetParticipantNameAndComputeId("ParticipantA");
+    baseDescriptor.SetNetworkName("Link1");
+    baseDescriptor.SetServiceName("ServiceDiscovery");
+    baseDescriptor.SetSupplementalDataItem(Core::Discovery::controllerType, controllerTypeDataPublisher);
+    baseDescriptor.SetSupplementalDataItem(supplKeyDataPublisherTopic, "Topic1");
+    baseDescriptor.SetSupplementalDataItem(supplKeyDataPublisherMediaType, "text/json");
+
+    const std::vector<SilKit::Services::MatchingLabel> binaryLabels{
+        {"kB", "vB", SilKit::Services::MatchingLabel::Kind::Mandatory},
+        {"kA", "vA", SilKit::Services::MatchingLabel::Kind::Optional}};
+
+    ServiceDescriptor binaryDescriptor{baseDescriptor};
+    binaryDescriptor.SetSupplementalDataItem(supplKeyDataPublisherPubLabels, "[]");
+    binaryDescriptor.SetSupplementalDataItem(supplKeyDataPublisherPubLabelsBinary, EncodeLabels(binaryLabels));
+    binaryDescriptor.SetServiceId(1);
+
+    ServiceDescriptor yamlDescriptor{baseDescriptor};
+    yamlDescriptor.SetSupplementalDataItem(supplKeyDataPublisherPubLabels, "- key: kA\n  value: vA\n  kind: 2");
+    yamlDescriptor.SetServiceId(2);
+
+    testStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceCreated, binaryDescriptor);
+    testStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceCreated, yamlDescriptor);
+
+    const auto fromBinary = testStore.GetServiceLabels(binaryDescriptor);
+    ASSERT_EQ(fromBinary->labels.size(), 2u);
+    EXPECT_EQ(fromBinary->labels[0].key, "kA");
+    EXPECT_EQ(fromBinary->labels[1].key, "kB");
+    EXPECT_EQ(fromBinary->labels[1].kind, SilKit::Services::MatchingLabel::Kind::Mandatory);
+    // the cached instance is handed out as long as the service is known
+    EXPECT_EQ(testStore.GetServiceLabels(binaryDescriptor), fromBinary);
+
+    const auto fromYaml = testStore.GetServiceLabels(yamlDescriptor);
+    ASSERT_EQ(fromYaml->labels.size(), 1u);
+    EXPECT_EQ(fromYaml->labels[0].key, "kA");
+    EXPECT_EQ(fromYaml->labels[0].kind, SilKit::Services::MatchingLabel::Kind::Mandatory);
+
+    testStore.ServiceChange(ServiceDiscoveryEvent::Type::ServiceRemoved, binaryDescriptor);
+    EXPECT_NE(testStore.GetServiceLabels(binaryDescriptor), fromBinary);
+}
+
 } // anonymous namespace for test
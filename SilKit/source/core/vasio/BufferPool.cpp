@@ -0,0 +1,125 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "BufferPool.hpp"
+
+namespace {
+
+constexpr size_t MinBufferSize{64};
+constexpr size_t MaxBuffersPerSizeClass{256};
+
+//! Size of the buffers stored in the size class with the given index
+auto SizeOfClass(size_t index) -> size_t
+{
+    return MinBufferSize << index;
+}
+
+} // namespace
+
+namespace SilKit {
+namespace Core {
+
+auto BufferPool::Acquire(size_t capacity) -> std::vector<uint8_t>
+{
+    ++_acquired;
+
+    // the smallest size class which can hold the requested capacity
+    size_t index{0};
+    while (index < NumSizeClasses && SizeOfClass(index) < capacity)
+    {
+        ++index;
+    }
+
+    std::vector<uint8_t> buffer;
+    if (index == NumSizeClasses)
+    {
+        ++_allocated;
+        buffer.reserve(capacity);
+        return buffer;
+    }
+
+    auto& sizeClass = _sizeClasses[index];
+    {
+        std::unique_lock<decltype(sizeClass.mutex)> lock{sizeClass.mutex};
+        if (!sizeClass.buffers.empty())
+        {
+            buffer = std::move(sizeClass.buffers.back());
+            sizeClass.buffers.pop_back();
+            return buffer;
+        }
+    }
+
+    ++_allocated;
+    buffer.reserve(SizeOfClass(index));
+    return buffer;
+}
+
+void BufferPool::Release(std::vector<uint8_t> buffer)
+{
+    ++_released;
+
+    // the largest size class whose buffer size is covered by the capacity of the buffer
+    const auto capacity = buffer.capacity();
+    if (capacity < MinBufferSize || capacity >= 2 * SizeOfClass(NumSizeClasses - 1))
+    {
+        ++_discarded;
+        return;
+    }
+
+    size_t index{0};
+    while (index + 1 < NumSizeClasses && SizeOfClass(index + 1) <= capacity)
+    {
+        ++index;
+    }
+
+    buffer.clear();
+
+    auto& sizeClass = _sizeClasses[index];
+    {
+        std::unique_lock<decltype(sizeClass.mutex)> lock{sizeClass.mutex};
+        if (sizeClass.buffers.size() < MaxBuffersPerSizeClass)
+        {
+            sizeClass.buffers.push_back(std::move(buffer));
+            return;
+        }
+    }
+
+    ++_discarded;
+}
+
+auto BufferPool::GetStatistics() const -> BufferPoolStatistics
+{
+    BufferPoolStatistics statistics;
+    statistics.acquired = _acquired;
+    statistics.allocated = _allocated;
+    statistics.released = _released;
+    statistics.discarded = _discarded;
+    return statistics;
+}
+
+auto GetSerializedMessageBufferPool() -> BufferPool&
+{
+    static BufferPool pool;
+    return pool;
+}
+
+} // namespace Core
+} // namespace SilKit
@@ -0,0 +1,69 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "TransportMetrics.hpp"
+
+namespace SilKit {
+namespace Core {
+
+//! Thread-safe pool of byte buffers, organized in power-of-two size classes from 64 B to 64 KiB.
+//! Buffers are usually acquired by the thread serializing a message and released by the IO thread, after the message
+//! was written to the socket.
+class BufferPool
+{
+public:
+    //! Returns an empty buffer with a capacity of at least the given number of bytes.
+    auto Acquire(size_t capacity) -> std::vector<uint8_t>;
+    //! Returns a buffer to the pool. The buffer does not have to be acquired from the pool.
+    void Release(std::vector<uint8_t> buffer);
+
+    auto GetStatistics() const -> BufferPoolStatistics;
+
+private:
+    static constexpr size_t NumSizeClasses{11};
+
+    struct SizeClass
+    {
+        std::mutex mutex;
+        std::vector<std::vector<uint8_t>> buffers;
+    };
+
+    std::array<SizeClass, NumSizeClasses> _sizeClasses;
+
+    std::atomic<uint64_t> _acquired{0};
+    std::atomic<uint64_t> _allocated{0};
+    std::atomic<uint64_t> _released{0};
+    std::atomic<uint64_t> _discarded{0};
+};
+
+//! The pool providing the storage of outgoing SerializedMessages.
+auto GetSerializedMessageBufferPool() -> BufferPool&;
+
+} // namespace Core
+} // namespace SilKit
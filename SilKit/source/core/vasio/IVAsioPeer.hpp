@@ -28,6 +28,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "VAsioProtocolVersion.hpp"
 
 #include "SerializedMessage.hpp"
+#include "TransportMetrics.hpp"
 
 namespace SilKit {
 namespace Core {
@@ -60,6 +61,8 @@ public:
     //! Version management for backward compatibility on network ser/des level
     virtual void SetProtocolVersion(ProtocolVersion v) = 0;
     virtual auto GetProtocolVersion() const -> ProtocolVersion = 0;
+    //! Fill level of the queue of messages waiting to be sent
+    virtual auto GetSendQueueStatus() const -> SendQueueStatus = 0;
 };
 
 } // namespace Core
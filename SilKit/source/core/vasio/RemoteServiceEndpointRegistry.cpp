@@ -0,0 +1,72 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "RemoteServiceEndpointRegistry.hpp"
+
+namespace SilKit {
+namespace Core {
+
+auto RemoteServiceEndpointRegistry::GetOrCreate(IVAsioPeer* peer, EndpointId endpointId) -> const IServiceEndpoint*
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    auto& peerEndpoints = _endpoints[peer];
+
+    auto it = peerEndpoints.find(endpointId);
+    if (it == peerEndpoints.end())
+    {
+        auto* peerService = dynamic_cast<IServiceEndpoint*>(peer);
+        if (peerService == nullptr)
+        {
+            throw LogicError{"RemoteServiceEndpointRegistry: peer is not an IServiceEndpoint"};
+        }
+
+        ServiceDescriptor descriptor{peerService->GetServiceDescriptor()};
+        descriptor.SetServiceId(endpointId);
+
+        it = peerEndpoints.emplace(endpointId, std::make_unique<RemoteServiceEndpoint>(descriptor)).first;
+    }
+
+    return it->second.get();
+}
+
+void RemoteServiceEndpointRegistry::RemovePeer(IVAsioPeer* peer)
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    _endpoints.erase(peer);
+}
+
+auto RemoteServiceEndpointRegistry::Size() const -> size_t
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    size_t size{0};
+    for (const auto& kv : _endpoints)
+    {
+        size += kv.second.size();
+    }
+    return size;
+}
+
+} // namespace Core
+} // namespace SilKit
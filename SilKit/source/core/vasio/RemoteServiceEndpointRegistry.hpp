@@ -0,0 +1,78 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "IServiceEndpoint.hpp"
+#include "IVAsioPeer.hpp"
+#include "silkit/participant/exception.hpp"
+
+namespace SilKit {
+namespace Core {
+
+//! Represents a service of a remote participant as the sender of a received message.
+struct RemoteServiceEndpoint : IServiceEndpoint
+{
+    void SetServiceDescriptor(const SilKit::Core::ServiceDescriptor&) override 
+    {
+        throw LogicError("This method is not supposed to be used in this struct.");
+    }
+
+    auto GetServiceDescriptor() const -> const ServiceDescriptor & override
+    {
+        return _serviceDescriptor; 
+    }
+
+    RemoteServiceEndpoint(const ServiceDescriptor& descriptor)
+    {
+        _serviceDescriptor = descriptor;
+    }
+
+private:
+    ServiceDescriptor _serviceDescriptor;
+};
+
+//! Interned RemoteServiceEndpoints of the services of all connected peers, keyed by peer and endpoint id.
+//! An endpoint is created when the first message of the remote service is received. It is immutable and its address
+//! stays valid until the peer is removed, so receiving further messages neither copies the descriptor nor allocates.
+class RemoteServiceEndpointRegistry
+{
+public:
+    //! Returns the endpoint of the service with the given id of the peer. The peer must be an IServiceEndpoint.
+    auto GetOrCreate(IVAsioPeer* peer, EndpointId endpointId) -> const IServiceEndpoint*;
+    //! Drops all endpoints of the peer, e.g., when the peer shuts down.
+    void RemovePeer(IVAsioPeer* peer);
+
+    auto Size() const -> size_t;
+
+private:
+    using EndpointMap = std::unordered_map<EndpointId, std::unique_ptr<RemoteServiceEndpoint>>;
+
+    mutable std::mutex _mutex;
+    std::unordered_map<IVAsioPeer*, EndpointMap> _endpoints;
+};
+
+} // namespace Core
+} // namespace SilKit
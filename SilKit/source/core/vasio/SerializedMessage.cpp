@@ -31,16 +31,58 @@ SerializedMessage::SerializedMessage(std::vector<uint8_t>&& blob)
     ReadNetworkHeaders();
 }
 
+// Constructor from a slice of shared raw data (reading)
+SerializedMessage::SerializedMessage(std::shared_ptr<const std::vector<uint8_t>> sharedBlob, size_t offset, size_t size)
+    : _buffer{std::move(sharedBlob), offset, size}
+{
+    ReadNetworkHeaders();
+}
+
+// Constructor for sim messages with a shared payload (writing)
+SerializedMessage::SerializedMessage(VAsioMsgKind messageKind, EndpointAddress endpointAddress, EndpointId remoteIndex,
+                                     SharedPayload payload)
+    : _messageKind{messageKind}
+    , _endpointAddress{endpointAddress}
+    , _remoteIndex{remoteIndex}
+    , _sharedPayload{std::move(payload)}
+{
+    if (!IsMwOrSim(_messageKind) || !_sharedPayload)
+    {
+        throw SilKitError{"SerializedMessage: a shared payload requires a sim message and a valid payload"};
+    }
+
+    AcquireBuffer(0);
+    WriteNetworkHeaders();
+    ReadNetworkHeaders();
+}
+
 auto SerializedMessage::ReleaseStorage() -> std::vector<uint8_t>
 {
-    auto buffer = _buffer.ReleaseStorage();
-    if (buffer.size() > std::numeric_limits<uint32_t>::max())
+    auto frame = ReleaseFrame();
+    if (frame.sharedPayload)
+    {
+        frame.header.insert(frame.header.end(), frame.sharedPayload->begin(), frame.sharedPayload->end());
+    }
+    return std::move(frame.header);
+}
+
+auto SerializedMessage::ReleaseFrame() -> SerializedFrame
+{
+    SerializedFrame frame;
+    frame.header = _buffer.ReleaseStorage();
+    frame.sharedPayload = std::move(_sharedPayload);
+    frame.droppable = _droppable;
+    frame.conflatable = _conflatable;
+    frame.conflationKey = std::make_pair(_endpointAddress.endpoint, _remoteIndex);
+
+    const auto frameSize = frame.Size();
+    if (frameSize > std::numeric_limits<uint32_t>::max())
         throw SilKitError{"SerializedMessage::Serialize: message buffer is too large"};
 
-    // emplace the buffer size as the first element in the byte stream
-    const auto bufferSize = static_cast<uint32_t>(buffer.size());
-    memcpy(buffer.data(), &bufferSize, sizeof(uint32_t));
-    return buffer;
+    // emplace the frame size as the first element in the byte stream
+    const auto bufferSize = static_cast<uint32_t>(frameSize);
+    memcpy(frame.header.data(), &bufferSize, sizeof(uint32_t));
+    return frame;
 }
 
 auto SerializedMessage::GetMessageKind() const -> VAsioMsgKind
@@ -88,6 +130,28 @@ auto SerializedMessage::GetProxyMessageHeader() const -> ProxyMessageHeader
     return _proxyMessageHeader;
 }
 
+void SerializedMessage::SetDroppable(bool droppable)
+{
+    _droppable = droppable;
+}
+
+void SerializedMessage::SetConflatable(bool conflatable)
+{
+    _conflatable = conflatable;
+}
+
+auto SerializedMessage::MakeSharedPayloadBuffer() const -> MessageBuffer
+{
+    MessageBuffer buffer{_sharedPayload, 0, _sharedPayload->size()};
+    buffer.SetProtocolVersion(_buffer.GetProtocolVersion());
+    return buffer;
+}
+
+void SerializedMessage::AcquireBuffer(size_t bodySize)
+{
+    _buffer = MessageBuffer{GetSerializedMessageBufferPool().Acquire(MaxNetworkHeaderSize + bodySize)};
+}
+
 void SerializedMessage::WriteNetworkHeaders()
 {
     _buffer << _messageSize; // placeholder for finalization via ReleaseStorage()
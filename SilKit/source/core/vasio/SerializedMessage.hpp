@@ -19,10 +19,16 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #pragma once
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <utility>
+
 #include "VAsioMsgKind.hpp"
 #include "VAsioDatatypes.hpp"
 #include "SerializedMessageTraits.hpp"
 #include "MessageBuffer.hpp"
+#include "BufferPool.hpp"
 
 // Component specific Serialize/Deserialize functions
 #include "VAsioSerdes.hpp"
@@ -48,19 +54,69 @@ auto AdlDeserialize(Args&&... args) -> decltype(auto)
 	return Deserialize(std::forward<Args>(args)...);
 }
 
-template<typename T>
-struct SerializedSize
+//! Body size of the last serialized message of a type. The storage of the next message of the type is reserved with
+//! this size, so that fixed-size messages get a pooled buffer of the matching size class, while a larger message
+//! grows its buffer on demand.
+template<typename MessageT>
+struct SerializedSizeHint
 {
-    size_t _size{};
-    SerializedSize(const T& message)
-    {
-        MessageBuffer buffer;
-        Serialize(buffer, message);
-        _size = buffer.ReleaseStorage().size();
-    }
-    size_t Size() const
+    static std::atomic<size_t> bodySize;
+};
+
+template<typename MessageT>
+std::atomic<size_t> SerializedSizeHint<MessageT>::bodySize{0};
+
+//! Serialize the message body and remember its size for the next message of the type.
+template<typename MessageT>
+void SerializeBody(MessageBuffer& buffer, const MessageT& message)
+{
+    const auto headerSize = buffer.WritePos();
+    Serialize(buffer, message);
+    SerializedSizeHint<MessageT>::bodySize.store(buffer.WritePos() - headerSize, std::memory_order_relaxed);
+}
+
+//! Upper bound for the size of the network headers written by a SerializedMessage
+constexpr size_t MaxNetworkHeaderSize{sizeof(uint32_t) + sizeof(VAsioMsgKind) + sizeof(RegistryMessageKind)
+                                      + sizeof(EndpointId) + sizeof(EndpointAddress)};
+
+//! Serialized message body which is shared by multiple SerializedMessages, e.g., when the same message is sent to
+//! multiple remote receivers. Only the network headers are written per SerializedMessage.
+using SharedPayload = std::shared_ptr<const std::vector<uint8_t>>;
+
+//! Serialize the message body only, without any network headers.
+template<typename MessageT>
+auto SerializePayload(const MessageT& message) -> SharedPayload;
+
+//! The serialized message body, if the message already carries it, nullptr otherwise. Overloaded for messages which
+//! can be built in their serialized form, e.g., WireDataMessageEvent.
+template<typename MessageT>
+auto GetSerializedPayload(const MessageT& /*message*/) -> SharedPayload
+{
+    return nullptr;
+}
+
+//! Wire representation of a SerializedMessage: the network headers (including the message size), followed by the
+//! optional shared payload. If there is no shared payload, the header also contains the message body.
+struct SerializedFrame
+{
+    std::vector<uint8_t> header;
+    SharedPayload sharedPayload;
+    //! The frame may be dropped from an overflowing send queue
+    bool droppable{false};
+    //! A queued frame with the same conflation key is discarded when the frame is queued
+    bool conflatable{false};
+    //! The sending endpoint and the remote index of the frame, i.e., its sender and receiver on the peer
+    std::pair<EndpointId, EndpointId> conflationKey{};
+    //! The frame was superseded by a newer conflatable frame while queued, and is not written
+    bool discarded{false};
+    //! Number of messages in the frame, which is larger than one for message batches
+    size_t messageCount{1};
+    //! Time the frame was queued for sending, only set if transport metrics are collected
+    std::chrono::steady_clock::time_point queueTime{};
+
+    auto Size() const -> size_t
     {
-        return _size;
+        return header.size() + (sharedPayload ? sharedPayload->size() : 0);
     }
 };
 
@@ -81,11 +137,19 @@ public: // Sending a SerializedMessage: from T to binary blob
 	explicit SerializedMessage(const MessageT& message , EndpointAddress endpointAddress, EndpointId remoteIndex);
 	template<typename MessageT>
 	explicit SerializedMessage(ProtocolVersion version, const MessageT& message);
+	// Sim messages with a body that was serialized once via SerializePayload
+	explicit SerializedMessage(VAsioMsgKind messageKind, EndpointAddress endpointAddress, EndpointId remoteIndex,
+	                           SharedPayload payload);
 
+	//! Contiguous wire representation. Copies the shared payload, if present.
 	auto ReleaseStorage() -> std::vector<uint8_t>;
+	//! Wire representation without copying the shared payload.
+	auto ReleaseFrame() -> SerializedFrame;
 
 public: // Receiving a SerializedMessage: from binary blob to SilKitMessage<T>
 	explicit SerializedMessage(std::vector<uint8_t>&& blob);
+	//! Borrow the blob [offset, offset + size) of a shared receive buffer without copying it.
+	explicit SerializedMessage(std::shared_ptr<const std::vector<uint8_t>> sharedBlob, size_t offset, size_t size);
 
 	template<typename ApiMessageT>
 	auto Deserialize() -> ApiMessageT;
@@ -99,10 +163,17 @@ public: // Receiving a SerializedMessage: from binary blob to SilKitMessage<T>
 	void SetProtocolVersion(ProtocolVersion version);
     auto GetProxyMessageHeader() const -> ProxyMessageHeader;
 	auto GetRegistryMessageHeader() const -> RegistryMsgHeader;
+	//! Mark the message as droppable from an overflowing send queue, e.g., for history-less bus frames
+	void SetDroppable(bool droppable);
+	//! Mark the simulation message as replaceable by a newer message of the same sender to the same receiver, as
+	//! long as it is queued for sending
+	void SetConflatable(bool conflatable);
 
 private:
+	void AcquireBuffer(size_t bodySize);
 	void WriteNetworkHeaders();
 	void ReadNetworkHeaders();
+	auto MakeSharedPayloadBuffer() const -> MessageBuffer;
 	// network headers, some members are optional depending on messageKind
 	uint32_t _messageSize{0};
 	VAsioMsgKind _messageKind{VAsioMsgKind::Invalid};
@@ -116,6 +187,10 @@ private:
     ProxyMessageHeader _proxyMessageHeader;
 
 	MessageBuffer _buffer;
+	// Message body which is not part of _buffer
+	SharedPayload _sharedPayload;
+	bool _droppable{false};
+	bool _conflatable{false};
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -124,13 +199,12 @@ private:
 template <typename MessageT>
 SerializedMessage::SerializedMessage(const MessageT& message)
 {
-    static SerializedSize<MessageT> messageSize{message};
-    _buffer.IncreaseCapacity(messageSize.Size());
+    AcquireBuffer(SerializedSizeHint<MessageT>::bodySize.load(std::memory_order_relaxed));
 
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
     WriteNetworkHeaders();
-    Serialize(_buffer, message);
+    SerializeBody(_buffer, message);
     //Ensure we can directly Deserialize in unit tests by reading the header in again
     ReadNetworkHeaders();
 }
@@ -138,14 +212,13 @@ SerializedMessage::SerializedMessage(const MessageT& message)
 template <typename MessageT>
 SerializedMessage::SerializedMessage(ProtocolVersion version, const MessageT& message)
 {
-    static SerializedSize<MessageT> messageSize{message};
-    _buffer.IncreaseCapacity(messageSize.Size());
+    AcquireBuffer(SerializedSizeHint<MessageT>::bodySize.load(std::memory_order_relaxed));
 
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
     _buffer.SetProtocolVersion(version);
     WriteNetworkHeaders();
-    Serialize(_buffer, message);
+    SerializeBody(_buffer, message);
     //Ensure we can directly Deserialize in unit tests by reading the header in again
     ReadNetworkHeaders();
 }
@@ -153,31 +226,48 @@ SerializedMessage::SerializedMessage(ProtocolVersion version, const MessageT& me
 template <typename MessageT>
 SerializedMessage::SerializedMessage(const MessageT& message, EndpointAddress endpointAddress, EndpointId remoteIndex)
 {
-    static SerializedSize<MessageT> messageSize{message};
-    _buffer.IncreaseCapacity(messageSize.Size());
+    AcquireBuffer(SerializedSizeHint<MessageT>::bodySize.load(std::memory_order_relaxed));
 
     _remoteIndex = remoteIndex;
     _endpointAddress = endpointAddress;
     _messageKind = messageKind<MessageT>();
     _registryKind = registryMessageKind<MessageT>();
     WriteNetworkHeaders();
-    Serialize(_buffer, message);
+    SerializeBody(_buffer, message);
     //Ensure we can directly Deserialize in unit tests by reading the header in again
     ReadNetworkHeaders();
 }
 
+template <typename MessageT>
+auto SerializePayload(const MessageT& message) -> SharedPayload
+{
+    MessageBuffer buffer;
+    buffer.IncreaseCapacity(SerializedSizeHint<MessageT>::bodySize.load(std::memory_order_relaxed));
+
+    SerializeBody(buffer, message);
+    return std::make_shared<const std::vector<uint8_t>>(buffer.ReleaseStorage());
+}
+
 template <typename ApiMessageT>
 auto SerializedMessage::Deserialize() -> ApiMessageT
 {
     ApiMessageT value{};
-    AdlDeserialize(_buffer, value);
+    if (_sharedPayload)
+    {
+        auto payloadBuffer = MakeSharedPayloadBuffer();
+        AdlDeserialize(payloadBuffer, value);
+    }
+    else
+    {
+        AdlDeserialize(_buffer, value);
+    }
     return value;
 }
 
 template <typename ApiMessageT>
 auto SerializedMessage::Deserialize() const -> ApiMessageT
 {
-    auto bufferCopy = _buffer;
+    auto bufferCopy = _sharedPayload ? MakeSharedPayloadBuffer() : _buffer;
     ApiMessageT value{};
     AdlDeserialize(bufferCopy, value);
     return value;
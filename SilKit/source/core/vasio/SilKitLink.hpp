@@ -21,9 +21,12 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <mutex>
+
 #include "ILogger.hpp"
 
 #include "VAsioTransmitter.hpp"
+#include "TransportMetricsRecorder.hpp"
 #include "traits/SilKitMsgTraits.hpp"
 #include "MessageTracing.hpp"
 
@@ -42,7 +45,8 @@ public:
 public:
     // ----------------------------------------
     // Constructors and Destructor
-    SilKitLink(std::string name, Services::Logging::ILogger* logger, Services::Orchestration::ITimeProvider* timeProvider);
+    SilKitLink(std::string name, Services::Logging::ILogger* logger, Services::Orchestration::ITimeProvider* timeProvider,
+               LinkMetricsRecorder* metrics = nullptr);
 
 public:
     // ----------------------------------------
@@ -50,6 +54,8 @@ public:
     static constexpr auto MsgTypeName() -> const char* { return SilKitMsgTraits<MsgT>::TypeName(); }
     static constexpr auto MessageSerdesName() -> const char* { return SilKitMsgTraits<MsgT>::SerdesName(); }
     inline auto Name() const -> const std::string& { return _name; }
+    //! Transport metrics of the link, if they are collected
+    inline auto GetMetrics() const -> LinkMetricsRecorder* { return _metrics; }
 
     void AddLocalReceiver(ReceiverT* receiver);
     void AddRemoteReceiver(IVAsioPeer* peer, EndpointId remoteIdx);
@@ -61,6 +67,8 @@ public:
     void DistributeLocalSilKitMessage(const IServiceEndpoint* from, const MsgT& msg);
 
     void SetHistoryLength(size_t history);
+    void SetRemoteSubscription(const std::string& participantName, EndpointId subscriberId,
+                               std::shared_ptr<const RemoteSubscription> subscription);
 
     void DispatchSilKitMessageToTarget(const IServiceEndpoint* from, const std::string& targetParticipantName, const MsgT& msg);
 
@@ -75,8 +83,12 @@ private:
     std::string _name;
     Services::Logging::ILogger* _logger;
     Services::Orchestration::ITimeProvider* _timeProvider;
+    LinkMetricsRecorder* _metrics;
 
     std::vector<ReceiverT*> _localReceivers;
+    //! Guards adding and removing the remote receivers on the I/O thread against the lookups from other threads, e.g.,
+    //! the send queue policy applied on the sending thread. The I/O thread itself reads the receivers without the lock.
+    mutable std::mutex _remoteReceiversMx;
     VAsioTransmitter<MsgT> _vasioTransmitter;
 };
 
@@ -84,10 +96,12 @@ private:
 //  Inline Implementations
 // ================================================================================
 template <class MsgT>
-SilKitLink<MsgT>::SilKitLink(std::string name, Services::Logging::ILogger* logger, Services::Orchestration::ITimeProvider* timeProvider)
+SilKitLink<MsgT>::SilKitLink(std::string name, Services::Logging::ILogger* logger, Services::Orchestration::ITimeProvider* timeProvider,
+                             LinkMetricsRecorder* metrics)
     : _name{std::move(name)}
     , _logger{logger}
     , _timeProvider{timeProvider}
+    , _metrics{metrics}
 {
 }
 
@@ -101,22 +115,26 @@ void SilKitLink<MsgT>::AddLocalReceiver(ReceiverT* receiver)
 template <class MsgT>
 void SilKitLink<MsgT>::AddRemoteReceiver(IVAsioPeer* peer, EndpointId remoteIdx)
 {
+    std::unique_lock<decltype(_remoteReceiversMx)> lock{_remoteReceiversMx};
     _vasioTransmitter.AddRemoteReceiver(peer, remoteIdx);
 }
 template <class MsgT>
 void SilKitLink<MsgT>::RemoveRemoteReceiver(IVAsioPeer* peer)
 {
+    std::unique_lock<decltype(_remoteReceiversMx)> lock{_remoteReceiversMx};
     _vasioTransmitter.RemoveRemoteReceiver(peer);
 }
 template <class MsgT>
 auto SilKitLink<MsgT>::GetNumberOfRemoteReceivers() -> size_t
 {
+    std::unique_lock<decltype(_remoteReceiversMx)> lock{_remoteReceiversMx};
     return _vasioTransmitter.GetNumberOfRemoteReceivers();
 }
 
 template <class MsgT>
 auto SilKitLink<MsgT>::GetParticipantNamesOfRemoteReceivers() -> std::vector<std::string>
 {
+    std::unique_lock<decltype(_remoteReceiversMx)> lock{_remoteReceiversMx};
     return _vasioTransmitter.GetParticipantNamesOfRemoteReceivers();
 }
 
@@ -147,6 +165,12 @@ void SilKitLink<MsgT>::DistributeRemoteSilKitMessage(const IServiceEndpoint* fro
         SetTimestamp(msg, _timeProvider->Now());
     }
 
+    if (_metrics != nullptr)
+    {
+        _metrics->messagesReceived.fetch_add(1, std::memory_order_relaxed);
+    }
+    ScopedDurationMeasurement measurement{_metrics != nullptr ? &_metrics->callbackTime : nullptr};
+
     for (auto&& receiver : _localReceivers)
     {
         DispatchSilKitMessage(receiver, from, msg);
@@ -160,7 +184,15 @@ void SilKitLink<MsgT>::DistributeLocalSilKitMessage(const IServiceEndpoint* from
     // NB: Messages must be dispatched to remote receivers first.
     // Otherwise, messages that may be produced during the internal dispatch will be dispatched to remote receivers first.
     // As a result, the messages may be delivered in the wrong order (possibly even reversed)
-    DispatchSilKitMessage(&_vasioTransmitter, from, msg);
+    if (_metrics != nullptr)
+    {
+        _metrics->messagesSent.fetch_add(1, std::memory_order_relaxed);
+    }
+    {
+        const bool isMeasured = _metrics != nullptr && _vasioTransmitter.GetNumberOfRemoteReceivers() != 0;
+        ScopedDurationMeasurement measurement{isMeasured ? &_metrics->serializationTime : nullptr};
+        DispatchSilKitMessage(&_vasioTransmitter, from, msg);
+    }
     for (auto&& receiver : _localReceivers)
     {
         auto* receiverId = dynamic_cast<const IServiceEndpoint*>(receiver);
@@ -203,6 +235,11 @@ void SilKitLink<MsgT>::DispatchSilKitMessage(ReceiverT* to, const IServiceEndpoi
 template <class MsgT>
 void SilKitLink<MsgT>::DispatchSilKitMessageToTarget(const IServiceEndpoint* from, const std::string& targetParticipantName, const MsgT& msg)
 {
+    if (_metrics != nullptr)
+    {
+        _metrics->messagesSent.fetch_add(1, std::memory_order_relaxed);
+    }
+    ScopedDurationMeasurement measurement{_metrics != nullptr ? &_metrics->serializationTime : nullptr};
     _vasioTransmitter.SendMessageToTarget(from, targetParticipantName, msg);
 }
 
@@ -212,5 +249,12 @@ void SilKitLink<MsgT>::SetHistoryLength(size_t history)
     _vasioTransmitter.SetHistoryLength(history);
 }
 
+template <class MsgT>
+void SilKitLink<MsgT>::SetRemoteSubscription(const std::string& participantName, EndpointId subscriberId,
+                                             std::shared_ptr<const RemoteSubscription> subscription)
+{
+    _vasioTransmitter.SetRemoteSubscription(participantName, subscriberId, std::move(subscription));
+}
+
 } // namespace Core
 } // namespace SilKit
@@ -0,0 +1,93 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "BufferPool.hpp"
+#include "SerializedMessage.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace SilKit::Core;
+
+TEST(Test_BufferPool, acquire_reuses_released_buffer)
+{
+    BufferPool pool;
+
+    auto buffer = pool.Acquire(100);
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_GE(buffer.capacity(), 100u);
+    const auto* data = buffer.data();
+
+    buffer.resize(100);
+    pool.Release(std::move(buffer));
+
+    auto reused = pool.Acquire(80);
+    EXPECT_TRUE(reused.empty());
+    EXPECT_EQ(reused.data(), data);
+
+    const auto statistics = pool.GetStatistics();
+    EXPECT_EQ(statistics.acquired, 2u);
+    EXPECT_EQ(statistics.allocated, 1u);
+    EXPECT_EQ(statistics.released, 1u);
+    EXPECT_EQ(statistics.discarded, 0u);
+}
+
+TEST(Test_BufferPool, buffers_outside_of_size_classes_are_not_pooled)
+{
+    BufferPool pool;
+
+    auto large = pool.Acquire(1024 * 1024);
+    EXPECT_GE(large.capacity(), 1024u * 1024u);
+    pool.Release(std::move(large));
+    pool.Release(std::vector<uint8_t>{});
+
+    const auto statistics = pool.GetStatistics();
+    EXPECT_EQ(statistics.allocated, 1u);
+    EXPECT_EQ(statistics.released, 2u);
+    EXPECT_EQ(statistics.discarded, 2u);
+}
+
+TEST(Test_BufferPool, sending_fixed_size_messages_does_not_allocate_in_steady_state)
+{
+    auto& pool = GetSerializedMessageBufferPool();
+
+    SilKit::Services::Can::WireCanFrameEvent event{};
+    event.frame.canId = 17;
+    event.frame.dataField = SilKit::Util::SharedVector<uint8_t>{std::vector<uint8_t>(8, 0x2a)};
+
+    auto sendMessages = [&event, &pool] {
+        for (EndpointId remoteIndex = 0; remoteIndex < 100; ++remoteIndex)
+        {
+            auto frame = SerializedMessage{event, EndpointAddress{1, 2}, remoteIndex}.ReleaseFrame();
+            pool.Release(std::move(frame.header));
+        }
+    };
+
+    // warm up the pool
+    sendMessages();
+
+    const auto before = pool.GetStatistics();
+    sendMessages();
+    const auto after = pool.GetStatistics();
+
+    EXPECT_EQ(after.acquired - before.acquired, 100u);
+    EXPECT_EQ(after.allocated, before.allocated);
+    EXPECT_EQ(after.discarded, before.discarded);
+}
@@ -0,0 +1,105 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "RemoteServiceEndpointRegistry.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace SilKit::Core;
+
+namespace {
+
+struct DummyPeer
+    : IVAsioPeer
+    , IServiceEndpoint
+{
+    VAsioPeerInfo info;
+    ServiceDescriptor serviceDescriptor;
+
+    explicit DummyPeer(const std::string& participantName)
+    {
+        info.participantName = participantName;
+        serviceDescriptor.SetParticipantNameAndComputeId(participantName);
+        serviceDescriptor.SetNetworkName("CAN1");
+    }
+
+    // IVAsioPeer
+    void SendSilKitMsg(SerializedMessage) override {}
+    void Subscribe(VAsioMsgSubscriber) override {}
+    auto GetInfo() const -> const VAsioPeerInfo& override { return info; }
+    void SetInfo(VAsioPeerInfo) override {}
+    auto GetRemoteAddress() const -> std::string override { return {}; }
+    auto GetLocalAddress() const -> std::string override { return {}; }
+    void StartAsyncRead() override {}
+    void DrainAllBuffers() override {}
+    void SetProtocolVersion(ProtocolVersion) override {}
+    auto GetProtocolVersion() const -> ProtocolVersion override { return CurrentProtocolVersion(); }
+    auto GetSendQueueStatus() const -> SendQueueStatus override { return {}; }
+
+    // IServiceEndpoint
+    void SetServiceDescriptor(const ServiceDescriptor& descriptor) override { serviceDescriptor = descriptor; }
+    auto GetServiceDescriptor() const -> const ServiceDescriptor& override { return serviceDescriptor; }
+};
+
+} // namespace
+
+TEST(Test_RemoteServiceEndpointRegistry, endpoint_is_interned_per_peer_and_endpoint_id)
+{
+    RemoteServiceEndpointRegistry registry;
+    DummyPeer peerA{"A"};
+    DummyPeer peerB{"B"};
+
+    const auto* a1 = registry.GetOrCreate(&peerA, 1);
+    const auto* a2 = registry.GetOrCreate(&peerA, 2);
+    const auto* b1 = registry.GetOrCreate(&peerB, 1);
+
+    EXPECT_EQ(registry.GetOrCreate(&peerA, 1), a1);
+    EXPECT_NE(a1, a2);
+    EXPECT_NE(a1, b1);
+    EXPECT_EQ(registry.Size(), 3u);
+
+    EXPECT_EQ(a1->GetServiceDescriptor().GetParticipantName(), "A");
+    EXPECT_EQ(a1->GetServiceDescriptor().GetNetworkName(), "CAN1");
+    EXPECT_EQ(a1->GetServiceDescriptor().GetServiceId(), 1u);
+    EXPECT_EQ(a2->GetServiceDescriptor().GetServiceId(), 2u);
+    EXPECT_EQ(b1->GetServiceDescriptor().GetParticipantName(), "B");
+}
+
+TEST(Test_RemoteServiceEndpointRegistry, remove_peer_drops_only_its_endpoints)
+{
+    RemoteServiceEndpointRegistry registry;
+    DummyPeer peerA{"A"};
+    DummyPeer peerB{"B"};
+
+    registry.GetOrCreate(&peerA, 1);
+    registry.GetOrCreate(&peerA, 2);
+    const auto* b1 = registry.GetOrCreate(&peerB, 1);
+
+    registry.RemovePeer(&peerA);
+
+    EXPECT_EQ(registry.Size(), 1u);
+    EXPECT_EQ(registry.GetOrCreate(&peerB, 1), b1);
+
+    // a peer which reconnects gets endpoints reflecting its current descriptor
+    peerA.serviceDescriptor.SetNetworkName("CAN2");
+    EXPECT_EQ(registry.GetOrCreate(&peerA, 1)->GetServiceDescriptor().GetNetworkName(), "CAN2");
+}
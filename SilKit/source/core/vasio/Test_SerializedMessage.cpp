@@ -95,3 +95,84 @@ TEST(Test_SerializedMessage, packed_handshake_message)
 
     ASSERT_EQ(to_string(ptr->acceptorUri0, ptr->acceptorUri0Size), announcement.peerInfo.acceptorUris.at(0));
 }
+
+TEST(Test_SerializedMessage, shared_payload_matches_contiguous_serialization)
+{
+    SilKit::Services::PubSub::WireDataMessageEvent event;
+    event.timestamp = std::chrono::nanoseconds{1234};
+    event.data = std::vector<uint8_t>(100, 0x2a);
+
+    const EndpointAddress endpointAddress{1, 2};
+
+    auto payload = SerializePayload(event);
+    ASSERT_NE(payload, nullptr);
+
+    for (EndpointId remoteIndex : {EndpointId{3}, EndpointId{4}})
+    {
+        SerializedMessage contiguous{event, endpointAddress, remoteIndex};
+        SerializedMessage shared{messageKind<SilKit::Services::PubSub::WireDataMessageEvent>(), endpointAddress,
+                                 remoteIndex, payload};
+
+        ASSERT_EQ(shared.GetRemoteIndex(), remoteIndex);
+        ASSERT_EQ(shared.GetEndpointAddress(), endpointAddress);
+
+        const auto deserialized = shared.Deserialize<SilKit::Services::PubSub::WireDataMessageEvent>();
+        ASSERT_EQ(deserialized.timestamp, event.timestamp);
+        ASSERT_TRUE(SilKit::Util::ItemsAreEqual(deserialized.data, event.data));
+
+        auto frame = SerializedMessage{shared}.ReleaseFrame();
+        ASSERT_EQ(frame.sharedPayload, payload);
+        ASSERT_EQ(frame.header.size() + payload->size(), frame.Size());
+
+        // the per-receiver header followed by the shared payload must be identical to the contiguous wire format
+        ASSERT_EQ(shared.ReleaseStorage(), contiguous.ReleaseStorage());
+    }
+}
+
+TEST(Test_SerializedMessage, borrow_slice_of_shared_receive_buffer)
+{
+    SilKit::Services::PubSub::WireDataMessageEvent event;
+    event.timestamp = std::chrono::nanoseconds{1234};
+    event.data = std::vector<uint8_t>(100, 0x2a);
+
+    const EndpointAddress endpointAddress{1, 2};
+
+    // two messages back to back in a single receive buffer
+    auto first = SerializedMessage{event, endpointAddress, 3}.ReleaseStorage();
+    auto second = SerializedMessage{event, endpointAddress, 4}.ReleaseStorage();
+    auto receiveBuffer = std::make_shared<std::vector<uint8_t>>(first);
+    receiveBuffer->insert(receiveBuffer->end(), second.begin(), second.end());
+
+    SerializedMessage firstMessage{receiveBuffer, 0, first.size()};
+    SerializedMessage secondMessage{receiveBuffer, first.size(), second.size()};
+    ASSERT_EQ(receiveBuffer.use_count(), 3);
+
+    ASSERT_EQ(firstMessage.GetRemoteIndex(), 3u);
+    ASSERT_EQ(secondMessage.GetRemoteIndex(), 4u);
+    ASSERT_EQ(secondMessage.GetEndpointAddress(), endpointAddress);
+
+    const auto deserialized = secondMessage.Deserialize<SilKit::Services::PubSub::WireDataMessageEvent>();
+    ASSERT_EQ(deserialized.timestamp, event.timestamp);
+    ASSERT_TRUE(SilKit::Util::ItemsAreEqual(deserialized.data, event.data));
+
+    ASSERT_EQ(secondMessage.ReleaseStorage(), second);
+}
+
+TEST(Test_SerializedMessage, storage_is_reserved_with_the_body_size_of_the_previous_message)
+{
+    SilKit::Services::PubSub::WireDataMessageEvent event;
+    event.timestamp = std::chrono::nanoseconds{1234};
+
+    // a larger message than the previous one grows its storage on demand
+    for (size_t dataSize : {8u, 1000u, 8u})
+    {
+        event.data = std::vector<uint8_t>(dataSize, 0x2a);
+        SerializedMessage msg{event, EndpointAddress{1, 2}, 3};
+        ASSERT_EQ(SerializedSizeHint<SilKit::Services::PubSub::WireDataMessageEvent>::bodySize,
+                  SerializePayload(event)->size());
+
+        const auto deserialized = msg.Deserialize<SilKit::Services::PubSub::WireDataMessageEvent>();
+        ASSERT_EQ(deserialized.timestamp, event.timestamp);
+        ASSERT_TRUE(SilKit::Util::ItemsAreEqual(deserialized.data, event.data));
+    }
+}
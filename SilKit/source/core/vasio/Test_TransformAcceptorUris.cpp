@@ -167,6 +167,11 @@ struct DummyVAsioPeerBase : IVAsioPeer
     {
         throw MethodNotImplementedError{};
     }
+
+    auto GetSendQueueStatus() const -> SendQueueStatus final
+    {
+        throw MethodNotImplementedError{};
+    }
 };
 
 struct AdvertisedVAsioPeer final : DummyVAsioPeerBase
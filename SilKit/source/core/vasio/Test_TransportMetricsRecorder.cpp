@@ -0,0 +1,125 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "TransportMetricsRecorder.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace std::chrono_literals;
+using namespace SilKit::Core;
+
+TEST(Test_TransportMetricsRecorder, histogram_counts_durations_in_power_of_two_buckets)
+{
+    DurationRecorder recorder;
+    recorder.Record(0ns);
+    recorder.Record(1ns);
+    recorder.Record(1000ns);
+    recorder.Record(1023ns);
+    recorder.Record(-5ns);
+
+    const auto histogram = recorder.GetHistogram();
+    EXPECT_EQ(histogram.count, 5u);
+    EXPECT_EQ(histogram.total, 2024ns);
+    EXPECT_EQ(histogram.min, 0ns);
+    EXPECT_EQ(histogram.max, 1023ns);
+    EXPECT_EQ(histogram.buckets[0], 2u);
+    EXPECT_EQ(histogram.buckets[1], 1u);
+    EXPECT_EQ(histogram.buckets[10], 2u);
+
+    EXPECT_EQ(histogram.Mean(), 404ns);
+    EXPECT_EQ(histogram.Percentile(40), 0ns);
+    EXPECT_EQ(histogram.Percentile(60), 1ns);
+    EXPECT_EQ(histogram.Percentile(99), 1023ns);
+}
+
+TEST(Test_TransportMetricsRecorder, long_durations_are_counted_in_the_last_bucket)
+{
+    DurationRecorder recorder;
+    recorder.Record(3600s);
+
+    const auto histogram = recorder.GetHistogram();
+    EXPECT_EQ(histogram.buckets[DurationHistogram::NumBuckets - 1], 1u);
+    EXPECT_EQ(histogram.Percentile(50), 3600s);
+}
+
+TEST(Test_TransportMetricsRecorder, empty_histogram)
+{
+    const auto histogram = DurationRecorder{}.GetHistogram();
+    EXPECT_EQ(histogram.count, 0u);
+    EXPECT_EQ(histogram.min, 0ns);
+    EXPECT_EQ(histogram.Mean(), 0ns);
+    EXPECT_EQ(histogram.Percentile(50), 0ns);
+}
+
+TEST(Test_TransportMetricsRecorder, peers_and_links_are_created_once)
+{
+    TransportMetricsRecorder recorder;
+
+    auto* peer = recorder.GetPeer("Participant1");
+    EXPECT_EQ(recorder.GetPeer("Participant1"), peer);
+    EXPECT_NE(recorder.GetPeer("Participant2"), peer);
+    peer->RecordSent(2, 100);
+    peer->RecordReceived(1, 50);
+    peer->sendLatency.Record(10us);
+
+    auto* link = recorder.GetLink("DataMessageEvent", "Topic");
+    EXPECT_EQ(recorder.GetLink("DataMessageEvent", "Topic"), link);
+    EXPECT_NE(recorder.GetLink("DataMessageEvent", "Other"), link);
+    link->messagesSent += 3;
+    link->serializationTime.Record(1us);
+
+    recorder.ioBusyTime.Record(5us);
+    recorder.ioBusyTime.Record(5us);
+
+    const auto metrics = recorder.GetMetrics();
+    ASSERT_EQ(metrics.peers.size(), 2u);
+    const auto& peerMetrics = metrics.peers.at("Participant1");
+    EXPECT_EQ(peerMetrics.messagesSent, 2u);
+    EXPECT_EQ(peerMetrics.bytesSent, 100u);
+    EXPECT_EQ(peerMetrics.messagesReceived, 1u);
+    EXPECT_EQ(peerMetrics.bytesReceived, 50u);
+    EXPECT_EQ(peerMetrics.sendLatency.count, 1u);
+
+    ASSERT_EQ(metrics.links.size(), 2u);
+    const auto& linkMetrics = metrics.links.at("DataMessageEvent[Topic]");
+    EXPECT_EQ(linkMetrics.messagesSent, 3u);
+    EXPECT_EQ(linkMetrics.serializationTime.count, 1u);
+
+    EXPECT_EQ(metrics.ioBusyTime, 10us);
+    EXPECT_GE(metrics.elapsed, metrics.ioBusyTime);
+
+    const auto text = to_string(metrics);
+    EXPECT_NE(text.find("peer 'Participant1'"), std::string::npos);
+    EXPECT_NE(text.find("link DataMessageEvent[Topic]"), std::string::npos);
+}
+
+TEST(Test_TransportMetricsRecorder, scoped_measurement_without_recorder_does_nothing)
+{
+    DurationRecorder recorder;
+    {
+        ScopedDurationMeasurement measurement{nullptr};
+    }
+    {
+        ScopedDurationMeasurement measurement{&recorder};
+    }
+    EXPECT_EQ(recorder.GetHistogram().count, 1u);
+}
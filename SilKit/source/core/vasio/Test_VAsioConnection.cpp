@@ -132,6 +132,7 @@ struct MockVAsioPeer
     MOCK_METHOD(void, SetProtocolVersion, (ProtocolVersion), (override));
     MOCK_METHOD(ProtocolVersion, GetProtocolVersion, (), (const, override));
     MOCK_METHOD(void, DrainAllBuffers, (), (override));
+    MOCK_METHOD(SendQueueStatus, GetSendQueueStatus, (), (const, override));
 
     // IServiceEndpoint
     MOCK_METHOD(void, SetServiceDescriptor, (const ServiceDescriptor& serviceDescriptor), (override));
@@ -189,6 +190,31 @@ protected:
     {
         _connection.RegisterSilKitMsgReceiver<MessageT, ServiceT>(receiver);
     }
+
+    void SetSendQueuePolicy(SilKit::Config::Middleware::SendQueuePolicy policy)
+    {
+        _connection._config.middleware.sendQueueHighWatermark = 16;
+        _connection._config.middleware.sendQueuePolicy = policy;
+    }
+
+    void ApplySendQueuePolicy(const std::vector<std::string>& receiverNames)
+    {
+        if (_connection.HasOverflowingSendQueues())
+        {
+            _connection.ApplySendQueuePolicyToDroppableMessage(receiverNames);
+        }
+    }
+
+    void ExecuteOnIoThread(std::function<void()> function)
+    {
+        _connection.ExecuteOnIoThread(std::move(function));
+    }
+
+    //! Runs the handlers posted to the I/O thread, until there are none left
+    void RunIoThread()
+    {
+        _connection._ioContext->Run();
+    }
 };
 
 } // namespace Core
@@ -297,3 +323,59 @@ TEST_F(Test_VAsioConnection, DISABLED_versioned_send_testmessage)
 
     _connection.OnSocketData(&_from, std::move(buffer));
 }
+
+//////////////////////////////////////////////////////////////////////
+// Send queue policies
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(Test_VAsioConnection, send_queue_policy_only_applies_to_the_overflowing_receivers_of_a_message)
+{
+    SetSendQueuePolicy(SilKit::Config::Middleware::SendQueuePolicy::Error);
+    _connection.OnSendQueueOverflow(&_from, true);
+
+    // a message which is not sent to the overflowing peer is neither rejected nor counted
+    EXPECT_NO_THROW(ApplySendQueuePolicy({"OtherPeer"}));
+    EXPECT_EQ(_connection.GetSendQueueStatus().count("OtherPeer"), 0u);
+
+    EXPECT_THROW(ApplySendQueuePolicy({"OtherPeer", "MockVAsioPeer"}), SilKit::SilKitError);
+    auto status = _connection.GetSendQueueStatus();
+    EXPECT_EQ(status["MockVAsioPeer"].rejectedMessages, 1u);
+    EXPECT_EQ(status.count("OtherPeer"), 0u);
+
+    _connection.OnSendQueueOverflow(&_from, false);
+    EXPECT_NO_THROW(ApplySendQueuePolicy({"OtherPeer", "MockVAsioPeer"}));
+}
+
+//////////////////////////////////////////////////////////////////////
+// Message delivery
+//////////////////////////////////////////////////////////////////////
+
+TEST_F(Test_VAsioConnection, all_messages_delivered_callback_runs_before_returning_on_the_io_thread)
+{
+    std::vector<std::string> calls;
+    ExecuteOnIoThread([this, &calls] {
+        _connection.OnAllMessagesDelivered([&calls] {
+            calls.push_back("callback");
+        });
+        calls.push_back("returned");
+    });
+    RunIoThread();
+
+    EXPECT_EQ(calls, (std::vector<std::string>{"callback", "returned"}));
+}
+
+TEST_F(Test_VAsioConnection, all_messages_delivered_callback_runs_after_the_previous_sends_off_the_io_thread)
+{
+    std::vector<std::string> calls;
+    // stands in for a message sent from this thread, which the I/O thread queues for sending
+    ExecuteOnIoThread([&calls] {
+        calls.push_back("send");
+    });
+    _connection.OnAllMessagesDelivered([&calls] {
+        calls.push_back("callback");
+    });
+    EXPECT_TRUE(calls.empty());
+
+    RunIoThread();
+    EXPECT_EQ(calls, (std::vector<std::string>{"send", "callback"}));
+}
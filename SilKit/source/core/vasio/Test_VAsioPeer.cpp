@@ -0,0 +1,480 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "VAsioPeer.hpp"
+#include "VAsioConnection.hpp"
+#include "SerializedMessage.hpp"
+#include "MockParticipant.hpp"
+#include "TimeProvider.hpp"
+
+#include "silkit/participant/exception.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace SilKit::Core;
+
+// Runs dispatched functions inline, as if the caller was the I/O thread
+struct InlineIoContext : IIoContext
+{
+    void Run() override {}
+    void Post(std::function<void()> function) override
+    {
+        function();
+    }
+    void Dispatch(std::function<void()> function) override
+    {
+        function();
+    }
+    auto IsRunningInThisThread() -> bool override
+    {
+        return false;
+    }
+    auto ConnectTcp(const std::string&, uint16_t, std::error_code&) -> std::unique_ptr<IRawByteStream> override
+    {
+        return nullptr;
+    }
+    auto ConnectLocal(const std::string&, std::error_code&) -> std::unique_ptr<IRawByteStream> override
+    {
+        return nullptr;
+    }
+    auto MakeTcpAcceptor(const std::string&, uint16_t) -> std::unique_ptr<IAcceptor> override
+    {
+        return nullptr;
+    }
+    auto MakeLocalAcceptor(const std::string&) -> std::unique_ptr<IAcceptor> override
+    {
+        return nullptr;
+    }
+    auto MakeTimer() -> std::unique_ptr<ITimer> override
+    {
+        return nullptr;
+    }
+    auto Resolve(const std::string&) -> std::vector<std::string> override
+    {
+        return {};
+    }
+    void SetLogger(SilKit::Services::Logging::ILogger&) override {}
+};
+
+// Holds each write until it is completed by the test, and records the written bytes. The functions dispatched to the
+// strand of the stream are either run inline, or held until the test runs them.
+struct HeldWriteStream : IRawByteStream
+{
+    IIoContext* ioContext{nullptr};
+    IRawByteStreamListener* listener{nullptr};
+    std::vector<uint8_t>* written{nullptr};
+    std::vector<ConstBuffer> pendingWrite;
+    bool holdStrand{false};
+    bool isOnStrand{false};
+    bool wasWriteStartedOffStrand{false};
+    std::vector<std::function<void()>> heldStrandFunctions;
+
+    void SetListener(IRawByteStreamListener& newListener) override
+    {
+        listener = &newListener;
+    }
+    auto GetIoContext() -> IIoContext& override
+    {
+        return *ioContext;
+    }
+    auto GetLocalEndpoint() -> std::string override
+    {
+        return {};
+    }
+    auto GetRemoteEndpoint() -> std::string override
+    {
+        return {};
+    }
+    void AsyncReadSome(MutableBufferSequence) override {}
+    void AsyncWriteSome(ConstBufferSequence bufferSequence) override
+    {
+        wasWriteStartedOffStrand = wasWriteStartedOffStrand || (holdStrand && !isOnStrand);
+        pendingWrite.assign(bufferSequence.begin(), bufferSequence.end());
+    }
+    void Shutdown() override {}
+    void Dispatch(std::function<void()> function) override
+    {
+        if (holdStrand && !isOnStrand)
+        {
+            heldStrandFunctions.push_back(std::move(function));
+            return;
+        }
+        function();
+    }
+    void Post(std::function<void()> function) override
+    {
+        Dispatch(std::move(function));
+    }
+
+    void RunStrand()
+    {
+        isOnStrand = true;
+        for (size_t index = 0; index != heldStrandFunctions.size(); ++index)
+        {
+            heldStrandFunctions[index]();
+        }
+        heldStrandFunctions.clear();
+        isOnStrand = false;
+    }
+
+    auto CompleteWrite() -> bool
+    {
+        if (pendingWrite.empty())
+        {
+            return false;
+        }
+
+        size_t size{0};
+        for (const auto& buffer : pendingWrite)
+        {
+            const auto* data = static_cast<const uint8_t*>(buffer.GetData());
+            written->insert(written->end(), data, data + buffer.GetSize());
+            size += buffer.GetSize();
+        }
+        pendingWrite.clear();
+        // the completions run on the strand of the stream
+        isOnStrand = true;
+        listener->OnAsyncWriteSomeDone(*this, size);
+        isOnStrand = false;
+        return true;
+    }
+};
+
+struct CanEndpoint : IServiceEndpoint
+{
+    ServiceDescriptor serviceDescriptor{"Test_VAsioPeer", "CAN1", "CanController1", 5};
+
+    CanEndpoint() = default;
+    explicit CanEndpoint(ServiceDescriptor descriptor)
+        : serviceDescriptor{std::move(descriptor)}
+    {
+    }
+
+    void SetServiceDescriptor(const ServiceDescriptor& newServiceDescriptor) override
+    {
+        serviceDescriptor = newServiceDescriptor;
+    }
+    auto GetServiceDescriptor() const -> const ServiceDescriptor& override
+    {
+        return serviceDescriptor;
+    }
+};
+
+class Test_VAsioPeer : public testing::Test
+{
+protected:
+    void CreatePeer(SilKit::Config::ParticipantConfiguration config = {})
+    {
+        connection = std::make_unique<VAsioConnection>(nullptr, std::move(config), "Test_VAsioPeer", 1, &timeProvider);
+        connection->SetLogger(&logger);
+
+        auto newStream = std::make_unique<HeldWriteStream>();
+        newStream->ioContext = &ioContext;
+        newStream->written = &written;
+        stream = newStream.get();
+        peer = VAsioPeer::Create(std::move(newStream), connection.get(), &logger);
+    }
+
+    //! A message carrying the tag as its body, conflatable messages are keyed by their endpoint
+    static auto MakeMessage(uint8_t tag, EndpointId endpoint, bool conflatable = false, bool droppable = false)
+        -> SerializedMessage
+    {
+        auto payload = std::make_shared<const std::vector<uint8_t>>(std::vector<uint8_t>{tag});
+        SerializedMessage message{VAsioMsgKind::SilKitSimMsg, EndpointAddress{1, endpoint}, 7, payload};
+        message.SetConflatable(conflatable);
+        message.SetDroppable(droppable);
+        return message;
+    }
+
+    void Send(uint8_t tag, EndpointId endpoint, bool conflatable = false, bool droppable = false)
+    {
+        peer->SendSilKitMsg(MakeMessage(tag, endpoint, conflatable, droppable));
+    }
+
+    //! Fill the send queue of the peer named 'Peer' with bus frames, until it overflows
+    void OverflowSendQueue(SilKit::Config::Middleware::SendQueuePolicy policy)
+    {
+        SilKit::Config::ParticipantConfiguration config;
+        config.middleware.sendQueueHighWatermark = 200;
+        config.middleware.sendQueueLowWatermark = 100;
+        config.middleware.sendQueuePolicy = policy;
+        CreatePeer(config);
+        peer->SetInfo(VAsioPeerInfo{"Peer", 2, {}, {}});
+        SubscribeCanFrames();
+
+        Send(1, 10);
+        // the DropOldest policy keeps the queue below the high watermark, by dropping the oldest frames
+        for (uint8_t tag = 100;
+             peer->GetSendQueueStatus().queuedBytes <= 200 && peer->GetSendQueueStatus().droppedMessages == 0; ++tag)
+        {
+            Send(tag, 30, false, true);
+        }
+    }
+
+    //! The peer subscribes to the CAN frames on the network of the CAN endpoint
+    void SubscribeCanFrames()
+    {
+        using CanFrameTraits = SilKitMsgTraits<SilKit::Services::Can::WireCanFrameEvent>;
+        VAsioMsgSubscriber subscriber;
+        subscriber.receiverIdx = 1;
+        subscriber.networkName = canEndpoint.serviceDescriptor.GetNetworkName();
+        subscriber.msgTypeName = CanFrameTraits::SerdesName();
+        subscriber.version = CanFrameTraits::Version();
+        connection->OnSocketData(peer.get(), SerializedMessage{subscriber});
+    }
+
+    //! Send a CAN frame through the connection, as a CAN controller of this participant does
+    void SendCanFrame(IServiceEndpoint* from = nullptr)
+    {
+        connection->SendMsg(from != nullptr ? from : &canEndpoint, SilKit::Services::Can::WireCanFrameEvent{});
+    }
+
+    //! The tags of the written messages, in the order they were written
+    auto WrittenTags() -> std::vector<uint8_t>
+    {
+        while (stream->CompleteWrite())
+        {
+        }
+
+        std::vector<uint8_t> tags;
+        size_t position{0};
+        while (position < written.size())
+        {
+            uint32_t messageSize{0};
+            memcpy(&messageSize, written.data() + position, sizeof messageSize);
+            position += messageSize;
+            tags.push_back(written.at(position - 1));
+        }
+        return tags;
+    }
+
+protected:
+    testing::NiceMock<SilKit::Core::Tests::MockLogger> logger;
+    SilKit::Services::Orchestration::TimeProvider timeProvider;
+    CanEndpoint canEndpoint;
+    CanEndpoint otherNetworkCanEndpoint{ServiceDescriptor{"Test_VAsioPeer", "CAN2", "CanController2", 6}};
+    InlineIoContext ioContext;
+    std::unique_ptr<VAsioConnection> connection;
+    std::vector<uint8_t> written;
+    HeldWriteStream* stream{nullptr};
+    std::shared_ptr<VAsioPeer> peer;
+};
+
+TEST_F(Test_VAsioPeer, conflated_message_is_queued_at_the_tail)
+{
+    CreatePeer();
+
+    // the first message is being written, the following ones are queued
+    Send(1, 10);
+    Send(2, 20, true);
+    Send(3, 10);
+    Send(4, 20, true);
+    Send(5, 10);
+
+    const auto status = peer->GetSendQueueStatus();
+    EXPECT_EQ(status.conflatedMessages, 1u);
+    EXPECT_EQ(status.queuedMessages, 3u);
+
+    // the newer message of endpoint 20 does not overtake the message 3
+    EXPECT_EQ(WrittenTags(), (std::vector<uint8_t>{1, 3, 4, 5}));
+}
+
+TEST_F(Test_VAsioPeer, only_messages_of_the_same_sender_and_receiver_are_conflated)
+{
+    CreatePeer();
+
+    Send(1, 10);
+    Send(2, 20, true);
+    Send(3, 30, true);
+    Send(4, 20, true);
+    Send(5, 30, true);
+    Send(6, 20, true);
+
+    EXPECT_EQ(peer->GetSendQueueStatus().conflatedMessages, 3u);
+    EXPECT_EQ(WrittenTags(), (std::vector<uint8_t>{1, 5, 6}));
+}
+
+TEST_F(Test_VAsioPeer, conflation_follows_the_front_of_the_queue)
+{
+    CreatePeer();
+
+    Send(1, 10);
+    Send(2, 20, true);
+    Send(3, 10);
+    // writes the messages 2 and 3, message 4 is queued behind the write
+    ASSERT_TRUE(stream->CompleteWrite());
+    Send(4, 20, true);
+    Send(5, 10);
+    Send(6, 20, true);
+
+    EXPECT_EQ(peer->GetSendQueueStatus().conflatedMessages, 1u);
+    EXPECT_EQ(WrittenTags(), (std::vector<uint8_t>{1, 2, 3, 5, 6}));
+}
+
+TEST_F(Test_VAsioPeer, discarded_messages_do_not_accumulate)
+{
+    CreatePeer();
+
+    Send(1, 10);
+    for (uint8_t tag = 2; tag != 200; ++tag)
+    {
+        Send(tag, 20, true);
+    }
+
+    auto status = peer->GetSendQueueStatus();
+    EXPECT_EQ(status.conflatedMessages, 197u);
+    EXPECT_EQ(status.queuedMessages, 1u);
+    EXPECT_EQ(WrittenTags(), (std::vector<uint8_t>{1, 199}));
+}
+
+TEST_F(Test_VAsioPeer, conflation_index_is_rebuilt_after_dropping_frames)
+{
+    SilKit::Config::ParticipantConfiguration config;
+    config.middleware.sendQueueHighWatermark = 200;
+    config.middleware.sendQueueLowWatermark = 100;
+    config.middleware.sendQueuePolicy = SilKit::Config::Middleware::SendQueuePolicy::DropOldest;
+    CreatePeer(config);
+
+    Send(1, 10);
+    Send(2, 30, false, true);
+    Send(3, 20, true);
+    // fill the queue with droppable frames behind the conflatable one, until the oldest ones are dropped
+    for (uint8_t tag = 100; tag != 120; ++tag)
+    {
+        Send(tag, 30, false, true);
+    }
+    ASSERT_GT(peer->GetSendQueueStatus().droppedMessages, 0u);
+
+    Send(4, 20, true);
+
+    const auto tags = WrittenTags();
+    EXPECT_EQ(peer->GetSendQueueStatus().conflatedMessages, 1u);
+    EXPECT_EQ(std::count(tags.begin(), tags.end(), 3), 0);
+    EXPECT_EQ(std::count(tags.begin(), tags.end(), 4), 1);
+    EXPECT_EQ(tags.back(), 4);
+}
+
+TEST_F(Test_VAsioPeer, error_policy_rejects_bus_messages_on_the_sending_thread)
+{
+    OverflowSendQueue(SilKit::Config::Middleware::SendQueuePolicy::Error);
+
+    EXPECT_THROW(SendCanFrame(), SilKit::SilKitError);
+    EXPECT_EQ(connection->GetSendQueueStatus()["Peer"].rejectedMessages, 1u);
+
+    // only bus messages are rejected
+    EXPECT_NO_THROW(connection->SendMsg(&canEndpoint, SilKit::Services::PubSub::WireDataMessageEvent{}));
+
+    // the queue is drained below the low watermark
+    WrittenTags();
+    EXPECT_NO_THROW(SendCanFrame());
+    EXPECT_EQ(connection->GetSendQueueStatus()["Peer"].rejectedMessages, 1u);
+}
+
+TEST_F(Test_VAsioPeer, error_policy_ignores_overflowing_peers_which_do_not_receive_the_message)
+{
+    OverflowSendQueue(SilKit::Config::Middleware::SendQueuePolicy::Error);
+
+    // the overflowing peer does not subscribe to the CAN frames on the other network
+    EXPECT_NO_THROW(SendCanFrame(&otherNetworkCanEndpoint));
+    EXPECT_EQ(connection->GetSendQueueStatus()["Peer"].rejectedMessages, 0u);
+
+    EXPECT_THROW(SendCanFrame(), SilKit::SilKitError);
+    EXPECT_EQ(connection->GetSendQueueStatus()["Peer"].rejectedMessages, 1u);
+}
+
+TEST_F(Test_VAsioPeer, block_policy_blocks_the_sending_thread_until_the_queue_is_drained)
+{
+    OverflowSendQueue(SilKit::Config::Middleware::SendQueuePolicy::Block);
+
+    std::atomic<bool> sent{false};
+    std::thread sender{[this, &sent] {
+        SendCanFrame();
+        sent = true;
+    }};
+
+    while (connection->GetSendQueueStatus()["Peer"].blockedSends == 0)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    EXPECT_FALSE(sent);
+
+    WrittenTags();
+    sender.join();
+    EXPECT_TRUE(sent);
+    EXPECT_EQ(connection->GetSendQueueStatus()["Peer"].blockedSends, 1u);
+}
+
+TEST_F(Test_VAsioPeer, drop_oldest_policy_does_not_block_the_sending_thread)
+{
+    OverflowSendQueue(SilKit::Config::Middleware::SendQueuePolicy::DropOldest);
+
+    EXPECT_NO_THROW(SendCanFrame());
+
+    const auto status = connection->GetSendQueueStatus()["Peer"];
+    EXPECT_EQ(status.blockedSends, 0u);
+    EXPECT_EQ(status.rejectedMessages, 0u);
+}
+
+TEST_F(Test_VAsioPeer, drop_oldest_policy_returns_the_dropped_frames_to_the_buffer_pool)
+{
+    const auto before = GetSerializedMessageBufferPool().GetStatistics();
+    OverflowSendQueue(SilKit::Config::Middleware::SendQueuePolicy::DropOldest);
+    const auto after = GetSerializedMessageBufferPool().GetStatistics();
+
+    const auto status = peer->GetSendQueueStatus();
+    ASSERT_GT(status.droppedMessages, 0u);
+    EXPECT_EQ(after.released - before.released, status.droppedMessages);
+}
+
+TEST_F(Test_VAsioPeer, peer_with_own_strand_queues_and_writes_on_the_strand_of_the_socket)
+{
+    SilKit::Config::ParticipantConfiguration config;
+    config.middleware.ioWorkerThreads = 2;
+    CreatePeer(config);
+    ASSERT_TRUE(peer->HasOwnStrand());
+    stream->holdStrand = true;
+
+    Send(1, 10);
+    Send(2, 10);
+    Send(3, 10);
+
+    // the messages are only queued and written once the strand runs
+    EXPECT_EQ(peer->GetSendQueueStatus().queuedMessages, 0u);
+    EXPECT_TRUE(stream->pendingWrite.empty());
+
+    stream->RunStrand();
+
+    EXPECT_EQ(WrittenTags(), (std::vector<uint8_t>{1, 2, 3}));
+    EXPECT_FALSE(stream->wasWriteStartedOffStrand);
+}
+
+} // namespace
@@ -0,0 +1,217 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "VAsioTransmitter.hpp"
+#include "SerializedMessage.hpp"
+#include "DataSerdes.hpp"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace SilKit::Core;
+using SilKit::Services::PubSub::WireDataMessageEvent;
+using SilKit::Util::ContentFilter;
+
+// Records the data of the messages sent to it
+struct RecordingPeer : IVAsioPeer
+{
+    VAsioPeerInfo info;
+    std::vector<std::vector<uint8_t>> receivedData;
+    std::vector<bool> conflatable;
+
+    explicit RecordingPeer(const std::string& participantName)
+    {
+        info.participantName = participantName;
+        info.participantId = std::hash<std::string>{}(participantName);
+    }
+
+    void SendSilKitMsg(SerializedMessage buffer) override
+    {
+        conflatable.push_back(SerializedMessage{buffer}.ReleaseFrame().conflatable);
+        const auto msg = buffer.Deserialize<WireDataMessageEvent>();
+        const auto data = msg.data.AsSpan();
+        receivedData.emplace_back(data.begin(), data.end());
+    }
+    void Subscribe(VAsioMsgSubscriber) override {}
+    auto GetInfo() const -> const VAsioPeerInfo& override
+    {
+        return info;
+    }
+    void SetInfo(VAsioPeerInfo newInfo) override
+    {
+        info = std::move(newInfo);
+    }
+    auto GetRemoteAddress() const -> std::string override
+    {
+        return {};
+    }
+    auto GetLocalAddress() const -> std::string override
+    {
+        return {};
+    }
+    void StartAsyncRead() override {}
+    void DrainAllBuffers() override {}
+    void SetProtocolVersion(ProtocolVersion) override {}
+    auto GetProtocolVersion() const -> ProtocolVersion override
+    {
+        return CurrentProtocolVersion();
+    }
+    auto GetSendQueueStatus() const -> SendQueueStatus override
+    {
+        return {};
+    }
+};
+
+struct Publisher : IServiceEndpoint
+{
+    ServiceDescriptor serviceDescriptor;
+
+    void SetServiceDescriptor(const ServiceDescriptor& newServiceDescriptor) override
+    {
+        serviceDescriptor = newServiceDescriptor;
+    }
+    auto GetServiceDescriptor() const -> const ServiceDescriptor& override
+    {
+        return serviceDescriptor;
+    }
+};
+
+auto MakeMessage(uint8_t key) -> WireDataMessageEvent
+{
+    WireDataMessageEvent msg;
+    msg.timestamp = std::chrono::nanoseconds{1};
+    msg.data = std::vector<uint8_t>{key, 0xAA, 0xBB};
+    return msg;
+}
+
+auto MakeKeyFilter(uint8_t key) -> std::shared_ptr<const RemoteSubscription>
+{
+    RemoteSubscription subscription;
+    subscription.contentFilter = ContentFilter{{0, {key}, {}}};
+    return std::make_shared<const RemoteSubscription>(std::move(subscription));
+}
+
+auto MakeSubscription(bool latestValueOnly) -> std::shared_ptr<const RemoteSubscription>
+{
+    RemoteSubscription subscription;
+    subscription.latestValueOnly = latestValueOnly;
+    return std::make_shared<const RemoteSubscription>(std::move(subscription));
+}
+
+class Test_VAsioTransmitter : public testing::Test
+{
+protected:
+    void PublishKeys()
+    {
+        for (uint8_t key : {1, 2, 3})
+        {
+            transmitter.ReceiveMsg(&publisher, MakeMessage(key));
+        }
+    }
+
+    static auto KeysOf(const RecordingPeer& peer) -> std::vector<uint8_t>
+    {
+        std::vector<uint8_t> keys;
+        for (const auto& data : peer.receivedData)
+        {
+            keys.push_back(data.at(0));
+        }
+        return keys;
+    }
+
+protected:
+    VAsioTransmitter<WireDataMessageEvent> transmitter;
+    Publisher publisher;
+    RecordingPeer peerA{"A"};
+    RecordingPeer peerB{"B"};
+};
+
+TEST_F(Test_VAsioTransmitter, content_filter_of_single_receiver)
+{
+    transmitter.SetRemoteSubscription("A", 7, MakeKeyFilter(2));
+    transmitter.AddRemoteReceiver(&peerA, 1);
+
+    PublishKeys();
+
+    EXPECT_EQ(KeysOf(peerA), (std::vector<uint8_t>{2}));
+}
+
+TEST_F(Test_VAsioTransmitter, content_filters_per_receiver)
+{
+    transmitter.AddRemoteReceiver(&peerA, 1);
+    transmitter.AddRemoteReceiver(&peerB, 1);
+    // the filter may be known after the receiver subscribed
+    transmitter.SetRemoteSubscription("A", 7, MakeKeyFilter(2));
+    transmitter.SetRemoteSubscription("A", 8, MakeKeyFilter(3));
+
+    PublishKeys();
+
+    EXPECT_EQ(KeysOf(peerA), (std::vector<uint8_t>{2, 3}));
+    // participants without known subscribers receive all messages
+    EXPECT_EQ(KeysOf(peerB), (std::vector<uint8_t>{1, 2, 3}));
+}
+
+TEST_F(Test_VAsioTransmitter, subscriber_without_content_filter_receives_all)
+{
+    transmitter.AddRemoteReceiver(&peerA, 1);
+    transmitter.AddRemoteReceiver(&peerB, 1);
+    transmitter.SetRemoteSubscription("A", 7, MakeKeyFilter(2));
+    transmitter.SetRemoteSubscription("A", 8, MakeSubscription(false));
+
+    PublishKeys();
+    EXPECT_EQ(KeysOf(peerA), (std::vector<uint8_t>{1, 2, 3}));
+
+    // removing the subscriber without filter restores the filter of the other one
+    transmitter.SetRemoteSubscription("A", 8, nullptr);
+    peerA.receivedData.clear();
+
+    PublishKeys();
+    EXPECT_EQ(KeysOf(peerA), (std::vector<uint8_t>{2}));
+}
+
+TEST_F(Test_VAsioTransmitter, latest_value_only_if_all_subscribers_of_participant_want_it)
+{
+    transmitter.AddRemoteReceiver(&peerA, 1);
+    transmitter.AddRemoteReceiver(&peerB, 1);
+    transmitter.SetRemoteSubscription("A", 7, MakeSubscription(true));
+    transmitter.SetRemoteSubscription("B", 7, MakeSubscription(true));
+    transmitter.SetRemoteSubscription("B", 8, MakeSubscription(false));
+
+    transmitter.ReceiveMsg(&publisher, MakeMessage(1));
+    EXPECT_EQ(peerA.conflatable, (std::vector<bool>{true}));
+    EXPECT_EQ(peerB.conflatable, (std::vector<bool>{false}));
+
+    // the single receiver is served by a separate code path
+    transmitter.RemoveRemoteReceiver(&peerB);
+    transmitter.ReceiveMsg(&publisher, MakeMessage(2));
+    EXPECT_EQ(peerA.conflatable, (std::vector<bool>{true, true}));
+
+    transmitter.SetRemoteSubscription("A", 7, nullptr);
+    transmitter.ReceiveMsg(&publisher, MakeMessage(3));
+    EXPECT_EQ(peerA.conflatable, (std::vector<bool>{true, true, false}));
+}
+
+} // namespace
@@ -0,0 +1,166 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "TransportMetricsRecorder.hpp"
+
+#include <algorithm>
+
+namespace {
+
+// bit width of the duration in nanoseconds, i.e., the index of the histogram bucket
+auto BucketIndex(int64_t nanoseconds) -> size_t
+{
+    size_t index{0};
+    for (auto value = static_cast<uint64_t>(nanoseconds); value != 0; value >>= 1)
+    {
+        index += 1;
+    }
+    return (std::min)(index, SilKit::Core::DurationHistogram::NumBuckets - 1);
+}
+
+} // namespace
+
+namespace SilKit {
+namespace Core {
+
+void DurationRecorder::Record(std::chrono::nanoseconds duration)
+{
+    const auto nanoseconds = (std::max)(duration.count(), std::chrono::nanoseconds::rep{0});
+
+    _count.fetch_add(1, std::memory_order_relaxed);
+    _total.fetch_add(nanoseconds, std::memory_order_relaxed);
+    _buckets[BucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+
+    auto min = _min.load(std::memory_order_relaxed);
+    while (nanoseconds < min && !_min.compare_exchange_weak(min, nanoseconds, std::memory_order_relaxed))
+    {
+    }
+    auto max = _max.load(std::memory_order_relaxed);
+    while (nanoseconds > max && !_max.compare_exchange_weak(max, nanoseconds, std::memory_order_relaxed))
+    {
+    }
+}
+
+auto DurationRecorder::GetHistogram() const -> DurationHistogram
+{
+    DurationHistogram histogram;
+    histogram.count = _count.load(std::memory_order_relaxed);
+    if (histogram.count == 0)
+    {
+        return histogram;
+    }
+
+    histogram.total = std::chrono::nanoseconds{_total.load(std::memory_order_relaxed)};
+    histogram.min = std::chrono::nanoseconds{_min.load(std::memory_order_relaxed)};
+    histogram.max = std::chrono::nanoseconds{_max.load(std::memory_order_relaxed)};
+    for (size_t index = 0; index != DurationHistogram::NumBuckets; ++index)
+    {
+        histogram.buckets[index] = _buckets[index].load(std::memory_order_relaxed);
+    }
+    return histogram;
+}
+
+void PeerMetricsRecorder::RecordSent(size_t messages, size_t bytes)
+{
+    messagesSent.fetch_add(messages, std::memory_order_relaxed);
+    bytesSent.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void PeerMetricsRecorder::RecordReceived(size_t messages, size_t bytes)
+{
+    messagesReceived.fetch_add(messages, std::memory_order_relaxed);
+    bytesReceived.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+auto PeerMetricsRecorder::GetMetrics() const -> PeerMetrics
+{
+    PeerMetrics metrics;
+    metrics.messagesSent = messagesSent.load(std::memory_order_relaxed);
+    metrics.bytesSent = bytesSent.load(std::memory_order_relaxed);
+    metrics.messagesReceived = messagesReceived.load(std::memory_order_relaxed);
+    metrics.bytesReceived = bytesReceived.load(std::memory_order_relaxed);
+    metrics.sendLatency = sendLatency.GetHistogram();
+    return metrics;
+}
+
+auto LinkMetricsRecorder::GetMetrics() const -> LinkMetrics
+{
+    LinkMetrics metrics;
+    metrics.messagesSent = messagesSent.load(std::memory_order_relaxed);
+    metrics.messagesReceived = messagesReceived.load(std::memory_order_relaxed);
+    metrics.serializationTime = serializationTime.GetHistogram();
+    metrics.deserializationTime = deserializationTime.GetHistogram();
+    metrics.callbackTime = callbackTime.GetHistogram();
+    return metrics;
+}
+
+TransportMetricsRecorder::TransportMetricsRecorder()
+    : _startTime{Clock::now()}
+{
+}
+
+auto TransportMetricsRecorder::GetPeer(const std::string& participantName) -> PeerMetricsRecorder*
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    auto& peer = _peers[participantName];
+    if (peer == nullptr)
+    {
+        peer = std::make_unique<PeerMetricsRecorder>();
+    }
+    return peer.get();
+}
+
+auto TransportMetricsRecorder::GetLink(const std::string& msgTypeName, const std::string& networkName)
+    -> LinkMetricsRecorder*
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    auto& link = _links[msgTypeName + "[" + networkName + "]"];
+    if (link == nullptr)
+    {
+        link = std::make_unique<LinkMetricsRecorder>();
+    }
+    return link.get();
+}
+
+auto TransportMetricsRecorder::GetMetrics() const -> TransportMetrics
+{
+    TransportMetrics metrics;
+    metrics.elapsed = Clock::now() - _startTime;
+    metrics.ioBusyTime = ioBusyTime.GetHistogram().total;
+    metrics.sendDispatchDelay = sendDispatchDelay.GetHistogram();
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    for (const auto& kv : _peers)
+    {
+        metrics.peers[kv.first] = kv.second->GetMetrics();
+    }
+    for (const auto& kv : _links)
+    {
+        metrics.links[kv.first] = kv.second->GetMetrics();
+    }
+    return metrics;
+}
+
+} // namespace Core
+} // namespace SilKit
@@ -0,0 +1,139 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "TransportMetrics.hpp"
+
+namespace SilKit {
+namespace Core {
+
+//! Thread-safe recorder of a DurationHistogram. Recording is lock-free, such that it can be used on the I/O thread.
+class DurationRecorder
+{
+public:
+    void Record(std::chrono::nanoseconds duration);
+
+    auto GetHistogram() const -> DurationHistogram;
+
+private:
+    std::atomic<uint64_t> _count{0};
+    std::atomic<int64_t> _total{0};
+    std::atomic<int64_t> _min{(std::numeric_limits<int64_t>::max)()};
+    std::atomic<int64_t> _max{0};
+    std::array<std::atomic<uint64_t>, DurationHistogram::NumBuckets> _buckets{};
+};
+
+struct PeerMetricsRecorder
+{
+    std::atomic<uint64_t> messagesSent{0};
+    std::atomic<uint64_t> bytesSent{0};
+    std::atomic<uint64_t> messagesReceived{0};
+    std::atomic<uint64_t> bytesReceived{0};
+    DurationRecorder sendLatency;
+
+    void RecordSent(size_t messages, size_t bytes);
+    void RecordReceived(size_t messages, size_t bytes);
+
+    //! The metrics without the send queue status, which is kept by the peer
+    auto GetMetrics() const -> PeerMetrics;
+};
+
+struct LinkMetricsRecorder
+{
+    std::atomic<uint64_t> messagesSent{0};
+    std::atomic<uint64_t> messagesReceived{0};
+    DurationRecorder serializationTime;
+    DurationRecorder deserializationTime;
+    DurationRecorder callbackTime;
+
+    auto GetMetrics() const -> LinkMetrics;
+};
+
+//! Collects the transport metrics of a connection. The recorders of peers and links are created on first use and
+//! stay valid for the lifetime of the TransportMetricsRecorder.
+class TransportMetricsRecorder
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    TransportMetricsRecorder();
+
+    auto GetPeer(const std::string& participantName) -> PeerMetricsRecorder*;
+    auto GetLink(const std::string& msgTypeName, const std::string& networkName) -> LinkMetricsRecorder*;
+
+    //! The metrics without the send queue status and the buffer pool statistics, which are kept elsewhere
+    auto GetMetrics() const -> TransportMetrics;
+
+public:
+    DurationRecorder sendDispatchDelay;
+    //! Duration of the handlers on the I/O thread which send or process messages
+    DurationRecorder ioBusyTime;
+
+private:
+    Clock::time_point _startTime;
+
+    mutable std::mutex _mutex;
+    std::map<std::string, std::unique_ptr<PeerMetricsRecorder>> _peers;
+    std::map<std::string, std::unique_ptr<LinkMetricsRecorder>> _links;
+};
+
+//! Measures the time between construction and destruction, if a recorder is given
+class ScopedDurationMeasurement
+{
+public:
+    explicit ScopedDurationMeasurement(DurationRecorder* recorder)
+        : _recorder{recorder}
+    {
+        if (_recorder != nullptr)
+        {
+            _start = TransportMetricsRecorder::Clock::now();
+        }
+    }
+
+    ~ScopedDurationMeasurement()
+    {
+        if (_recorder != nullptr)
+        {
+            _recorder->Record(TransportMetricsRecorder::Clock::now() - _start);
+        }
+    }
+
+    ScopedDurationMeasurement(const ScopedDurationMeasurement&) = delete;
+    ScopedDurationMeasurement& operator=(const ScopedDurationMeasurement&) = delete;
+
+private:
+    DurationRecorder* _recorder;
+    TransportMetricsRecorder::Clock::time_point _start;
+};
+
+} // namespace Core
+} // namespace SilKit
@@ -19,6 +19,8 @@
 // OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 // WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
+#pragma once
+
 #include <string>
 #include <unordered_set>
 
@@ -48,6 +50,8 @@ namespace Capabilities {
 const auto ProxyMessage = CapabilityLiteral{ "proxy-message" };
 const auto AutonomousSynchronous = CapabilityLiteral{ "autonomous-synchronous" };
 const auto RequestParticipantConnection = CapabilityLiteral{ "request-participant-connection" };
+const auto SharedMemory = CapabilityLiteral{ "shared-memory" };
+const auto MessageBatching = CapabilityLiteral{ "message-batching" };
 }
 
 
@@ -28,9 +28,12 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <chrono>
 #include <thread>
 #include <array>
+#include <exception>
 #include <functional>
 #include <cctype>
+#include <fstream>
 #include <map>
+#include <iterator>
 
 #include "ILogger.hpp"
 #include "VAsioPeer.hpp"
@@ -40,6 +43,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "Uri.hpp"
 #include "Assert.hpp"
 #include "TransformAcceptorUris.hpp"
+#include "MakeSharedMemoryRawByteStream.hpp"
 
 #include "util/TracingMacros.hpp"
 
@@ -188,6 +192,13 @@ auto GetCurrentCapabilities(const SilKit::Config::ParticipantConfiguration& part
 
     capabilities.AddCapability(SilKit::Core::Capabilities::AutonomousSynchronous);
     capabilities.AddCapability(SilKit::Core::Capabilities::RequestParticipantConnection);
+    // receiving message batches is always supported, sending them is enabled via the configuration
+    capabilities.AddCapability(SilKit::Core::Capabilities::MessageBatching);
+
+    if (participantConfiguration.middleware.enableSharedMemory && SilKit::Core::IsSharedMemoryTransportSupported())
+    {
+        capabilities.AddCapability(SilKit::Core::Capabilities::SharedMemory);
+    }
 
     return capabilities.ToCapabilitiesString();
 }
@@ -259,12 +270,29 @@ VAsioConnection::VAsioConnection(
     socketOptions.tcp.sendBufferSize = _config.middleware.tcpSendBufferSize;
     socketOptions.tcp.receiveBufferSize = _config.middleware.tcpReceiveBufferSize;
 
-    _ioContext = MakeAsioIoContext(socketOptions);
+    AsioIoContextOptions ioContextOptions{};
+    ioContextOptions.ioWorkerThreads = static_cast<size_t>((std::max)(_config.middleware.ioWorkerThreads, 1));
+    ioContextOptions.dedicatedDispatchThread = _config.middleware.dedicatedDispatchThread;
+
+    _ioContext = MakeAsioIoContext(socketOptions, ioContextOptions);
+
+    if (_config.middleware.enableTransportMetrics)
+    {
+        _metrics = std::make_unique<TransportMetricsRecorder>();
+
+        if (_config.middleware.transportMetricsInterval > 0)
+        {
+            _metricsDumpTimer = _ioContext->MakeTimer();
+            _metricsDumpTimer->SetListener(*this);
+            _metricsDumpTimer->AsyncWaitFor(std::chrono::milliseconds{_config.middleware.transportMetricsInterval});
+        }
+    }
 }
 
 VAsioConnection::~VAsioConnection()
 {
     _isShuttingDown = true;
+    WakeUpBlockedSenders();
 
     _ioContext->Post([this] {
         {
@@ -274,6 +302,11 @@ VAsioConnection::~VAsioConnection()
             {
                 acceptor->Shutdown();
             }
+
+            for (const auto& acceptor : _inProcessAcceptors)
+            {
+                acceptor->Shutdown();
+            }
         }
 
         {
@@ -298,6 +331,22 @@ VAsioConnection::~VAsioConnection()
         {
             _registry->DrainAllBuffers();
         }
+
+        if (_messageBatchFlushTimer != nullptr)
+        {
+            _messageBatchFlushTimer->Shutdown();
+        }
+
+        if (_metricsDumpTimer != nullptr)
+        {
+            DumpTransportMetrics();
+            _metricsDumpTimer->Shutdown();
+        }
+
+        for (const auto& deferredTimer : _deferredTimers)
+        {
+            deferredTimer.second.timer->Shutdown();
+        }
     });
 
     StartIoWorker();
@@ -402,6 +451,8 @@ void VAsioConnection::OpenLocalAcceptors(const std::vector<std::string>& accepto
                     std::unique_lock<decltype(_acceptorsMutex)> lock{_acceptorsMutex};
                     _acceptors.emplace_back(std::move(acceptor));
                 }
+
+                AcceptInProcessConnections(uri.Path());
             }
             catch (const std::exception& exception)
             {
@@ -707,10 +758,13 @@ void VAsioConnection::SendParticipantAnnouncementReply(IVAsioPeer* peer)
     reply.remoteHeader = MakeRegistryMsgHeader(peer->GetProtocolVersion());
     reply.status = ParticipantAnnouncementReply::Status::Success;
     // fill in the service descriptors we want to subscribe to
-    std::transform(_vasioReceivers.begin(), _vasioReceivers.end(), std::back_inserter(reply.subscribers),
-                   [](const auto& subscriber) {
-                       return subscriber->GetDescriptor();
-                   });
+    {
+        std::unique_lock<decltype(_vasioReceiversMx)> lock{_vasioReceiversMx};
+        std::transform(_vasioReceivers.begin(), _vasioReceivers.end(), std::back_inserter(reply.subscribers),
+                       [](const auto& subscriber) {
+                           return subscriber->GetDescriptor();
+                       });
+    }
 
     Services::Logging::Debug(_logger, "Sending ParticipantAnnouncementReply to '{}' with protocol version {}",
                              peer->GetInfo().participantName, ExtractProtocolVersion(reply.remoteHeader));
@@ -1066,6 +1120,8 @@ void VAsioConnection::AcceptLocalConnections(const std::string& uniqueId)
             std::unique_lock<decltype(_acceptorsMutex)> lock{_acceptorsMutex};
             _acceptors.emplace_back(std::move(acceptor));
         }
+
+        AcceptInProcessConnections(localEndpoint.path());
     }
     catch (const std::exception& exception)
     {
@@ -1075,6 +1131,21 @@ void VAsioConnection::AcceptLocalConnections(const std::string& uniqueId)
     }
 }
 
+void VAsioConnection::AcceptInProcessConnections(const std::string& socketPath)
+{
+    if (!_config.middleware.enableInProcessTransport)
+    {
+        return;
+    }
+
+    auto acceptor{MakeInProcessAcceptor(*_ioContext, socketPath, *this, *_logger)};
+
+    {
+        std::unique_lock<decltype(_acceptorsMutex)> lock{_acceptorsMutex};
+        _inProcessAcceptors.emplace_back(std::move(acceptor));
+    }
+}
+
 auto VAsioConnection::AcceptTcpConnectionsOn(const std::string& hostName, uint16_t port)
     -> std::pair<std::string, uint16_t>
 {
@@ -1185,6 +1256,7 @@ void VAsioConnection::OnPeerShutdown(IVAsioPeer* peer)
 
             RemovePeerFromLinks(peer);
             RemovePeerFromConnection(peer);
+            _remoteServiceEndpoints.RemovePeer(peer);
         }
     }
 }
@@ -1242,6 +1314,95 @@ void VAsioConnection::RemovePeerFromConnection(IVAsioPeer* peer)
     }
 }
 
+void VAsioConnection::OnAllMessagesDelivered(std::function<void()> callback)
+{
+    // the messages sent on the I/O thread are already queued, so the callback runs before returning
+    if (_ioContext->IsRunningInThisThread())
+    {
+        FlushMessageBatches();
+        callback();
+        return;
+    }
+
+    // the messages sent from other threads are queued by the I/O thread, in the order they were sent
+    ExecuteOnIoThread([this, callback = std::move(callback)] {
+        FlushMessageBatches();
+        callback();
+    });
+}
+
+void VAsioConnection::FlushSendBuffers()
+{
+    ExecuteOnIoThread([this] {
+        FlushMessageBatches();
+    });
+}
+
+void VAsioConnection::ScheduleMessageBatchFlush()
+{
+    if (_messageBatchFlushScheduled.exchange(true))
+    {
+        return;
+    }
+
+    ExecuteOnIoThread([this] {
+        if (_isShuttingDown)
+        {
+            return;
+        }
+
+        if (_messageBatchFlushTimer == nullptr)
+        {
+            _messageBatchFlushTimer = _ioContext->MakeTimer();
+            _messageBatchFlushTimer->SetListener(*this);
+        }
+
+        const auto maxDelay = std::chrono::milliseconds{(std::max)(_config.middleware.messageBatchMaxDelay, 0)};
+        _messageBatchFlushTimer->AsyncWaitFor(maxDelay);
+    });
+}
+
+void VAsioConnection::ExecuteDeferredAt(std::chrono::steady_clock::time_point deadline,
+                                        std::function<void()> function)
+{
+    ExecuteOnIoThread([this, deadline, function = std::move(function)]() mutable {
+        if (_isShuttingDown)
+        {
+            return;
+        }
+
+        auto timer = _ioContext->MakeTimer();
+        timer->SetListener(*this);
+        timer->AsyncWaitUntil(deadline);
+
+        auto* timerPtr = timer.get();
+        _deferredTimers.emplace(timerPtr, DeferredTimer{std::move(timer), std::move(function)});
+    });
+}
+
+void VAsioConnection::FlushMessageBatches()
+{
+    if (_isShuttingDown)
+    {
+        return;
+    }
+
+    std::unique_lock<decltype(_peersLock)> lock{_peersLock};
+
+    for (const auto& peer : _peers)
+    {
+        if (auto* vasioPeer = dynamic_cast<VAsioPeer*>(peer.get()))
+        {
+            vasioPeer->FlushMessageBatch();
+        }
+    }
+
+    if (auto* registry = dynamic_cast<VAsioPeer*>(_registry.get()))
+    {
+        registry->FlushMessageBatch();
+    }
+}
+
 void VAsioConnection::HandleExpiredConnection()
 {
     SilKit::Services::Logging::Debug(_logger, "Remote connection time out reached. Number of remote connections: {}", _pendingRemoteConnections.size());
@@ -1319,10 +1480,13 @@ void VAsioConnection::RemovePeerFromPendingLists(IVAsioPeer* from)
 void VAsioConnection::NotifyShutdown()
 {
     _isShuttingDown = true;
+    WakeUpBlockedSenders();
 }
 
 void VAsioConnection::OnSocketData(IVAsioPeer* from, SerializedMessage&& buffer)
 {
+    ScopedDurationMeasurement measurement{_metrics != nullptr ? &_metrics->ioBusyTime : nullptr};
+
     auto messageKind = buffer.GetMessageKind();
     switch (messageKind)
     {
@@ -1341,6 +1505,10 @@ void VAsioConnection::OnSocketData(IVAsioPeer* from, SerializedMessage&& buffer)
         return ReceiveRegistryMessage(from, std::move(buffer));
     case VAsioMsgKind::SilKitProxyMessage:
         return ReceiveProxyMessage(from, std::move(buffer));
+    case VAsioMsgKind::SilKitMessageBatch:
+        // message batches are unpacked by the peer, they are never nested
+        _logger->Warn("Received nested message with VAsioMsgKind::SilKitMessageBatch");
+        break;
     }
 }
 
@@ -1559,10 +1727,21 @@ bool VAsioConnection::TryAddRemoteSubscriber(IVAsioPeer* from, const VAsioMsgSub
     return wasAdded;
 }
 
+auto VAsioConnection::FindVAsioReceiver(size_t receiverIdx) const -> IVAsioReceiver*
+{
+    std::unique_lock<decltype(_vasioReceiversMx)> lock{_vasioReceiversMx};
+    if (receiverIdx >= _vasioReceivers.size())
+    {
+        return nullptr;
+    }
+    return _vasioReceivers[receiverIdx].get();
+}
+
 void VAsioConnection::ReceiveRawSilKitMessage(IVAsioPeer* from, SerializedMessage&& buffer)
 {
     auto receiverIdx = static_cast<size_t>(buffer.GetRemoteIndex());//ExtractEndpointId(buffer);
-    if (receiverIdx >= _vasioReceivers.size())
+    auto* receiver = FindVAsioReceiver(receiverIdx);
+    if (receiver == nullptr)
     {
         Services::Logging::Warn(_logger, "Ignoring RawSilKitMessage for unknown receiverIdx={}", receiverIdx);
         return;
@@ -1570,11 +1749,42 @@ void VAsioConnection::ReceiveRawSilKitMessage(IVAsioPeer* from, SerializedMessag
 
     auto endpoint = buffer.GetEndpointAddress(); //ExtractEndpointAddress(buffer);
 
-    auto* fromService = dynamic_cast<IServiceEndpoint*>(from);
-    ServiceDescriptor tmpService(fromService->GetServiceDescriptor());
-    tmpService.SetServiceId(endpoint.endpoint);
+    const auto* remoteEndpoint = _remoteServiceEndpoints.GetOrCreate(from, endpoint.endpoint);
 
-    _vasioReceivers[receiverIdx]->ReceiveRawMsg(from, tmpService, std::move(buffer));
+    receiver->ReceiveRawMsg(from, *remoteEndpoint, std::move(buffer));
+}
+
+auto VAsioConnection::DeserializeRawSilKitMessage(IVAsioPeer* from, SerializedMessage&& buffer)
+    -> std::function<void()>
+{
+    auto* receiver = FindVAsioReceiver(static_cast<size_t>(buffer.GetRemoteIndex()));
+    if (receiver == nullptr)
+    {
+        return [this, from, buffer = std::move(buffer)]() mutable {
+            ReceiveRawSilKitMessage(from, std::move(buffer));
+        };
+    }
+
+    const auto endpoint = buffer.GetEndpointAddress();
+
+    std::function<void(const IServiceEndpoint&)> distribute;
+    try
+    {
+        distribute = receiver->DeserializeRawMsg(std::move(buffer));
+    }
+    catch (...)
+    {
+        // the error is raised on the I/O thread, as if the message was deserialized there
+        return [error = std::current_exception()] {
+            std::rethrow_exception(error);
+        };
+    }
+
+    // the senders of the received messages are only interned on the I/O thread
+    return [this, from, endpoint, distribute = std::move(distribute)] {
+        const auto* remoteEndpoint = _remoteServiceEndpoints.GetOrCreate(from, endpoint.endpoint);
+        distribute(*remoteEndpoint);
+    };
 }
 
 void VAsioConnection::RegisterMessageReceiver(std::function<void(IVAsioPeer* peer, ParticipantAnnouncement)> callback)
@@ -1679,6 +1889,139 @@ auto VAsioConnection::GetParticipantNamesOfRemoteReceivers(const IServiceEndpoin
     return result;
 }
 
+auto VAsioConnection::GetSendQueueStatus() -> std::map<std::string, SendQueueStatus>
+{
+    std::map<std::string, SendQueueStatus> result;
+
+    {
+        std::unique_lock<decltype(_peersLock)> lock{_peersLock};
+        for (const auto& peer : _peers)
+        {
+            result[peer->GetInfo().participantName] = peer->GetSendQueueStatus();
+        }
+    }
+
+    std::unique_lock<decltype(_sendQueueOverflowMutex)> lock{_sendQueueOverflowMutex};
+    for (const auto& kv : _sendQueuePolicyCounters)
+    {
+        auto& status = result[kv.first];
+        status.blockedSends += kv.second.blockedSends;
+        status.rejectedMessages += kv.second.rejectedMessages;
+    }
+
+    return result;
+}
+
+void VAsioConnection::OnSendQueueOverflow(IVAsioPeer* peer, bool isOverflowing)
+{
+    {
+        std::unique_lock<decltype(_sendQueueOverflowMutex)> lock{_sendQueueOverflowMutex};
+        if (isOverflowing)
+        {
+            _overflowingSendQueues.insert(peer->GetInfo().participantName);
+            _hasOverflowingSendQueues.store(true, std::memory_order_release);
+            return;
+        }
+        _overflowingSendQueues.erase(peer->GetInfo().participantName);
+        _hasOverflowingSendQueues.store(!_overflowingSendQueues.empty(), std::memory_order_release);
+    }
+    // the blocked senders wait for the queues of their receivers only, any drained queue may release them
+    _sendQueueDrained.notify_all();
+}
+
+void VAsioConnection::ApplySendQueuePolicyToDroppableMessage(const std::vector<std::string>& receiverNames)
+{
+    const auto& middleware = _config.middleware;
+    if (middleware.sendQueueHighWatermark <= 0
+        || middleware.sendQueuePolicy == SilKit::Config::Middleware::SendQueuePolicy::DropOldest)
+    {
+        return;
+    }
+
+    std::unique_lock<decltype(_sendQueueOverflowMutex)> lock{_sendQueueOverflowMutex};
+    const auto isOverflowing = [this](const std::string& participantName) {
+        return _overflowingSendQueues.count(participantName) != 0;
+    };
+
+    std::vector<std::string> overflowingReceivers;
+    std::copy_if(receiverNames.begin(), receiverNames.end(), std::back_inserter(overflowingReceivers), isOverflowing);
+    if (overflowingReceivers.empty())
+    {
+        return;
+    }
+
+    if (middleware.sendQueuePolicy == SilKit::Config::Middleware::SendQueuePolicy::Error)
+    {
+        for (const auto& participantName : overflowingReceivers)
+        {
+            _sendQueuePolicyCounters[participantName].rejectedMessages += 1;
+        }
+        throw SilKitError{"VAsioConnection: Send queue to participant '" + overflowingReceivers.front()
+                          + "' is full, the message was not sent"};
+    }
+
+    // the I/O thread drains the queues, it must never wait for them
+    if (_ioContext->IsRunningInThisThread())
+    {
+        return;
+    }
+
+    for (const auto& participantName : overflowingReceivers)
+    {
+        _sendQueuePolicyCounters[participantName].blockedSends += 1;
+    }
+    _sendQueueDrained.wait(lock, [this, &overflowingReceivers, &isOverflowing] {
+        return _isShuttingDown
+               || std::none_of(overflowingReceivers.begin(), overflowingReceivers.end(), isOverflowing);
+    });
+}
+
+void VAsioConnection::WakeUpBlockedSenders()
+{
+    {
+        // the waiting senders check the shutdown flag while holding the lock
+        std::unique_lock<decltype(_sendQueueOverflowMutex)> lock{_sendQueueOverflowMutex};
+    }
+    _sendQueueDrained.notify_all();
+}
+
+auto VAsioConnection::GetTransportMetrics() -> TransportMetrics
+{
+    if (_metrics == nullptr)
+    {
+        return {};
+    }
+
+    auto metrics = _metrics->GetMetrics();
+    metrics.bufferPool = GetSerializedMessageBufferPool().GetStatistics();
+
+    for (const auto& kv : GetSendQueueStatus())
+    {
+        metrics.peers[kv.first].sendQueue = kv.second;
+    }
+
+    return metrics;
+}
+
+void VAsioConnection::DumpTransportMetrics()
+{
+    const auto metrics = to_string(GetTransportMetrics());
+
+    const auto& path = _config.middleware.transportMetricsFile;
+    if (path.empty())
+    {
+        Services::Logging::Info(_logger, "{}", metrics);
+        return;
+    }
+
+    std::ofstream file{path, std::ios::app};
+    file << metrics << std::endl;
+    if (!file)
+    {
+        Services::Logging::Warn(_logger, "Unable to write the transport metrics to '{}'", path);
+    }
+}
+
 void VAsioConnection::SyncSubscriptionsCompleted()
 {
     _receivedAllSubscriptionAcknowledges.set_value();
@@ -1722,6 +2065,16 @@ void VAsioConnection::OnAsyncAcceptSuccess(IAcceptor& acceptor, std::unique_ptr<
 
     try
     {
+        if (_config.middleware.enableSharedMemory && IsSharedMemoryTransportSupported()
+            && Uri{acceptor.GetLocalEndpoint()}.Type() == Uri::UriType::Local)
+        {
+            // the peer decides whether to offer shared memory, plain connections are passed through
+            SharedMemoryRawByteStreamOptions options;
+            options.ringSize = static_cast<size_t>(_config.middleware.sharedMemoryRingSize);
+
+            stream = MakeSharedMemoryRawByteStream(std::move(stream), SharedMemoryRole::Answer, options, *_logger);
+        }
+
         auto vAsioPeer{VAsioPeer::Create(std::move(stream), this, _logger)};
         AddPeer(std::move(vAsioPeer));
     }
@@ -1735,6 +2088,16 @@ void VAsioConnection::OnAsyncAcceptSuccess(IAcceptor& acceptor, std::unique_ptr<
 }
 
 
+void VAsioConnection::OnInProcessAccept(std::unique_ptr<IRawByteStream> stream)
+{
+    Services::Logging::Debug(_logger, "New in-process connection [local={}, remote={}]", stream->GetLocalEndpoint(),
+                             stream->GetRemoteEndpoint());
+
+    // the connecting participant never offers shared memory on an in-process stream
+    auto vAsioPeer{VAsioPeer::Create(std::move(stream), this, _logger)};
+    AddPeer(std::move(vAsioPeer));
+}
+
 void VAsioConnection::OnAsyncAcceptFailure(IAcceptor& acceptor)
 {
     SILKIT_TRACE_METHOD(_logger, "({})", static_cast<const void*>(&acceptor));
@@ -1759,9 +2122,37 @@ void VAsioConnection::OnAsyncAcceptFailure(IAcceptor& acceptor)
 
 void VAsioConnection::OnTimerExpired(ITimer& timer)
 {
-    SILKIT_UNUSED_ARG(timer);
     SILKIT_TRACE_METHOD(_logger, "({})", static_cast<const void*>(&timer));
 
+    if (&timer == _messageBatchFlushTimer.get())
+    {
+        _messageBatchFlushScheduled = false;
+        FlushMessageBatches();
+        return;
+    }
+
+    const auto deferredTimer = _deferredTimers.find(&timer);
+    if (deferredTimer != _deferredTimers.end())
+    {
+        auto function = std::move(deferredTimer->second.function);
+        _deferredTimers.erase(deferredTimer);
+        if (!_isShuttingDown)
+        {
+            function();
+        }
+        return;
+    }
+
+    if (&timer == _metricsDumpTimer.get())
+    {
+        if (!_isShuttingDown)
+        {
+            DumpTransportMetrics();
+            _metricsDumpTimer->AsyncWaitFor(std::chrono::milliseconds{_config.middleware.transportMetricsInterval});
+        }
+        return;
+    }
+
     HandleExpiredConnection();
 }
 
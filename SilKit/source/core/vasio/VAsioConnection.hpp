@@ -31,6 +31,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <mutex>
 #include <atomic>
 #include <list>
+#include <map>
 #include <set>
 #include <condition_variable>
 
@@ -44,7 +45,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "SilKitLink.hpp"
 #include "IVAsioPeer.hpp"
 #include "VAsioReceiver.hpp"
+#include "RemoteServiceEndpointRegistry.hpp"
 #include "VAsioTransmitter.hpp"
+#include "TransportMetricsRecorder.hpp"
 #include "VAsioMsgKind.hpp"
 #include "IServiceEndpoint.hpp"
 #include "traits/SilKitMsgTraits.hpp"
@@ -67,6 +70,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "IIoContext.hpp"
 #include "MakeAsioIoContext.hpp"
+#include "MakeInProcessTransport.hpp"
 
 namespace SilKit {
 namespace Core {
@@ -76,6 +80,7 @@ class VAsioPeer; //fwd
 class VAsioConnection
     : public IVAsioPeerConnection
     , private IAcceptorListener
+    , private IInProcessAcceptorListener
     , private ITimerListener
 {
 public:
@@ -145,28 +150,59 @@ public:
         });
     }
 
+    //! Set the subscription of a subscriber of a remote participant on the links of the service, see
+    //! VAsioTransmitter::SetRemoteSubscription. The subscription is applied on the I/O thread, in order with the
+    //! messages.
+    template <class SilKitServiceT>
+    void SetRemoteSubscriptionForLink(SilKitServiceT* service, const std::string& participantName,
+                                      EndpointId subscriberId, std::shared_ptr<const RemoteSubscription> subscription)
+    {
+        typename SilKitServiceT::SilKitSendMessagesTypes sendMessageTypes{};
+
+        auto&& networkName = GetServiceDescriptor(service).GetNetworkName();
+
+        Util::tuple_tools::for_each(sendMessageTypes, [this, &networkName, &participantName, subscriberId,
+                                                       &subscription](auto&& message) {
+            using SilKitMessageT = std::decay_t<decltype(message)>;
+            auto link = this->GetLinkByName<SilKitMessageT>(networkName);
+            ExecuteOnIoThread([link, participantName, subscriberId, subscription] {
+                link->SetRemoteSubscription(participantName, subscriberId, subscription);
+            });
+        });
+    }
+
     template<typename SilKitMessageT>
     void SendMsg(const IServiceEndpoint* from, SilKitMessageT&& msg)
     {
-        ExecuteOnIoThread(&VAsioConnection::SendMsgImpl<SilKitMessageT>, from, std::forward<SilKitMessageT>(msg));
+        ApplySendQueuePolicy<std::decay_t<SilKitMessageT>>(from);
+        ExecuteOnIoThread(&VAsioConnection::SendMsgImpl<SilKitMessageT>, MetricsTimestamp(), from,
+                          std::forward<SilKitMessageT>(msg));
     }
 
     template<typename SilKitMessageT>
     void SendMsg(const IServiceEndpoint* from, const std::string& targetParticipantName, SilKitMessageT&& msg)
     {
-        ExecuteOnIoThread(&VAsioConnection::SendMsgToTargetImpl<SilKitMessageT>, from, targetParticipantName, std::forward<SilKitMessageT>(msg));
+        ApplySendQueuePolicy<std::decay_t<SilKitMessageT>>(targetParticipantName);
+        ExecuteOnIoThread(&VAsioConnection::SendMsgToTargetImpl<SilKitMessageT>, MetricsTimestamp(), from,
+                          targetParticipantName, std::forward<SilKitMessageT>(msg));
     }
 
-    inline void OnAllMessagesDelivered(const std::function<void()>& callback)
-    {
-        callback();
-    }
+    //! Flush the message batches and invoke the callback once all previously sent messages are queued for sending.
+    //! On the I/O thread, the callback is invoked before returning, otherwise it is invoked later on the I/O thread.
+    void OnAllMessagesDelivered(std::function<void()> callback);
+
+    //! Queue the pending message batches of all peers for sending
+    void FlushSendBuffers();
+    //! Flush the message batches after the configured delay, unless a flush is already scheduled
+    void ScheduleMessageBatchFlush();
 
-    void FlushSendBuffers() {}
     void ExecuteDeferred(std::function<void()> function)
     {
         _ioContext->Post(std::move(function));
     }
+    //! Executes the function on the I/O thread, once the steady clock reached the deadline. The I/O thread is not
+    //! blocked in the meantime. The function is not executed if the connection is shut down before.
+    void ExecuteDeferredAt(std::chrono::steady_clock::time_point deadline, std::function<void()> function);
 
     inline auto Config() const -> const SilKit::Config::ParticipantConfiguration& override
     {
@@ -181,6 +217,9 @@ public:
     // Temporary Helpers
     void RegisterMessageReceiver(std::function<void(IVAsioPeer* peer, ParticipantAnnouncement)> callback);
     void OnSocketData(IVAsioPeer* from, SerializedMessage&& buffer) override;
+    //! Deserializes a received bus message on the strand of the peer. The returned function delivers the message,
+    //! it must be invoked on the I/O thread.
+    auto DeserializeRawSilKitMessage(IVAsioPeer* from, SerializedMessage&& buffer) -> std::function<void()>;
 
     // Prepare Acceptor Sockets (Local Domain and TCP)
     auto PrepareAcceptorEndpointUris(const std::string &connectUri) -> std::vector<std::string>;
@@ -189,6 +228,7 @@ public:
 
     // Listening Sockets (acceptors)
     void AcceptLocalConnections(const std::string& uniqueId);
+    void AcceptInProcessConnections(const std::string& socketPath);
     auto AcceptTcpConnectionsOn(const std::string& hostname, uint16_t port) -> std::pair<std::string, uint16_t>;
 
     void StartIoWorker();
@@ -210,6 +250,19 @@ public:
     auto GetParticipantNamesOfRemoteReceivers(const IServiceEndpoint* service, const std::string& msgTypeName)
         -> std::vector<std::string>;
 
+    //! Send queue status of all connected peers, by participant name
+    auto GetSendQueueStatus() -> std::map<std::string, SendQueueStatus>;
+    //! Called by a peer when its send queue exceeds the high watermark, and when it is drained to the low watermark
+    void OnSendQueueOverflow(IVAsioPeer* peer, bool isOverflowing);
+
+    //! Snapshot of the transport metrics, empty unless they are enabled in the middleware configuration
+    auto GetTransportMetrics() -> TransportMetrics;
+    //! The recorder of the transport metrics, or nullptr if they are not collected
+    auto GetMetricsRecorder() const -> TransportMetricsRecorder*
+    {
+        return _metrics.get();
+    }
+
     bool ParticiantHasCapability(const std::string& participantName, const std::string& capability) const;
 
 
@@ -244,6 +297,7 @@ private: // methods
         Services::Orchestration::NextSimTask,
         Services::Orchestration::SystemCommand,
         Services::Orchestration::ParticipantStatus,
+        Services::Orchestration::CompactParticipantStatus,
         Services::Orchestration::WorkflowConfiguration,
         Services::PubSub::WireDataMessageEvent,
         Services::Rpc::FunctionCall,
@@ -289,6 +343,7 @@ private:
     // ----------------------------------------
     // private methods
     void ReceiveRawSilKitMessage(IVAsioPeer* from, SerializedMessage&& buffer);
+    auto FindVAsioReceiver(size_t receiverIdx) const -> IVAsioReceiver*;
     void ReceiveSubscriptionAnnouncement(IVAsioPeer* from, SerializedMessage&& buffer);
     void ReceiveSubscriptionAcknowledge(IVAsioPeer* from, SerializedMessage&& buffer);
     void ReceiveRegistryMessage(IVAsioPeer* from, SerializedMessage&& buffer);
@@ -336,7 +391,10 @@ private:
         auto& link = std::get<SilKitLinkMap<SilKitMessageT>>(_links)[networkName];
         if (!link)
         {
-            link = std::make_shared<SilKitLink<SilKitMessageT>>(networkName, _logger, _timeProvider);
+            auto* metrics = _metrics != nullptr
+                                ? _metrics->GetLink(SilKitMsgTraits<SilKitMessageT>::TypeName(), networkName)
+                                : nullptr;
+            link = std::make_shared<SilKitLink<SilKitMessageT>>(networkName, _logger, _timeProvider, metrics);
         }
         return link;
     }
@@ -369,7 +427,10 @@ private:
             tmpServiceDescriptor.SetParticipantNameAndComputeId(_participantName);
             // copy the Service Endpoint Id
             serviceEndpointPtr->SetServiceDescriptor(tmpServiceDescriptor);
-            _vasioReceivers.emplace_back(std::move(rawReceiver));
+            {
+                std::unique_lock<decltype(_vasioReceiversMx)> lock{_vasioReceiversMx};
+                _vasioReceivers.emplace_back(std::move(rawReceiver));
+            }
 
             {
                 std::unique_lock<decltype(_peersLock)> lock{_peersLock};
@@ -440,9 +501,28 @@ private:
         }
     }
 
+    auto MetricsTimestamp() const -> TransportMetricsRecorder::Clock::time_point
+    {
+        return _metrics != nullptr ? TransportMetricsRecorder::Clock::now()
+                                   : TransportMetricsRecorder::Clock::time_point{};
+    }
+
+    auto MeasureSendDispatch(TransportMetricsRecorder::Clock::time_point sendTime) -> DurationRecorder*
+    {
+        if (_metrics == nullptr)
+        {
+            return nullptr;
+        }
+        _metrics->sendDispatchDelay.Record(TransportMetricsRecorder::Clock::now() - sendTime);
+        return &_metrics->ioBusyTime;
+    }
+
     template <class SilKitMessageT>
-    void SendMsgImpl(const IServiceEndpoint* from, SilKitMessageT&& msg)
+    void SendMsgImpl(TransportMetricsRecorder::Clock::time_point sendTime, const IServiceEndpoint* from,
+                     SilKitMessageT&& msg)
     {
+        ScopedDurationMeasurement measurement{MeasureSendDispatch(sendTime)};
+
         const auto& key = from->GetServiceDescriptor().GetNetworkName();
 
         auto& linkMap = std::get<SilKitServiceToLinkMap<std::decay_t<SilKitMessageT>>>(_serviceToLinkMap);
@@ -455,9 +535,11 @@ private:
     }
 
     template <class SilKitMessageT>
-    void SendMsgToTargetImpl(const IServiceEndpoint* from, const std::string& targetParticipantName,
-                                   SilKitMessageT&& msg)
+    void SendMsgToTargetImpl(TransportMetricsRecorder::Clock::time_point sendTime, const IServiceEndpoint* from,
+                             const std::string& targetParticipantName, SilKitMessageT&& msg)
     {
+        ScopedDurationMeasurement measurement{MeasureSendDispatch(sendTime)};
+
         const auto& key = from->GetServiceDescriptor().GetNetworkName();
 
         auto& linkMap = std::get<SilKitServiceToLinkMap<std::decay_t<SilKitMessageT>>>(_serviceToLinkMap);
@@ -469,6 +551,48 @@ private:
         link->DispatchSilKitMessageToTarget(from, targetParticipantName, std::forward<SilKitMessageT>(msg));
     }
 
+    //! The Block and Error policies apply to bus messages on the sending thread, before they are handed over to the
+    //! I/O thread. Blocking the I/O thread would stall the queues it drains, and it could not report a rejection.
+    //! Only the overflowing queues of the remote receivers on the link of the sender are considered.
+    template <class SilKitMessageT>
+    void ApplySendQueuePolicy(const IServiceEndpoint* from)
+    {
+        if (SilKitMsgTraits<SilKitMessageT>::IsDroppable() && HasOverflowingSendQueues())
+        {
+            ApplySendQueuePolicyToDroppableMessage(
+                GetParticipantNamesOfLinkReceivers<SilKitMessageT>(from->GetServiceDescriptor().GetNetworkName()));
+        }
+    }
+    template <class SilKitMessageT>
+    void ApplySendQueuePolicy(const std::string& targetParticipantName)
+    {
+        if (SilKitMsgTraits<SilKitMessageT>::IsDroppable() && HasOverflowingSendQueues())
+        {
+            ApplySendQueuePolicyToDroppableMessage({targetParticipantName});
+        }
+    }
+    template <class SilKitMessageT>
+    auto GetParticipantNamesOfLinkReceivers(const std::string& networkName) -> std::vector<std::string>
+    {
+        std::unique_lock<decltype(_linksMx)> lock{_linksMx};
+        auto& linkMap = std::get<SilKitLinkMap<SilKitMessageT>>(_links);
+        auto linkIt = linkMap.find(networkName);
+        if (linkIt == linkMap.end() || !linkIt->second)
+        {
+            return {};
+        }
+        auto link = linkIt->second;
+        lock.unlock();
+
+        return link->GetParticipantNamesOfRemoteReceivers();
+    }
+    bool HasOverflowingSendQueues() const
+    {
+        return _hasOverflowingSendQueues.load(std::memory_order_acquire);
+    }
+    void ApplySendQueuePolicyToDroppableMessage(const std::vector<std::string>& receiverNames);
+    void WakeUpBlockedSenders();
+
     template <typename... MethodArgs, typename... Args>
     inline void ExecuteOnIoThread(void (VAsioConnection::*method)(MethodArgs...), Args&&... args)
     {
@@ -485,6 +609,9 @@ private:
         return dynamic_cast<IServiceEndpoint&>(*service).GetServiceDescriptor();
     }
 
+    void FlushMessageBatches();
+    void DumpTransportMetrics();
+
     // Remote connection support:
     void HandleExpiredConnection();
     void RemovePeerFromPendingLists(IVAsioPeer* peer);
@@ -493,6 +620,9 @@ private: // IAcceptorListener
     void OnAsyncAcceptSuccess(IAcceptor& acceptor, std::unique_ptr<IRawByteStream> stream) override;
     void OnAsyncAcceptFailure(IAcceptor& acceptor) override;
 
+private: // IInProcessAcceptorListener
+    void OnInProcessAccept(std::unique_ptr<IRawByteStream> stream) override;
+
 private: // ITimerListener
     void OnTimerExpired(ITimer& timer) override;
 
@@ -512,7 +642,21 @@ private:
     //! \brief Lookup for links by name.
     Util::tuple_tools::wrapped_tuple<SilKitServiceToLinkMap, SilKitMessageTypes> _serviceToLinkMap;
 
+    //! \brief Guards the receivers, which are looked up by the peers when deserializing on their own strands.
+    mutable std::mutex _vasioReceiversMx;
     std::vector<std::unique_ptr<IVAsioReceiver>> _vasioReceivers;
+    //! \brief Senders of received messages, interned per peer and endpoint.
+    RemoteServiceEndpointRegistry _remoteServiceEndpoints;
+    //! \brief Transport metrics, referenced by the peers and links. Only present if enabled.
+    std::unique_ptr<TransportMetricsRecorder> _metrics;
+    //! \brief Participant names of the peers whose send queue exceeds the high watermark, and the number of bus
+    //! messages blocked or rejected because of them. Used by the sending threads, the peers must outlive them.
+    std::mutex _sendQueueOverflowMutex;
+    std::condition_variable _sendQueueDrained;
+    std::set<std::string> _overflowingSendQueues;
+    //! Set under the mutex, allows the sending threads to skip the lookup of the receivers while no queue overflows
+    std::atomic<bool> _hasOverflowingSendQueues{false};
+    std::map<std::string, SendQueueStatus> _sendQueuePolicyCounters;
     std::unordered_set<std::string> _vasioUniqueReceiverIds;
 
     std::mutex _participantAnnouncementReceiversMutex;
@@ -526,8 +670,25 @@ private:
     std::shared_ptr<IVAsioPeer> _registry{nullptr};
     std::vector<std::shared_ptr<IVAsioPeer>> _peers;
 
+    // message batching: the timer is only used on the I/O thread
+    std::unique_ptr<ITimer> _messageBatchFlushTimer;
+    std::atomic_bool _messageBatchFlushScheduled{false};
+
+    // periodic dump of the transport metrics, the timer is only used on the I/O thread
+    std::unique_ptr<ITimer> _metricsDumpTimer;
+
+    // the timers of ExecuteDeferredAt and their functions, only used on the I/O thread
+    struct DeferredTimer
+    {
+        std::unique_ptr<ITimer> timer;
+        std::function<void()> function;
+    };
+    std::unordered_map<ITimer*, DeferredTimer> _deferredTimers;
+
     std::mutex _acceptorsMutex;
     std::vector<std::unique_ptr<IAcceptor>> _acceptors;
+    // accept participants of this process on the paths of the local acceptors, not announced to other participants
+    std::vector<std::unique_ptr<IInProcessAcceptor>> _inProcessAcceptors;
 
     // After receiving the list of known participants from the registry, we keep
     // track of the sent ParticipantAnnouncements and wait for the corresponding
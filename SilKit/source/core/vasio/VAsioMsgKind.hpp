@@ -34,6 +34,7 @@ enum class VAsioMsgKind: uint8_t
     SilKitSimMsg = 4,
     SilKitRegistryMessage = 5,
     SilKitProxyMessage = 6, // 3.1 with "proxy-message" capability
+    SilKitMessageBatch = 7, // with "message-batching" capability
 };
 
 } // namespace Core
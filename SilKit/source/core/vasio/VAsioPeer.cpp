@@ -21,6 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "VAsioPeer.hpp"
 
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
 #include <thread>
@@ -28,6 +29,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "ILogger.hpp"
 #include "VAsioMsgKind.hpp"
 #include "VAsioConnection.hpp"
+#include "VAsioCapabilities.hpp"
+#include "MakeInProcessTransport.hpp"
+#include "MakeSharedMemoryRawByteStream.hpp"
 #include "Uri.hpp"
 #include "Assert.hpp"
 
@@ -37,6 +41,35 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 using namespace std::chrono_literals;
 
 
+namespace {
+
+// initial size of the receive buffer, which is only grown for messages larger than this
+constexpr size_t ReceiveBufferSize{64 * 1024};
+// upper bound for the size of a received message, larger sizes are treated as a corrupted stream
+constexpr size_t MaxMessageSize{1024 * 1024 * 1024};
+// a message batch starts with its size and message kind, followed by the complete frames of the batched messages
+constexpr size_t MessageBatchHeaderSize{sizeof(uint32_t) + sizeof(SilKit::Core::VAsioMsgKind)};
+
+bool HasPayloadBuffer(const SilKit::Core::SerializedFrame& frame)
+{
+    return frame.sharedPayload && !frame.sharedPayload->empty();
+}
+
+// the sockets are only served by their own strands, if the I/O thread is not the only thread
+bool UsesSocketStrands(const SilKit::Config::Middleware& middleware)
+{
+    return middleware.ioWorkerThreads > 1 || middleware.dedicatedDispatchThread;
+}
+
+bool IsBusMessage(SilKit::Core::VAsioMsgKind messageKind)
+{
+    return messageKind == SilKit::Core::VAsioMsgKind::SilKitSimMsg
+           || messageKind == SilKit::Core::VAsioMsgKind::SilKitMwMsg;
+}
+
+} // namespace
+
+
 namespace SilKit {
 namespace Core {
 
@@ -45,7 +78,9 @@ VAsioPeer::VAsioPeer(IIoContext& ioContext, VAsioConnection* connection, Service
     : _ioContext{&ioContext}
     , _connection{connection}
     , _logger{logger}
+    , _hasOwnStrand{UsesSocketStrands(connection->Config().middleware)}
 {
+    InitializeSendLimits();
 }
 
 VAsioPeer::VAsioPeer(std::unique_ptr<IRawByteStream> stream, VAsioConnection* connection,
@@ -54,7 +89,9 @@ VAsioPeer::VAsioPeer(std::unique_ptr<IRawByteStream> stream, VAsioConnection* co
     , _socket{std::move(stream)}
     , _connection{connection}
     , _logger{logger}
+    , _hasOwnStrand{UsesSocketStrands(connection->Config().middleware)}
 {
+    InitializeSendLimits();
     _socket->SetListener(*this);
 }
 
@@ -63,6 +100,36 @@ VAsioPeer::~VAsioPeer()
     SILKIT_TRACE_METHOD(_logger, "()");
 }
 
+void VAsioPeer::InitializeSendLimits()
+{
+    const auto& middleware = _connection->Config().middleware;
+
+    // non-positive limits are clamped, such that every write still carries at least a single frame
+    _sendBatchMaxBytes = static_cast<size_t>((std::max)(middleware.sendBatchMaxBytes, 0));
+    _sendBatchMaxBuffers = static_cast<size_t>((std::max)(middleware.sendBatchMaxBuffers, 0));
+
+    // a missing or invalid low watermark defaults to half of the high watermark
+    _sendQueueHighWatermark = static_cast<size_t>((std::max)(middleware.sendQueueHighWatermark, 0));
+    _sendQueueLowWatermark = static_cast<size_t>((std::max)(middleware.sendQueueLowWatermark, 0));
+    if (_sendQueueLowWatermark == 0 || _sendQueueLowWatermark > _sendQueueHighWatermark)
+    {
+        _sendQueueLowWatermark = _sendQueueHighWatermark / 2;
+    }
+    _sendQueuePolicy = middleware.sendQueuePolicy;
+
+    _messageBatchMaxBytes = static_cast<size_t>((std::max)(middleware.messageBatchMaxBytes, 0));
+}
+
+void VAsioPeer::ApplyPeerInfo()
+{
+    // only peers which advertise the capability can unpack message batches
+    _messageBatching = _connection->Config().middleware.enableMessageBatching
+                       && VAsioCapabilities{_info.capabilities}.HasCapability(Capabilities::MessageBatching);
+
+    auto* metrics = _connection->GetMetricsRecorder();
+    _metrics = metrics == nullptr ? nullptr : metrics->GetPeer(_info.participantName);
+}
+
 
 void VAsioPeer::DrainAllBuffers()
 {
@@ -78,6 +145,24 @@ void VAsioPeer::Shutdown()
     {
         std::unique_lock<decltype(_sendingQueueMutex)> lock{_sendingQueueMutex};
         _sendingQueue.clear();
+        _sendingQueueBytes = 0;
+        _conflationIndex.clear();
+        _discardedFrameCount = 0;
+        _messageBatch.clear();
+        if (_sendQueueOverflow)
+        {
+            // wake up the senders blocked by the send queue policy
+            _sendQueueOverflow = false;
+            _connection->OnSendQueueOverflow(this, false);
+        }
+    }
+
+    if (_hasOwnStrand)
+    {
+        ExecuteOnStrand([this] {
+            _socket->Shutdown();
+        });
+        return;
     }
 
     _socket->Shutdown();
@@ -92,6 +177,7 @@ auto VAsioPeer::GetInfo() const -> const VAsioPeerInfo&
 void VAsioPeer::SetInfo(VAsioPeerInfo peerInfo)
 {
     _info = std::move(peerInfo);
+    ApplyPeerInfo();
 }
 
 
@@ -114,6 +200,18 @@ bool VAsioPeer::ConnectLocal(const std::string& socketPath)
 
     SilKit::Services::Logging::Debug(_logger, "ConnectLocal: Connecting to {}", socketPath);
 
+    const auto& middleware = _connection->Config().middleware;
+    if (middleware.enableInProcessTransport)
+    {
+        // the accepting participant lives in this process, bypass the socket
+        _socket = ConnectInProcess(*_ioContext, socketPath, *_logger);
+        if (_socket != nullptr)
+        {
+            _socket->SetListener(*this);
+            return true;
+        }
+    }
+
     std::error_code errorCode;
 
     _socket = _ioContext->ConnectLocal(socketPath, errorCode);
@@ -124,6 +222,15 @@ bool VAsioPeer::ConnectLocal(const std::string& socketPath)
         return false;
     }
 
+    if (middleware.enableSharedMemory && IsSharedMemoryTransportSupported()
+        && VAsioCapabilities{_info.capabilities}.HasCapability(Capabilities::SharedMemory))
+    {
+        SharedMemoryRawByteStreamOptions options;
+        options.ringSize = static_cast<size_t>(middleware.sharedMemoryRingSize);
+
+        _socket = MakeSharedMemoryRawByteStream(std::move(_socket), SharedMemoryRole::Offer, options, *_logger);
+    }
+
     _socket->SetListener(*this);
 
     return true;
@@ -163,6 +270,7 @@ bool VAsioPeer::ConnectTcp(const std::string& host, uint16_t port)
 void VAsioPeer::Connect(VAsioPeerInfo peerInfo, std::stringstream& attemptedUris, bool& success)
 {
     _info = std::move(peerInfo);
+    ApplyPeerInfo();
 
     // parse endpoints into Uri objects
     const auto& uriStrings = _info.acceptorUris;
@@ -215,21 +323,273 @@ void VAsioPeer::Connect(VAsioPeerInfo peerInfo, std::stringstream& attemptedUris
     success = false;
 }
 
+auto VAsioPeer::HasOwnStrand() const -> bool
+{
+    return _hasOwnStrand;
+}
+
+void VAsioPeer::ExecuteOnStrand(std::function<void()> function)
+{
+    // the peer is kept alive until the function was executed
+    _socket->Dispatch([self = shared_from_this(), function = std::move(function)] {
+        function();
+    });
+}
+
 void VAsioPeer::SendSilKitMsg(SerializedMessage buffer)
 {
     // Prevent sending when shutting down
-    if (!_isShuttingDown && _socket != nullptr)
+    if (_isShuttingDown || _socket == nullptr)
+    {
+        return;
+    }
+
+    if (!_hasOwnStrand)
+    {
+        QueueSilKitMsg(std::move(buffer));
+        return;
+    }
+
+    // the messages are queued on the strand in the order they were sent
+    ExecuteOnStrand([this, buffer = std::move(buffer)]() mutable {
+        QueueSilKitMsg(std::move(buffer));
+    });
+}
+
+void VAsioPeer::QueueSilKitMsg(SerializedMessage buffer)
+{
+    // Prevent sending when shutting down
+    if (!_isShuttingDown)
     {
+        const bool isSimMsg = buffer.GetMessageKind() == VAsioMsgKind::SilKitSimMsg;
+        auto frame = buffer.ReleaseFrame();
+        // conflatable messages are queued individually, so they can be replaced until they are written
+        const bool isBatchable = _messageBatching && isSimMsg && !frame.conflatable;
+        if (_metrics != nullptr)
+        {
+            frame.queueTime = TransportMetricsRecorder::Clock::now();
+        }
+
         std::unique_lock<std::mutex> lock{_sendingQueueMutex};
 
-        _sendingQueue.push_back(buffer.ReleaseStorage());
+        if (isBatchable && MessageBatchHeaderSize + frame.Size() <= _messageBatchMaxBytes)
+        {
+            // send the current batch, if the message does not fit anymore
+            if (!_messageBatch.empty() && _messageBatch.size() + frame.Size() > _messageBatchMaxBytes
+                && !QueueMessageBatch())
+            {
+                return;
+            }
+
+            const bool isFirstInBatch = _messageBatch.empty();
+            AppendToMessageBatch(std::move(frame));
+
+            if (_messageBatch.size() < _messageBatchMaxBytes)
+            {
+                lock.unlock();
+
+                // the batch is sent at the next flush point, at the latest after the maximum delay
+                if (isFirstInBatch)
+                {
+                    _connection->ScheduleMessageBatchFlush();
+                }
+                return;
+            }
+
+            if (!QueueMessageBatch())
+            {
+                return;
+            }
+        }
+        else
+        {
+            // the batched messages must not be overtaken by the message
+            if (!_messageBatch.empty() && !QueueMessageBatch())
+            {
+                return;
+            }
+
+            // only the latest frame of the sender to the receiver is kept, at the tail of the queue. The stale frame is
+            // discarded before applying the policy, which then sees the space it occupied as free.
+            if (frame.conflatable)
+            {
+                DiscardConflatedFrame(frame.conflationKey);
+            }
+
+            if (!ApplySendQueuePolicy(frame))
+            {
+                return;
+            }
+
+            EnqueueFrame(std::move(frame));
+        }
 
         lock.unlock();
 
-        _ioContext->Dispatch([this] {
+        DispatchStartAsyncWrite();
+    }
+}
+
+void VAsioPeer::FlushMessageBatch()
+{
+    if (_isShuttingDown)
+    {
+        return;
+    }
+
+    if (!_hasOwnStrand)
+    {
+        QueueMessageBatchForSending();
+        return;
+    }
+
+    // the batch must contain the messages which are still on their way to the strand
+    ExecuteOnStrand([this] {
+        QueueMessageBatchForSending();
+    });
+}
+
+void VAsioPeer::QueueMessageBatchForSending()
+{
+    if (_isShuttingDown)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock{_sendingQueueMutex};
+
+    if (_messageBatch.empty() || !QueueMessageBatch())
+    {
+        return;
+    }
+
+    lock.unlock();
+
+    DispatchStartAsyncWrite();
+}
+
+void VAsioPeer::DispatchStartAsyncWrite()
+{
+    // the writes are started on the strand of the socket, which also runs their completions
+    if (_hasOwnStrand)
+    {
+        ExecuteOnStrand([this] {
             StartAsyncWrite();
         });
+        return;
     }
+
+    _ioContext->Dispatch([this] {
+        StartAsyncWrite();
+    });
+}
+
+void VAsioPeer::EnqueueFrame(SerializedFrame frame)
+{
+    if (frame.conflatable)
+    {
+        _conflationIndex[frame.conflationKey] = _sendingQueueFrontPosition + _sendingQueue.size();
+    }
+
+    _sendingQueueBytes += frame.Size();
+    _sendQueueStatus.maxQueuedBytes = (std::max)(_sendQueueStatus.maxQueuedBytes, _sendingQueueBytes);
+    _sendingQueue.push_back(std::move(frame));
+}
+
+void VAsioPeer::DiscardConflatedFrame(const std::pair<EndpointId, EndpointId>& conflationKey)
+{
+    auto it = _conflationIndex.find(conflationKey);
+    if (it == _conflationIndex.end())
+    {
+        return;
+    }
+
+    // The frame stays in the queue as an empty placeholder, which is skipped when writing. Moving the newer frame
+    // into its place would let it overtake the frames queued in between, and erasing it would shift their positions.
+    auto& queuedFrame = _sendingQueue[static_cast<size_t>(it->second - _sendingQueueFrontPosition)];
+    _sendingQueueBytes -= queuedFrame.Size();
+    GetSerializedMessageBufferPool().Release(std::move(queuedFrame.header));
+    queuedFrame = SerializedFrame{};
+    queuedFrame.discarded = true;
+
+    _conflationIndex.erase(it);
+    _discardedFrameCount += 1;
+    _sendQueueStatus.conflatedMessages += 1;
+
+    // a writer which does not make progress must not accumulate the placeholders
+    if (_discardedFrameCount > _sendingQueue.size() / 2)
+    {
+        RemoveDiscardedFrames();
+    }
+}
+
+void VAsioPeer::RemoveDiscardedFrames()
+{
+    const auto end = std::remove_if(_sendingQueue.begin(), _sendingQueue.end(), [](const auto& frame) {
+        return frame.discarded;
+    });
+    _sendingQueue.erase(end, _sendingQueue.end());
+    _discardedFrameCount = 0;
+
+    RebuildConflationIndex();
+}
+
+void VAsioPeer::RebuildConflationIndex()
+{
+    _conflationIndex.clear();
+    for (size_t index = 0; index != _sendingQueue.size(); ++index)
+    {
+        if (_sendingQueue[index].conflatable)
+        {
+            _conflationIndex[_sendingQueue[index].conflationKey] = _sendingQueueFrontPosition + index;
+        }
+    }
+}
+
+void VAsioPeer::AppendToMessageBatch(SerializedFrame frame)
+{
+    auto& pool = GetSerializedMessageBufferPool();
+
+    if (_messageBatch.empty())
+    {
+        _messageBatch = pool.Acquire(_messageBatchMaxBytes);
+        _messageBatch.resize(MessageBatchHeaderSize);
+        _messageBatch[sizeof(uint32_t)] = static_cast<uint8_t>(VAsioMsgKind::SilKitMessageBatch);
+        _messageBatchMessageCount = 0;
+        _messageBatchQueueTime = frame.queueTime;
+    }
+    _messageBatchMessageCount += 1;
+
+    // the frame header already starts with the size of the message
+    _messageBatch.insert(_messageBatch.end(), frame.header.begin(), frame.header.end());
+    if (frame.sharedPayload)
+    {
+        _messageBatch.insert(_messageBatch.end(), frame.sharedPayload->begin(), frame.sharedPayload->end());
+    }
+
+    pool.Release(std::move(frame.header));
+}
+
+bool VAsioPeer::QueueMessageBatch()
+{
+    SerializedFrame frame;
+    frame.header = std::move(_messageBatch);
+    frame.messageCount = _messageBatchMessageCount;
+    frame.queueTime = _messageBatchQueueTime;
+    _messageBatch.clear();
+
+    const auto batchSize = static_cast<uint32_t>(frame.header.size());
+    memcpy(frame.header.data(), &batchSize, sizeof batchSize);
+
+    // the batch is never droppable, as it may contain messages which are not
+    if (!ApplySendQueuePolicy(frame))
+    {
+        GetSerializedMessageBufferPool().Release(std::move(frame.header));
+        return false;
+    }
+
+    EnqueueFrame(std::move(frame));
+    return true;
 }
 
 void VAsioPeer::StartAsyncWrite()
@@ -237,25 +597,176 @@ void VAsioPeer::StartAsyncWrite()
     if (_sending)
         return;
 
+    // the write completion and new messages may start a write concurrently, if multiple I/O worker threads are used
     std::unique_lock<std::mutex> lock{_sendingQueueMutex};
-    if (_sendingQueue.empty())
+    if (_sending || _sendingQueue.empty())
     {
         return;
     }
 
     _sending = true;
 
-    _currentSendingBufferData = std::move(_sendingQueue.front());
-    _sendingQueue.pop_front();
+    // drain as many queued frames as the batch limits allow, but always at least one
+    size_t batchBytes{0};
+    size_t batchBuffers{0};
+    while (!_sendingQueue.empty())
+    {
+        const auto& frame = _sendingQueue.front();
+        if (frame.discarded)
+        {
+            _discardedFrameCount -= 1;
+            _sendingQueue.pop_front();
+            _sendingQueueFrontPosition += 1;
+            continue;
+        }
+
+        const size_t frameBuffers = HasPayloadBuffer(frame) ? 2 : 1;
+        if (!_currentSendingFrames.empty()
+            && (batchBytes + frame.Size() > _sendBatchMaxBytes || batchBuffers + frameBuffers > _sendBatchMaxBuffers))
+        {
+            break;
+        }
+
+        batchBytes += frame.Size();
+        batchBuffers += frameBuffers;
+        if (frame.conflatable)
+        {
+            _conflationIndex.erase(frame.conflationKey);
+        }
+        _currentSendingFrames.push_back(std::move(_sendingQueue.front()));
+        _sendingQueue.pop_front();
+        _sendingQueueFrontPosition += 1;
+    }
+
+    _sendingQueueBytes -= batchBytes;
+    if (_sendQueueOverflow && _sendingQueueBytes <= _sendQueueLowWatermark)
+    {
+        _sendQueueOverflow = false;
+        _connection->OnSendQueueOverflow(this, false);
+    }
+    // only discarded frames were queued
+    const bool isIdle = _currentSendingFrames.empty();
+    if (isIdle)
+    {
+        _sending = false;
+    }
     lock.unlock();
 
-    _currentSendingBuffer = ConstBuffer(_currentSendingBufferData.data(), _currentSendingBufferData.size());
+    if (isIdle)
+    {
+        return;
+    }
+
+    _currentSendingBuffers.clear();
+    for (const auto& frame : _currentSendingFrames)
+    {
+        _currentSendingBuffers.emplace_back(frame.header.data(), frame.header.size());
+        if (HasPayloadBuffer(frame))
+        {
+            _currentSendingBuffers.emplace_back(frame.sharedPayload->data(), frame.sharedPayload->size());
+        }
+    }
+    _currentSendingBufferIndex = 0;
+
     WriteSomeAsync();
 }
 
+bool VAsioPeer::ApplySendQueuePolicy(const SerializedFrame& frame)
+{
+    if (_sendQueueHighWatermark == 0)
+    {
+        return true;
+    }
+
+    if (!_sendQueueOverflow)
+    {
+        // an empty queue accepts any message, regardless of its size
+        if (_sendingQueueBytes == 0 || _sendingQueueBytes + frame.Size() <= _sendQueueHighWatermark)
+        {
+            return true;
+        }
+
+        _sendQueueOverflow = true;
+        Services::Logging::Debug(_logger, "VAsioPeer: Send queue to participant '{}' exceeded the high watermark of {} bytes",
+                                 _info.participantName, _sendQueueHighWatermark);
+        _connection->OnSendQueueOverflow(this, true);
+    }
+
+    switch (_sendQueuePolicy)
+    {
+    case Config::Middleware::SendQueuePolicy::Block: // [[fallthrough]]
+    case Config::Middleware::SendQueuePolicy::Error:
+        // The sending threads are blocked or rejected by the connection, before the messages are handed over to the
+        // I/O thread. The messages which are already on their way are queued.
+        return true;
+
+    case Config::Middleware::SendQueuePolicy::DropOldest:
+        DropOldestDroppableFrames();
+        // if only non-droppable messages are queued, the new message is the oldest droppable one
+        if (_sendQueueOverflow && frame.droppable && _sendingQueueBytes + frame.Size() > _sendQueueHighWatermark)
+        {
+            _sendQueueStatus.droppedMessages += 1;
+            return false;
+        }
+        return true;
+
+    }
+
+    return true;
+}
+
+void VAsioPeer::DropOldestDroppableFrames()
+{
+    const auto excessBytes = _sendingQueueBytes - (std::min)(_sendingQueueBytes, _sendQueueLowWatermark);
+
+    // the dropped frames give their headers back to the pool, like the discarded ones
+    auto& pool = GetSerializedMessageBufferPool();
+    size_t droppedBytes{0};
+    size_t droppedMessages{0};
+    for (auto& frame : _sendingQueue)
+    {
+        if (droppedBytes >= excessBytes)
+        {
+            break;
+        }
+        if (frame.discarded || !frame.droppable)
+        {
+            continue;
+        }
+        droppedBytes += frame.Size();
+        droppedMessages += 1;
+        pool.Release(std::move(frame.header));
+        frame = SerializedFrame{};
+        frame.discarded = true;
+    }
+
+    // the positions of the remaining conflatable frames change
+    RemoveDiscardedFrames();
+
+    _sendingQueueBytes -= droppedBytes;
+    _sendQueueStatus.droppedMessages += droppedMessages;
+
+    if (_sendQueueOverflow && _sendingQueueBytes <= _sendQueueLowWatermark)
+    {
+        _sendQueueOverflow = false;
+        _connection->OnSendQueueOverflow(this, false);
+    }
+}
+
+auto VAsioPeer::GetSendQueueStatus() const -> SendQueueStatus
+{
+    std::unique_lock<decltype(_sendingQueueMutex)> lock{_sendingQueueMutex};
+
+    auto status = _sendQueueStatus;
+    status.queuedMessages = _sendingQueue.size() - _discardedFrameCount;
+    status.queuedBytes = _sendingQueueBytes;
+    return status;
+}
+
 void VAsioPeer::WriteSomeAsync()
 {
-    _socket->AsyncWriteSome(ConstBufferSequence{&_currentSendingBuffer, 1});
+    _socket->AsyncWriteSome(ConstBufferSequence{_currentSendingBuffers.data() + _currentSendingBufferIndex,
+                                                _currentSendingBuffers.size() - _currentSendingBufferIndex});
 }
 
 void VAsioPeer::Subscribe(VAsioMsgSubscriber subscriber)
@@ -267,19 +778,30 @@ void VAsioPeer::Subscribe(VAsioMsgSubscriber subscriber)
 
 void VAsioPeer::StartAsyncRead()
 {
-    _currentMsgSize = 0u;
+    auto startReading = [this] {
+        _receiveBuffer = std::make_shared<ReceiveBuffer>();
+        _receiveBuffer->storage.resize(ReceiveBufferSize);
+        _rPos = 0u;
+        _wPos = 0u;
 
-    _msgBuffer.resize(4096);
-    _wPos = {0u};
+        ReadSomeAsync();
+    };
 
-    ReadSomeAsync();
+    // the reads are started on the strand of the socket, which also runs their completions
+    if (_hasOwnStrand)
+    {
+        ExecuteOnStrand(std::move(startReading));
+        return;
+    }
+
+    startReading();
 }
 
 void VAsioPeer::ReadSomeAsync()
 {
-    SILKIT_ASSERT(_msgBuffer.size() > 0);
-    auto* wPtr = _msgBuffer.data() + _wPos;
-    auto  size = _msgBuffer.size() - _wPos;
+    SILKIT_ASSERT(_receiveBuffer->storage.size() > _wPos);
+    auto* wPtr = _receiveBuffer->storage.data() + _wPos;
+    auto  size = _receiveBuffer->storage.size() - _wPos;
 
     _currentReceivingBuffer = MutableBuffer{wPtr, size};
 
@@ -288,70 +810,218 @@ void VAsioPeer::ReadSomeAsync()
 
 void VAsioPeer::DispatchBuffer()
 {
-    if (_currentMsgSize == 0)
+    // With multiple I/O worker threads, the socket is served by its own strand. The received messages are then
+    // deserialized on the strand, and handed over to the connection's executor, which delivers the messages of all
+    // peers sequentially.
+    const bool isConnectionThread = _ioContext->IsRunningInThisThread();
+    std::vector<std::function<void()>> deliveries;
+
+    // dispatch all complete messages in the receive buffer, each message borrows its slice of the buffer
+    while (!_isShuttingDown)
     {
-        if (_isShuttingDown)
+        const auto receivedBytes = _wPos - _rPos;
+        if (receivedBytes < sizeof(uint32_t))
+        {
+            // not enough data to even determine the message size
+            break;
+        }
+
+        uint32_t msgSize{0u};
+        memcpy(&msgSize, _receiveBuffer->storage.data() + _rPos, sizeof msgSize);
+
+        // validate the received size
+        if (msgSize < sizeof msgSize || msgSize > MaxMessageSize)
         {
+            SilKit::Services::Logging::Error(_logger, "Received invalid Message Size: {}", msgSize);
+            Shutdown();
             return;
         }
-        if (_wPos >= sizeof(uint32_t))
+
+        if (receivedBytes < msgSize)
         {
-            _currentMsgSize = *reinterpret_cast<uint32_t*>(_msgBuffer.data());
+            break;
         }
-        else
+
+        if (msgSize >= MessageBatchHeaderSize
+            && _receiveBuffer->storage[_rPos + sizeof msgSize] == static_cast<uint8_t>(VAsioMsgKind::SilKitMessageBatch))
         {
-            // not enough data to even determine the message size...
-            // make sure the buffer can store some data
-            if (_msgBuffer.size() < sizeof(uint32_t))
-                _msgBuffer.resize(4096);
-            // and restart the async read operation
-            ReadSomeAsync();
-            return;
+            if (!DispatchMessageBatch(_rPos, msgSize, isConnectionThread, deliveries))
+            {
+                SilKit::Services::Logging::Error(_logger, "Received invalid message batch from participant '{}'",
+                                                 _info.participantName);
+                Shutdown();
+                return;
+            }
+            _rPos += msgSize;
+            continue;
         }
+
+        DispatchMessage(_rPos, msgSize, isConnectionThread, deliveries);
+        _rPos += msgSize;
     }
 
-    // validate the received size
-    if (_currentMsgSize == 0 || _currentMsgSize > 1024 * 1024 * 1024)
+    if (!deliveries.empty())
     {
-        SilKit::Services::Logging::Error(_logger, "Received invalid Message Size: {}", _currentMsgSize);
-        Shutdown();
+        _ioContext->Post([self = shared_from_this(), deliveries = std::move(deliveries)]() mutable {
+            self->DeliverMessages(deliveries);
+        });
     }
 
-
-    if (_wPos < _currentMsgSize)
+    if (_isShuttingDown)
     {
-        // Make the buffer large enough and wait until we have more data.
-        _msgBuffer.resize(_currentMsgSize);
-        ReadSomeAsync();
         return;
     }
-    else
-    {
-        auto newBuffer = std::vector<uint8_t>{_msgBuffer.begin() + _currentMsgSize, _msgBuffer.end()};
-        auto newWPos = _wPos - _currentMsgSize;
 
-        // manually extract the message size so we can adjust the MessageBuffer size
+    PrepareReceiveBuffer();
+    ReadSomeAsync();
+}
+
+bool VAsioPeer::DispatchMessageBatch(size_t offset, size_t size, bool isConnectionThread,
+                                     std::vector<std::function<void()>>& deliveries)
+{
+    // the batched messages borrow their slices of the receive buffer, just like individual messages
+    const auto end = offset + size;
+    auto position = offset + MessageBatchHeaderSize;
+    while (position != end && !_isShuttingDown)
+    {
         uint32_t msgSize{0u};
-        if (_msgBuffer.size() < sizeof msgSize)
+        if (end - position < sizeof msgSize)
+        {
+            return false;
+        }
+
+        memcpy(&msgSize, _receiveBuffer->storage.data() + position, sizeof msgSize);
+        if (msgSize < sizeof msgSize || msgSize > end - position)
         {
-            throw SilKitError{ "DispatchBuffer: Received message is too small to contain message size header" };
+            return false;
         }
-        memcpy(&msgSize, _msgBuffer.data(), sizeof msgSize);
-        //ensure buffer does not contain data from contiguous messages
-        _msgBuffer.resize(msgSize);
-        SerializedMessage message{std::move(_msgBuffer)};
+
+        DispatchMessage(position, msgSize, isConnectionThread, deliveries);
+        position += msgSize;
+    }
+
+    return true;
+}
+
+void VAsioPeer::DispatchMessage(size_t offset, size_t size, bool isConnectionThread,
+                                std::vector<std::function<void()>>& deliveries)
+{
+    if (auto* metrics = _metrics.load())
+    {
+        metrics->RecordReceived(1, size);
+    }
+
+    SerializedMessage message{LendReceiveBuffer(), offset, size};
+
+    if (isConnectionThread)
+    {
+        message.SetProtocolVersion(GetProtocolVersion());
+        _connection->OnSocketData(this, std::move(message));
+        return;
+    }
+
+    if (IsBusMessage(message.GetMessageKind()) && _pendingControlMessages == 0)
+    {
+        message.SetProtocolVersion(GetProtocolVersion());
+        deliveries.push_back(_connection->DeserializeRawSilKitMessage(this, std::move(message)));
+        return;
+    }
+
+    // the protocol version is only known after the handshake, which may be among the delivered messages
+    _pendingControlMessages += 1;
+    deliveries.push_back([this, message = std::move(message)]() mutable {
         message.SetProtocolVersion(GetProtocolVersion());
         _connection->OnSocketData(this, std::move(message));
+        _pendingControlMessages -= 1;
+    });
+}
 
-        // keep trailing data in the buffer
-        _msgBuffer = std::move(newBuffer);
-        _wPos = newWPos;
-        _currentMsgSize = 0u;
+void VAsioPeer::DeliverMessages(std::vector<std::function<void()>>& deliveries)
+{
+    for (auto& deliver : deliveries)
+    {
+        if (_isShuttingDown)
+        {
+            return;
+        }
 
-        DispatchBuffer();
+        deliver();
     }
 }
 
+auto VAsioPeer::LendReceiveBuffer() -> const std::shared_ptr<const std::vector<uint8_t>>&
+{
+    if (!_receiveBufferLease)
+    {
+        _receiveBuffer->isLent.store(true, std::memory_order_relaxed);
+        _receiveBufferLease = std::shared_ptr<const std::vector<uint8_t>>{
+            &_receiveBuffer->storage, [receiveBuffer = _receiveBuffer](const std::vector<uint8_t>*) {
+                receiveBuffer->isLent.store(false, std::memory_order_release);
+            }};
+    }
+    return _receiveBufferLease;
+}
+
+bool VAsioPeer::ReclaimReceiveBuffer()
+{
+    // The use count is only a hint: if the lease is not shared anymore, dropping it runs its deleter, which publishes
+    // the releases of the dispatched messages on the other threads. Otherwise, the buffer is still borrowed.
+    if (_receiveBufferLease.use_count() == 1)
+    {
+        _receiveBufferLease.reset();
+    }
+    return !_receiveBufferLease && !_receiveBuffer->isLent.load(std::memory_order_acquire);
+}
+
+void VAsioPeer::PrepareReceiveBuffer()
+{
+    const auto pendingBytes = _wPos - _rPos;
+    const bool isBorrowed = !ReclaimReceiveBuffer();
+
+    // all received messages were dispatched and released, start over at the front of the buffer
+    if (pendingBytes == 0 && !isBorrowed && _receiveBuffer->storage.size() == ReceiveBufferSize)
+    {
+        _rPos = 0u;
+        _wPos = 0u;
+        return;
+    }
+
+    // the size of the pending message, if its size was received already
+    size_t requiredSize{sizeof(uint32_t)};
+    if (pendingBytes >= sizeof(uint32_t))
+    {
+        uint32_t msgSize{0u};
+        memcpy(&msgSize, _receiveBuffer->storage.data() + _rPos, sizeof msgSize);
+        requiredSize = msgSize;
+    }
+
+    // keep reading into the current buffer, if the pending message fits into the remaining space
+    if (_wPos < _receiveBuffer->storage.size() && _rPos + requiredSize <= _receiveBuffer->storage.size())
+    {
+        return;
+    }
+
+    // Move the pending bytes to the front. The buffer is only reused if no dispatched message borrows from it
+    // anymore, otherwise the pending bytes are copied into a fresh buffer.
+    const auto bufferSize = (std::max)(ReceiveBufferSize, requiredSize);
+    if (!isBorrowed && _receiveBuffer->storage.size() == bufferSize)
+    {
+        memmove(_receiveBuffer->storage.data(), _receiveBuffer->storage.data() + _rPos, pendingBytes);
+    }
+    else
+    {
+        // the lease keeps the previous buffer alive, until the dispatched messages released it
+        auto newBuffer = std::make_shared<ReceiveBuffer>();
+        newBuffer->storage.resize(bufferSize);
+        memcpy(newBuffer->storage.data(), _receiveBuffer->storage.data() + _rPos, pendingBytes);
+        _receiveBuffer = std::move(newBuffer);
+        _receiveBufferLease.reset();
+    }
+
+    _rPos = 0u;
+    _wPos = pendingBytes;
+}
+
 
 // IRawByteStreamListener
 
@@ -371,13 +1041,45 @@ void VAsioPeer::OnAsyncWriteSomeDone(IRawByteStream& stream, size_t bytesTransfe
     SILKIT_UNUSED_ARG(stream);
     SILKIT_TRACE_METHOD(_logger, "({}, {})", static_cast<const void*>(&stream), bytesTransferred);
 
-    if (bytesTransferred < _currentSendingBuffer.GetSize())
+    // skip the completely written buffers and slice off the written prefix of a partially written buffer
+    while (_currentSendingBufferIndex < _currentSendingBuffers.size())
+    {
+        auto& buffer = _currentSendingBuffers[_currentSendingBufferIndex];
+        if (bytesTransferred < buffer.GetSize())
+        {
+            buffer.SliceOff(bytesTransferred);
+            break;
+        }
+
+        bytesTransferred -= buffer.GetSize();
+        ++_currentSendingBufferIndex;
+    }
+
+    if (_currentSendingBufferIndex < _currentSendingBuffers.size())
     {
-        _currentSendingBuffer.SliceOff(bytesTransferred);
         WriteSomeAsync();
         return;
     }
 
+    if (auto* metrics = _metrics.load())
+    {
+        const auto now = TransportMetricsRecorder::Clock::now();
+        for (const auto& frame : _currentSendingFrames)
+        {
+            metrics->RecordSent(frame.messageCount, frame.Size());
+            // frames queued before the peer was known are not timed
+            if (frame.queueTime != TransportMetricsRecorder::Clock::time_point{})
+            {
+                metrics->sendLatency.Record(now - frame.queueTime);
+            }
+        }
+    }
+
+    for (auto& frame : _currentSendingFrames)
+    {
+        GetSerializedMessageBufferPool().Release(std::move(frame.header));
+    }
+    _currentSendingFrames.clear();
     _sending = false;
     StartAsyncWrite();
 }
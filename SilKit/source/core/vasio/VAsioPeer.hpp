@@ -23,6 +23,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 
 #include <vector>
+#include <map>
 #include <queue>
 #include <mutex>
 #include <sstream>
@@ -36,6 +37,9 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "VAsioPeerInfo.hpp"
 #include "ProtocolVersion.hpp"
 #include "IVAsioConnectionPeer.hpp"
+#include "ParticipantConfiguration.hpp"
+
+#include "TransportMetricsRecorder.hpp"
 
 #include "IIoContext.hpp"
 #include "IRawByteStream.hpp"
@@ -93,6 +97,9 @@ public:
     // ----------------------------------------
     // Public Methods
     void SendSilKitMsg(SerializedMessage buffer) override;
+    //! True, if the messages of the peer are queued, sent, received, and deserialized on its own strand, i.e., in
+    //! parallel to the I/O thread
+    auto HasOwnStrand() const -> bool;
     void Subscribe(VAsioMsgSubscriber subscriber) override;
 
     auto GetInfo() const -> const VAsioPeerInfo& override;
@@ -116,13 +123,42 @@ public:
     
     void DrainAllBuffers() override;
 
+    auto GetSendQueueStatus() const -> SendQueueStatus override;
+
+    //! Queue the pending message batch for sending
+    void FlushMessageBatch();
+
 private:
     // ----------------------------------------
     // Private Methods
+    void InitializeSendLimits();
+    void ExecuteOnStrand(std::function<void()> function);
+    void QueueSilKitMsg(SerializedMessage buffer);
+    void QueueMessageBatchForSending();
+    void DispatchStartAsyncWrite();
+    bool ApplySendQueuePolicy(const SerializedFrame& frame);
+    void DropOldestDroppableFrames();
+    void EnqueueFrame(SerializedFrame frame);
+    void DiscardConflatedFrame(const std::pair<EndpointId, EndpointId>& conflationKey);
+    void RemoveDiscardedFrames();
+    void RebuildConflationIndex();
+    void ApplyPeerInfo();
+    void AppendToMessageBatch(SerializedFrame frame);
+    bool QueueMessageBatch();
+    bool DispatchMessageBatch(size_t offset, size_t size, bool isConnectionThread,
+                              std::vector<std::function<void()>>& deliveries);
+    void DispatchMessage(size_t offset, size_t size, bool isConnectionThread,
+                         std::vector<std::function<void()>>& deliveries);
     void StartAsyncWrite();
     void WriteSomeAsync();
     void ReadSomeAsync();
     void DispatchBuffer();
+    void DeliverMessages(std::vector<std::function<void()>>& deliveries);
+    void PrepareReceiveBuffer();
+    //! The receive buffer as borrowed by the dispatched messages
+    auto LendReceiveBuffer() -> const std::shared_ptr<const std::vector<uint8_t>>&;
+    //! True if no dispatched message borrows from the receive buffer anymore, i.e., it may be overwritten
+    bool ReclaimReceiveBuffer();
     void Shutdown();
     bool ConnectLocal(const std::string& path);
     bool ConnectTcp(const std::string& host, uint16_t port);
@@ -145,17 +181,62 @@ private:
 
     std::atomic_bool _isShuttingDown{false};
 
-    // receiving
-    std::atomic<uint32_t> _currentMsgSize{0u};
-    std::vector<uint8_t> _msgBuffer;
+    // With multiple I/O worker threads or the dedicated dispatch thread, the messages are queued and the socket
+    // operations are started on the strand of the socket. The received bus messages are deserialized there, before they
+    // are delivered on the I/O thread.
+    bool _hasOwnStrand{false};
+    // Received messages other than bus messages, which were not yet processed on the I/O thread. A handshake among
+    // them may change the protocol version, so the bus messages are only deserialized on the strand if there are none.
+    std::atomic<size_t> _pendingControlMessages{0};
+
+    // receiving: dispatched messages borrow their slice of the receive buffer, which is reused once they are released
+    struct ReceiveBuffer
+    {
+        std::vector<uint8_t> storage;
+        //! Cleared with release semantics by the deleter of the lease, after the last dispatched message released it
+        std::atomic<bool> isLent{false};
+    };
+    std::shared_ptr<ReceiveBuffer> _receiveBuffer;
+    //! Shared by the dispatched messages, its deleter hands the receive buffer back to the peer
+    std::shared_ptr<const std::vector<uint8_t>> _receiveBufferLease;
+    size_t _rPos{0};
     size_t _wPos{0};
     MutableBuffer _currentReceivingBuffer;
 
     // sending
     mutable std::mutex _sendingQueueMutex;
-    std::deque<std::vector<uint8_t>> _sendingQueue;
-    ConstBuffer _currentSendingBuffer;
-    std::vector<uint8_t> _currentSendingBufferData;
+    std::deque<SerializedFrame> _sendingQueue;
+    // frames drained from the sending queue and written as a single gather list of headers and (optional) shared payloads
+    std::vector<SerializedFrame> _currentSendingFrames;
+    std::vector<ConstBuffer> _currentSendingBuffers;
+    size_t _currentSendingBufferIndex{0};
+    size_t _sendBatchMaxBytes{0};
+    size_t _sendBatchMaxBuffers{0};
+
+    // send queue limits: once the queued bytes exceed the high watermark, the policy applies until the queue is
+    // drained to the low watermark
+    size_t _sendingQueueBytes{0};
+    size_t _sendQueueHighWatermark{0};
+    size_t _sendQueueLowWatermark{0};
+    Config::Middleware::SendQueuePolicy _sendQueuePolicy{Config::Middleware::SendQueuePolicy::Block};
+    bool _sendQueueOverflow{false};
+    SendQueueStatus _sendQueueStatus;
+
+    // conflation: the position of the queued conflatable frame of each sender and receiver, counted over all frames
+    // which were ever queued, the position of the front of the queue, and the number of discarded frames in it
+    std::map<std::pair<EndpointId, EndpointId>, uint64_t> _conflationIndex;
+    uint64_t _sendingQueueFrontPosition{0};
+    size_t _discardedFrameCount{0};
+
+    // message batching: simulation messages are appended to a single container, which is queued at a flush point
+    std::atomic_bool _messageBatching{false};
+    size_t _messageBatchMaxBytes{0};
+    std::vector<uint8_t> _messageBatch;
+    size_t _messageBatchMessageCount{0};
+    std::chrono::steady_clock::time_point _messageBatchQueueTime{};
+
+    // transport metrics of the connection to the peer, if they are collected
+    std::atomic<PeerMetricsRecorder*> _metrics{nullptr};
 
     std::atomic_bool _sending{false};
     bool _enableQuickAck{false};
@@ -111,6 +111,12 @@ auto VAsioProxyPeer::GetProtocolVersion() const -> ProtocolVersion
     return _protocolVersion;
 }
 
+auto VAsioProxyPeer::GetSendQueueStatus() const -> SendQueueStatus
+{
+    // proxied messages are queued by the peer connected to the proxy, i.e., the registry
+    return _peer->GetSendQueueStatus();
+}
+
 // ================================================================================
 //  IServiceEndpoint via IVAsioConnectionPeer
 // ================================================================================
@@ -57,6 +57,7 @@ public: // IVAsioPeer via IVAsioConnectionPeer
     void DrainAllBuffers() override;
     void SetProtocolVersion(ProtocolVersion v) override;
     auto GetProtocolVersion() const -> ProtocolVersion override;
+    auto GetSendQueueStatus() const -> SendQueueStatus override;
 
 public: // IServiceEndpoint via IVAsioConnectionPeer
     void SetServiceDescriptor(const ServiceDescriptor& serviceDescriptor) override;
@@ -28,31 +28,13 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "MessageTracing.hpp"
 #include "IServiceEndpoint.hpp"
 #include "SerializedMessage.hpp"
+#include "RemoteServiceEndpointRegistry.hpp"
+
+#include <functional>
 
 namespace SilKit {
 namespace Core {
 
-struct RemoteServiceEndpoint : IServiceEndpoint
-{
-    void SetServiceDescriptor(const SilKit::Core::ServiceDescriptor&) override 
-    {
-        throw LogicError("This method is not supposed to be used in this struct.");
-    }
-
-    auto GetServiceDescriptor() const -> const ServiceDescriptor & override
-    {
-        return _serviceDescriptor; 
-    }
-
-    RemoteServiceEndpoint(const ServiceDescriptor& descriptor)
-    {
-        _serviceDescriptor = descriptor;
-    }
-
-private:
-    ServiceDescriptor _serviceDescriptor;
-};
-
 class MessageBuffer;
 
 class IVAsioReceiver
@@ -62,7 +44,11 @@ public:
     // Public interface methods
     virtual ~IVAsioReceiver() = default;
     virtual auto GetDescriptor() const -> const VAsioMsgSubscriber& = 0;
-    virtual void ReceiveRawMsg(IVAsioPeer* from, const ServiceDescriptor& descriptor, SerializedMessage&& buffer) = 0;
+    virtual void ReceiveRawMsg(IVAsioPeer* from, const IServiceEndpoint& remoteEndpoint, SerializedMessage&& buffer) = 0;
+    //! Deserializes the message, which may happen on the strand of the peer. The returned function distributes it
+    //! to the local receivers, like ReceiveRawMsg, and must be invoked on the I/O thread.
+    virtual auto DeserializeRawMsg(SerializedMessage&& buffer)
+        -> std::function<void(const IServiceEndpoint& remoteEndpoint)> = 0;
 };
 
 template <class MsgT>
@@ -79,7 +65,9 @@ public:
     // ----------------------------------------
     // Public interface methods
     auto GetDescriptor() const -> const VAsioMsgSubscriber& override;
-    void ReceiveRawMsg(IVAsioPeer* from, const ServiceDescriptor& descriptor, SerializedMessage&& buffer) override;
+    void ReceiveRawMsg(IVAsioPeer* from, const IServiceEndpoint& remoteEndpoint, SerializedMessage&& buffer) override;
+    auto DeserializeRawMsg(SerializedMessage&& buffer)
+        -> std::function<void(const IServiceEndpoint& remoteEndpoint)> override;
     void SetServiceDescriptor(const ServiceDescriptor& serviceDescriptor) override
     {
         _serviceDescriptor = serviceDescriptor;
@@ -117,15 +105,34 @@ auto VAsioReceiver<MsgT>::GetDescriptor() const -> const VAsioMsgSubscriber&
 }
 
 template <class MsgT>
-void VAsioReceiver<MsgT>::ReceiveRawMsg(IVAsioPeer* /*from*/, const ServiceDescriptor& descriptor, SerializedMessage&& buffer)
+void VAsioReceiver<MsgT>::ReceiveRawMsg(IVAsioPeer* /*from*/, const IServiceEndpoint& remoteEndpoint, SerializedMessage&& buffer)
 {
-    MsgT msg = buffer.Deserialize<MsgT>();
+    auto* metrics = _link->GetMetrics();
+    auto msg = [&buffer, metrics] {
+        ScopedDurationMeasurement measurement{metrics != nullptr ? &metrics->deserializationTime : nullptr};
+        return buffer.Deserialize<MsgT>();
+    }();
 
-    Services::TraceRx(_logger, this, msg, descriptor);
+    Services::TraceRx(_logger, this, msg, remoteEndpoint.GetServiceDescriptor());
+
+    _link->DistributeRemoteSilKitMessage(&remoteEndpoint, std::move(msg));
+}
+
+template <class MsgT>
+auto VAsioReceiver<MsgT>::DeserializeRawMsg(SerializedMessage&& buffer)
+    -> std::function<void(const IServiceEndpoint& remoteEndpoint)>
+{
+    auto* metrics = _link->GetMetrics();
+    auto msg = [&buffer, metrics] {
+        ScopedDurationMeasurement measurement{metrics != nullptr ? &metrics->deserializationTime : nullptr};
+        return buffer.Deserialize<MsgT>();
+    }();
 
-    auto remoteId = RemoteServiceEndpoint(descriptor);
-    _link->DistributeRemoteSilKitMessage(&remoteId, std::move(msg));
+    return [this, msg = std::move(msg)](const IServiceEndpoint& remoteEndpoint) mutable {
+        Services::TraceRx(_logger, this, msg, remoteEndpoint.GetServiceDescriptor());
 
+        _link->DistributeRemoteSilKitMessage(&remoteEndpoint, std::move(msg));
+    };
 }
 
 } // namespace Core
@@ -31,6 +31,11 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "traits/SilKitMsgTraits.hpp"
 
 #include "SerializedMessage.hpp"
+#include "ContentFilter.hpp"
+
+#include <map>
+#include <memory>
+#include <unordered_map>
 
 namespace SilKit {
 namespace Core {
@@ -78,9 +83,32 @@ private:
 };
 
 
+//! True, if the message passes the content filter of a remote subscriber. Overloaded for messages whose content can
+//! be filtered, e.g., WireDataMessageEvent. All other messages pass any filter.
+template<typename MsgT>
+bool PassesContentFilter(const MsgT& /*msg*/, const Util::ContentFilter& /*filter*/)
+{
+    return true;
+}
+
+using RemoteContentFilters = std::vector<Util::ContentFilter>;
+
+//! What a subscriber of a remote participant wants to receive
+struct RemoteSubscription
+{
+    //! Only messages passing the filter are sent, an empty filter accepts all messages
+    Util::ContentFilter contentFilter;
+    //! Queued messages which are not yet sent are replaced by newer ones
+    bool latestValueOnly{false};
+};
+
 struct RemoteReceiver {
     IVAsioPeer* peer;
     EndpointId remoteIdx;
+    //! Messages are only sent if they pass any of the filters. Null, if all messages are sent.
+    std::shared_ptr<const RemoteContentFilters> contentFilters;
+    //! Only the latest message is kept in the send queue, if all subscribers of the participant want latest values
+    bool latestValueOnly{false};
 };
 
 template <class MsgT>
@@ -104,6 +132,7 @@ public:
 
 
         _serviceDescriptor.SetParticipantNameAndComputeId(peer->GetInfo().participantName);
+        ApplyRemoteSubscriptions(remoteReceiver);
         _remoteReceivers.push_back(remoteReceiver);
         _hist.NotifyPeer(peer, remoteIdx);
     }
@@ -151,8 +180,7 @@ public:
                 << "', which is not a valid remote receiver.";
             throw SilKitError{ss.str()};
         }
-        auto buffer = SerializedMessage(msg, to_endpointAddress(from->GetServiceDescriptor()), receiverIter->remoteIdx);
-        receiverIter->peer->SendSilKitMsg(std::move(buffer));
+        SendSerialized(*receiverIter, msg, to_endpointAddress(from->GetServiceDescriptor()));
     }
 
     void SetHistoryLength(size_t historyLength)
@@ -160,15 +188,79 @@ public:
         _hist.SetHistoryLength(historyLength);
     }
 
+    //! Set the subscription of a subscriber of a remote participant, a null subscription removes the subscriber.
+    //! Messages are only sent to the participant if they pass the content filter of any of its subscribers, or if it
+    //! has no known subscribers. Queued messages are only replaced by newer ones, if all of its subscribers want the
+    //! latest value only.
+    void SetRemoteSubscription(const std::string& participantName, EndpointId subscriberId,
+                               std::shared_ptr<const RemoteSubscription> subscription)
+    {
+        auto& subscriptions = _remoteSubscriptions[participantName];
+        if (subscription)
+        {
+            subscriptions[subscriberId] = std::move(subscription);
+        }
+        else
+        {
+            subscriptions.erase(subscriberId);
+        }
+        if (subscriptions.empty())
+        {
+            _remoteSubscriptions.erase(participantName);
+        }
+
+        for (auto& receiver : _remoteReceivers)
+        {
+            if (receiver.peer->GetInfo().participantName == participantName)
+            {
+                ApplyRemoteSubscriptions(receiver);
+            }
+        }
+    }
+
 public:
     // ----------------------------------------
     // Public interface methods
     void ReceiveMsg(const IServiceEndpoint* from, const MsgT& msg) override
     {
         _hist.Save(from, msg);
+
+        if (_remoteReceivers.empty())
+        {
+            return;
+        }
+
+        const auto endpointAddress = to_endpointAddress(from->GetServiceDescriptor());
+
+        // The message may carry its serialized body, e.g., a data message published from a loaned buffer
+        auto payload = GetSerializedPayload(msg);
+
+        if (payload == nullptr && _remoteReceivers.size() == 1)
+        {
+            auto& receiver = _remoteReceivers.front();
+            if (!PassesRemoteContentFilters(receiver, msg))
+            {
+                return;
+            }
+            SendSerialized(receiver, msg, endpointAddress, receiver.latestValueOnly);
+            return;
+        }
+
+        // Fan-out: serialize the message body once, only the network headers are written per remote receiver. The
+        // content filters are evaluated first, so a message which no receiver accepts is not serialized at all.
         for (auto& receiver : _remoteReceivers)
         {
-            auto buffer = SerializedMessage(msg, to_endpointAddress(from->GetServiceDescriptor()), receiver.remoteIdx);
+            if (!PassesRemoteContentFilters(receiver, msg))
+            {
+                continue;
+            }
+            if (payload == nullptr)
+            {
+                payload = SerializePayload(msg);
+            }
+            auto buffer = SerializedMessage(messageKind<MsgT>(), endpointAddress, receiver.remoteIdx, payload);
+            buffer.SetDroppable(SilKitMsgTraits<MsgT>::IsDroppable());
+            buffer.SetConflatable(receiver.latestValueOnly);
             receiver.peer->SendSilKitMsg(std::move(buffer));
         }
     }
@@ -182,11 +274,75 @@ public:
     {
         return _serviceDescriptor;
     }
+private:
+    // ----------------------------------------
+    // private methods
+    //! The message is serialized on the sending thread, a peer with its own strand only queues it there
+    static void SendSerialized(const RemoteReceiver& receiver, const MsgT& msg, const EndpointAddress& endpointAddress,
+                               bool conflatable = false)
+    {
+        auto buffer = SerializedMessage(msg, endpointAddress, receiver.remoteIdx);
+        buffer.SetDroppable(SilKitMsgTraits<MsgT>::IsDroppable());
+        buffer.SetConflatable(conflatable);
+        receiver.peer->SendSilKitMsg(std::move(buffer));
+    }
+
+    void ApplyRemoteSubscriptions(RemoteReceiver& receiver) const
+    {
+        receiver.contentFilters = nullptr;
+        receiver.latestValueOnly = false;
+
+        auto it = _remoteSubscriptions.find(receiver.peer->GetInfo().participantName);
+        if (it == _remoteSubscriptions.end())
+        {
+            return;
+        }
+
+        auto contentFilters = std::make_shared<RemoteContentFilters>();
+        bool latestValueOnly{true};
+        for (const auto& kv : it->second)
+        {
+            const auto& subscription = *kv.second;
+            // A subscriber without filter receives all messages
+            if (contentFilters && subscription.contentFilter.empty())
+            {
+                contentFilters = nullptr;
+            }
+            if (contentFilters)
+            {
+                contentFilters->push_back(subscription.contentFilter);
+            }
+            latestValueOnly = latestValueOnly && subscription.latestValueOnly;
+        }
+
+        receiver.contentFilters = std::move(contentFilters);
+        receiver.latestValueOnly = latestValueOnly;
+    }
+
+    static bool PassesRemoteContentFilters(const RemoteReceiver& receiver, const MsgT& msg)
+    {
+        if (!receiver.contentFilters)
+        {
+            return true;
+        }
+        for (const auto& filter : *receiver.contentFilters)
+        {
+            if (PassesContentFilter(msg, filter))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
 private:
     // ----------------------------------------
     // private members
     std::vector<RemoteReceiver> _remoteReceivers;
     ServiceDescriptor _serviceDescriptor;
+    //! Subscriptions of the subscribers of the remote participants, by participant name and subscriber service id
+    std::unordered_map<std::string, std::map<EndpointId, std::shared_ptr<const RemoteSubscription>>>
+        _remoteSubscriptions;
 };
 
 // ================================================================================
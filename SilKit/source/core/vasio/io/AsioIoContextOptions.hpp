@@ -0,0 +1,26 @@
+#pragma once
+
+
+#include <cstddef>
+
+
+namespace VSilKit {
+
+
+struct AsioIoContextOptions
+{
+    //! Number of threads running the I/O handlers. With more than one thread, each stream is served by its own strand.
+    size_t ioWorkerThreads{1};
+    //! Run the handlers submitted via Post and Dispatch on a dedicated thread, instead of the I/O worker threads.
+    bool dedicatedDispatchThread{false};
+};
+
+
+} // namespace VSilKit
+
+
+namespace SilKit {
+namespace Core {
+using VSilKit::AsioIoContextOptions;
+} // namespace Core
+} // namespace SilKit
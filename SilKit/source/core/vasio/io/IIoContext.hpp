@@ -25,6 +25,9 @@ struct IIoContext
 
     virtual void Dispatch(std::function<void()> function) = 0;
 
+    //! True, if the calling thread is currently executing handlers of this context
+    virtual auto IsRunningInThisThread() -> bool = 0;
+
     virtual auto ConnectTcp(const std::string& address, uint16_t port, std::error_code& errorCode)
         -> std::unique_ptr<IRawByteStream> = 0;
 
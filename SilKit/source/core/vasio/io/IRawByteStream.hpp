@@ -3,6 +3,8 @@
 
 #include "util/Buffer.hpp"
 
+#include <functional>
+
 
 namespace VSilKit {
 
@@ -28,6 +30,13 @@ struct IRawByteStream
     virtual void AsyncWriteSome(ConstBufferSequence bufferSequence) = 0;
 
     virtual void Shutdown() = 0;
+
+    //! Executes the function on the executor of the stream, which also runs its completion handlers. With multiple
+    //! I/O worker threads, this is the strand of the stream. The asynchronous operations must be started from there.
+    virtual void Dispatch(std::function<void()> function) = 0;
+
+    //! Like Dispatch, but the function is never executed before returning
+    virtual void Post(std::function<void()> function) = 0;
 };
 
 
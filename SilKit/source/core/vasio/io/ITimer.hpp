@@ -20,6 +20,8 @@ struct ITimer
 
     virtual void AsyncWaitFor(std::chrono::nanoseconds duration) = 0;
 
+    virtual void AsyncWaitUntil(std::chrono::steady_clock::time_point expiry) = 0;
+
     virtual void Shutdown() = 0;
 };
 
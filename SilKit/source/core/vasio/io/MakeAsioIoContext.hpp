@@ -3,6 +3,7 @@
 
 #include "IIoContext.hpp"
 #include "AsioSocketOptions.hpp"
+#include "AsioIoContextOptions.hpp"
 
 #include "ILogger.hpp"
 
@@ -12,7 +13,8 @@
 namespace VSilKit {
 
 
-auto MakeAsioIoContext(const AsioSocketOptions& socketOptions) -> std::unique_ptr<IIoContext>;
+auto MakeAsioIoContext(const AsioSocketOptions& socketOptions, const AsioIoContextOptions& ioContextOptions = {})
+    -> std::unique_ptr<IIoContext>;
 
 
 } // namespace VSilKit
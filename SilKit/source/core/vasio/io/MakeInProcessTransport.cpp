@@ -0,0 +1,148 @@
+#include "MakeInProcessTransport.hpp"
+
+#include "impl/InProcessRawByteStream.hpp"
+
+#include "util/TracingMacros.hpp"
+
+#include <map>
+#include <mutex>
+
+
+namespace {
+
+
+namespace Log = SilKit::Services::Logging;
+
+
+struct AcceptorState
+{
+    std::mutex mutex;
+    VSilKit::IIoContext* ioContext{nullptr};
+    //! Cleared when the acceptor is shut down, connections which are still being delivered are dropped
+    VSilKit::IInProcessAcceptorListener* listener{nullptr};
+};
+
+
+//! All in-process acceptors of this process, by the local-domain socket path they accept on
+struct AcceptorRegistry
+{
+    std::mutex mutex;
+    std::map<std::string, std::shared_ptr<AcceptorState>> acceptors;
+
+    static auto Get() -> AcceptorRegistry&
+    {
+        static AcceptorRegistry registry;
+        return registry;
+    }
+};
+
+
+class InProcessAcceptor final : public VSilKit::IInProcessAcceptor
+{
+    std::string _path;
+    std::shared_ptr<AcceptorState> _state;
+
+public:
+    InProcessAcceptor(std::string path, std::shared_ptr<AcceptorState> state)
+        : _path{std::move(path)}
+        , _state{std::move(state)}
+    {
+    }
+
+    ~InProcessAcceptor() override
+    {
+        Shutdown();
+    }
+
+    void Shutdown() override
+    {
+        {
+            auto& registry = AcceptorRegistry::Get();
+            std::unique_lock<decltype(registry.mutex)> lock{registry.mutex};
+
+            auto it = registry.acceptors.find(_path);
+            if (it != registry.acceptors.end() && it->second == _state)
+            {
+                registry.acceptors.erase(it);
+            }
+        }
+
+        std::unique_lock<decltype(_state->mutex)> lock{_state->mutex};
+        _state->listener = nullptr;
+    }
+};
+
+
+} // namespace
+
+
+namespace VSilKit {
+
+
+auto MakeInProcessAcceptor(IIoContext& ioContext, const std::string& path, IInProcessAcceptorListener& listener,
+                           SilKit::Services::Logging::ILogger& logger) -> std::unique_ptr<IInProcessAcceptor>
+{
+    auto state = std::make_shared<AcceptorState>();
+    state->ioContext = &ioContext;
+    state->listener = &listener;
+
+    {
+        auto& registry = AcceptorRegistry::Get();
+        std::unique_lock<decltype(registry.mutex)> lock{registry.mutex};
+
+        // the local-domain acceptor was opened on the same path, which replaced the socket file of any previous one
+        registry.acceptors[path] = state;
+    }
+
+    Log::Debug(&logger, "InProcessAcceptor: accepting participants of this process on '{}'", path);
+
+    return std::make_unique<InProcessAcceptor>(path, std::move(state));
+}
+
+
+auto ConnectInProcess(IIoContext& ioContext, const std::string& path, SilKit::Services::Logging::ILogger& logger)
+    -> std::unique_ptr<IRawByteStream>
+{
+    std::shared_ptr<AcceptorState> state;
+
+    {
+        auto& registry = AcceptorRegistry::Get();
+        std::unique_lock<decltype(registry.mutex)> lock{registry.mutex};
+
+        auto it = registry.acceptors.find(path);
+        if (it == registry.acceptors.end())
+        {
+            return nullptr;
+        }
+
+        state = it->second;
+    }
+
+    std::unique_lock<decltype(state->mutex)> lock{state->mutex};
+
+    if (state->listener == nullptr)
+    {
+        return nullptr;
+    }
+
+    auto streams = InProcessRawByteStream::MakePair(ioContext, *state->ioContext, path, logger);
+
+    // the accepted stream is handed to the listener on the I/O context of the acceptor, like an accepted socket. If
+    // the acceptor is shut down in the meantime, the stream is destroyed, which shuts down the connecting side.
+    auto acceptedStream = std::make_shared<std::unique_ptr<IRawByteStream>>(std::move(streams.second));
+    state->ioContext->Post([state, acceptedStream] {
+        std::unique_lock<decltype(state->mutex)> lock{state->mutex};
+
+        if (state->listener != nullptr)
+        {
+            state->listener->OnInProcessAccept(std::move(*acceptedStream));
+        }
+    });
+
+    Log::Debug(&logger, "InProcessAcceptor: connected to '{}' without a socket", path);
+
+    return std::move(streams.first);
+}
+
+
+} // namespace VSilKit
@@ -0,0 +1,56 @@
+#pragma once
+
+
+#include "IIoContext.hpp"
+#include "IRawByteStream.hpp"
+
+#include "ILogger.hpp"
+
+#include <memory>
+#include <string>
+
+
+namespace VSilKit {
+
+
+struct IInProcessAcceptorListener
+{
+    virtual ~IInProcessAcceptorListener() = default;
+
+    //! Called on the I/O context of the acceptor for every participant of the same process connecting to it
+    virtual void OnInProcessAccept(std::unique_ptr<IRawByteStream> stream) = 0;
+};
+
+
+struct IInProcessAcceptor
+{
+    //! The acceptor stops accepting once it is shut down or destroyed
+    virtual ~IInProcessAcceptor() = default;
+
+    virtual void Shutdown() = 0;
+};
+
+
+//! Accepts connections from participants in the same process to the given local-domain socket path. It is opened
+//! alongside the local-domain acceptor of the path, connecting through the socket is still possible.
+auto MakeInProcessAcceptor(IIoContext& ioContext, const std::string& path, IInProcessAcceptorListener& listener,
+                           SilKit::Services::Logging::ILogger& logger) -> std::unique_ptr<IInProcessAcceptor>;
+
+//! Connects to the in-process acceptor of the local-domain socket path. The returned stream copies the written bytes
+//! directly into the read buffers of the other side, without a socket. Returns nullptr if the path has no in-process
+//! acceptor, i.e., the participant which accepts on the path lives in another process.
+auto ConnectInProcess(IIoContext& ioContext, const std::string& path, SilKit::Services::Logging::ILogger& logger)
+    -> std::unique_ptr<IRawByteStream>;
+
+
+} // namespace VSilKit
+
+
+namespace SilKit {
+namespace Core {
+using VSilKit::IInProcessAcceptorListener;
+using VSilKit::IInProcessAcceptor;
+using VSilKit::MakeInProcessAcceptor;
+using VSilKit::ConnectInProcess;
+} // namespace Core
+} // namespace SilKit
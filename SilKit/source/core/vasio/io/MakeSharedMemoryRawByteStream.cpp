@@ -0,0 +1,41 @@
+#include "MakeSharedMemoryRawByteStream.hpp"
+
+#include "util/Exceptions.hpp"
+
+#if !defined(_WIN32)
+#    include "impl/SharedMemoryRawByteStream.hpp"
+#endif
+
+
+namespace VSilKit {
+
+
+auto IsSharedMemoryTransportSupported() -> bool
+{
+#if defined(_WIN32)
+    return false;
+#else
+    return true;
+#endif
+}
+
+
+auto MakeSharedMemoryRawByteStream(std::unique_ptr<IRawByteStream> stream, SharedMemoryRole role,
+                                   const SharedMemoryRawByteStreamOptions& options,
+                                   SilKit::Services::Logging::ILogger& logger) -> std::unique_ptr<IRawByteStream>
+{
+#if defined(_WIN32)
+    (void)stream;
+    (void)role;
+    (void)options;
+    (void)logger;
+    throw NotImplementedError{};
+#else
+    auto sharedMemoryStream = std::make_unique<SharedMemoryRawByteStream>(std::move(stream), role, options, logger);
+    sharedMemoryStream->Start();
+    return sharedMemoryStream;
+#endif
+}
+
+
+} // namespace VSilKit
@@ -0,0 +1,53 @@
+#pragma once
+
+
+#include "IRawByteStream.hpp"
+
+#include "ILogger.hpp"
+
+#include <memory>
+
+#include <cstddef>
+
+
+namespace VSilKit {
+
+
+enum struct SharedMemoryRole
+{
+    //! Creates the shared memory segment and offers it to the peer
+    Offer,
+    //! Maps the shared memory segment offered by the peer, or passes the stream through if the peer offers none
+    Answer,
+};
+
+
+struct SharedMemoryRawByteStreamOptions
+{
+    //! Size of each of the two ring buffers (one per direction) in the shared memory segment
+    size_t ringSize{1024 * 1024};
+};
+
+
+//! True, if the shared memory transport is available on this platform
+auto IsSharedMemoryTransportSupported() -> bool;
+
+//! Wraps a connected local-domain stream. The stream is used to negotiate the shared memory segment and to notify the
+//! peer about new data and free space. All payload is transferred through the shared memory. If the negotiation
+//! fails, the wrapped stream is used as-is.
+auto MakeSharedMemoryRawByteStream(std::unique_ptr<IRawByteStream> stream, SharedMemoryRole role,
+                                   const SharedMemoryRawByteStreamOptions& options,
+                                   SilKit::Services::Logging::ILogger& logger) -> std::unique_ptr<IRawByteStream>;
+
+
+} // namespace VSilKit
+
+
+namespace SilKit {
+namespace Core {
+using VSilKit::SharedMemoryRole;
+using VSilKit::SharedMemoryRawByteStreamOptions;
+using VSilKit::IsSharedMemoryTransportSupported;
+using VSilKit::MakeSharedMemoryRawByteStream;
+} // namespace Core
+} // namespace SilKit
@@ -3,6 +3,7 @@
 #include "IAcceptor.hpp"
 #include "IIoContext.hpp"
 
+#include "AsioIoContext.hpp"
 #include "AsioCleanupEndpoint.hpp"
 #include "AsioGenericRawByteStream.hpp"
 #include "AsioFormatEndpoint.hpp"
@@ -37,7 +38,7 @@ class AsioAcceptor final : public IAcceptor
         PENDING,
     };
 
-    IIoContext* _ioContext{nullptr};
+    AsioIoContext* _ioContext{nullptr};
     IAcceptorListener* _listener{nullptr};
 
     AtomicEnum<State> _state{IDLE};
@@ -55,7 +56,7 @@ class AsioAcceptor final : public IAcceptor
     SilKit::Services::Logging::ILogger* _logger{nullptr};
 
 public:
-    AsioAcceptor(IIoContext& ioContext, const AsioSocketOptions& socketOptions, AsioAcceptorType acceptor,
+    AsioAcceptor(AsioIoContext& ioContext, const AsioSocketOptions& socketOptions, AsioAcceptorType acceptor,
                  SilKit::Services::Logging::ILogger& logger);
     ~AsioAcceptor() override;
 
@@ -68,11 +69,12 @@ public: // IAcceptor
 private:
     void OnAsioAsyncAcceptComplete(const asio::error_code& asioErrorCode, AsioSocketType socket);
     void OnAsioAsyncWaitComplete(const asio::error_code& errorCode);
+    void NotifyAcceptFailure();
 };
 
 
 template <typename T>
-AsioAcceptor<T>::AsioAcceptor(IIoContext& ioContext, const AsioSocketOptions& socketOptions, AsioAcceptorType acceptor,
+AsioAcceptor<T>::AsioAcceptor(AsioIoContext& ioContext, const AsioSocketOptions& socketOptions, AsioAcceptorType acceptor,
                               SilKit::Services::Logging::ILogger& logger)
     : _ioContext{&ioContext}
     , _socketOptions{socketOptions}
@@ -135,7 +137,8 @@ void AsioAcceptor<T>::AsyncAccept(std::chrono::milliseconds timeout)
         _timeoutTimer.async_wait(timeoutCompletionHandler);
     }
 
-    _acceptor.async_accept(acceptCompletionHandler);
+    // the accepted socket is served by its own executor, independent of the acceptor
+    _acceptor.async_accept(_ioContext->MakeSocketExecutor(), acceptCompletionHandler);
 }
 
 
@@ -159,7 +162,7 @@ void AsioAcceptor<T>::OnAsioAsyncAcceptComplete(const asio::error_code& asioErro
 
     if (asioErrorCode)
     {
-        _listener->OnAsyncAcceptFailure(*this);
+        NotifyAcceptFailure();
         return;
     }
 
@@ -169,7 +172,7 @@ void AsioAcceptor<T>::OnAsioAsyncAcceptComplete(const asio::error_code& asioErro
     if (errorCode)
     {
         SILKIT_TRACE_METHOD(_logger, "failed to set socket options: {}", errorCode.message());
-        _listener->OnAsyncAcceptFailure(*this);
+        NotifyAcceptFailure();
         return;
     }
 
@@ -179,10 +182,23 @@ void AsioAcceptor<T>::OnAsioAsyncAcceptComplete(const asio::error_code& asioErro
     AsioGenericRawByteStreamOptions options{};
     options.tcp.quickAck = isTcp && _socketOptions.tcp.quickAck;
 
-    auto stream{std::make_unique<AsioGenericRawByteStream>(*_ioContext, options, std::move(socket), *_logger)};
+    // std::function requires a copyable handler, the stream is handed over through a shared pointer
+    auto stream{std::make_shared<std::unique_ptr<IRawByteStream>>(
+        std::make_unique<AsioGenericRawByteStream>(*_ioContext, options, std::move(socket), *_logger))};
 
     _timeoutCancelSignal.emit(asio::cancellation_type::total);
-    _listener->OnAsyncAcceptSuccess(*this, std::move(stream));
+    _ioContext->Dispatch([this, stream] {
+        _listener->OnAsyncAcceptSuccess(*this, std::move(*stream));
+    });
+}
+
+
+template <typename T>
+void AsioAcceptor<T>::NotifyAcceptFailure()
+{
+    _ioContext->Dispatch([this] {
+        _listener->OnAsyncAcceptFailure(*this);
+    });
 }
 
 
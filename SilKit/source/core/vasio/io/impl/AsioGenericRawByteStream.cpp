@@ -173,6 +173,18 @@ void AsioGenericRawByteStream::Shutdown()
 }
 
 
+void AsioGenericRawByteStream::Dispatch(std::function<void()> function)
+{
+    asio::dispatch(_socket.get_executor(), std::move(function));
+}
+
+
+void AsioGenericRawByteStream::Post(std::function<void()> function)
+{
+    asio::post(_socket.get_executor(), std::move(function));
+}
+
+
 void AsioGenericRawByteStream::OnAsioAsyncReadSomeComplete(asio::error_code const& errorCode, size_t bytesTransferred)
 {
     SILKIT_TRACE_METHOD(_logger, "({}, {})", errorCode.message(), bytesTransferred);
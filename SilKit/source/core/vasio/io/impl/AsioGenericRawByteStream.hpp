@@ -61,6 +61,8 @@ public: // IRawByteStream
     void AsyncReadSome(MutableBufferSequence bufferSequence) override;
     void AsyncWriteSome(ConstBufferSequence bufferSequence) override;
     void Shutdown() override;
+    void Dispatch(std::function<void()> function) override;
+    void Post(std::function<void()> function) override;
 
 private:
     void OnAsioAsyncReadSomeComplete(const asio::error_code& errorCode, size_t bytesTransferred);
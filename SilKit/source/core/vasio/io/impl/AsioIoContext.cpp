@@ -7,11 +7,16 @@
 #include "util/Exceptions.hpp"
 #include "util/TracingMacros.hpp"
 
+#include "SetThreadName.hpp"
+
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <mutex>
 #include <regex> // IsIPv4 / IsIPv6
+#include <thread>
 #include <unordered_set>
+#include <vector>
 
 #include "asio.hpp"
 
@@ -120,9 +125,20 @@ void SetListenOptions(SilKit::Services::Logging::ILogger*, asio::ip::tcp::accept
 } // namespace
 
 
-AsioIoContext::AsioIoContext(const AsioSocketOptions& socketOptions)
+AsioIoContext::AsioIoContext(const AsioSocketOptions& socketOptions, const AsioIoContextOptions& ioContextOptions)
     : _socketOptions{socketOptions}
+    , _ioContextOptions{ioContextOptions}
 {
+    _ioContextOptions.ioWorkerThreads = (std::max)(_ioContextOptions.ioWorkerThreads, size_t{1});
+
+    if (_ioContextOptions.dedicatedDispatchThread)
+    {
+        _dispatchContext = std::make_unique<asio::io_context>();
+    }
+    else if (_ioContextOptions.ioWorkerThreads > 1)
+    {
+        _strand = std::make_unique<Strand>(_ioContext.get_executor());
+    }
 }
 
 
@@ -136,19 +152,130 @@ void AsioIoContext::Run()
 {
     SILKIT_TRACE_METHOD(_logger, "()");
 
-    _ioContext.run();
+    if (_ioContextOptions.ioWorkerThreads == 1 && _dispatchContext == nullptr)
+    {
+        _ioContext.run();
+        return;
+    }
+
+    // the calling thread is one of the I/O worker threads
+    std::vector<std::thread> workers;
+    for (size_t index = 1; index < _ioContextOptions.ioWorkerThreads; ++index)
+    {
+        workers.emplace_back([this] {
+            SilKit::Util::SetThreadName("SilKit-IO");
+            RunWorker(_ioContext);
+        });
+    }
+
+    // the dispatch thread must not return while it is idle, it is only released once the I/O context ran out of work
+    using WorkGuard = asio::executor_work_guard<asio::io_context::executor_type>;
+    std::unique_ptr<WorkGuard> dispatchWork;
+    std::thread dispatcher;
+    if (_dispatchContext != nullptr)
+    {
+        dispatchWork = std::make_unique<WorkGuard>(_dispatchContext->get_executor());
+        dispatcher = std::thread{[this] {
+            SilKit::Util::SetThreadName("SilKit-Dispatch");
+            RunWorker(*_dispatchContext);
+        }};
+    }
+
+    RunWorker(_ioContext);
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    if (dispatcher.joinable())
+    {
+        dispatchWork.reset();
+        dispatcher.join();
+    }
 }
 
 
 void AsioIoContext::Post(std::function<void()> function)
 {
-    _ioContext.post(std::move(function));
+    if (_dispatchContext != nullptr)
+    {
+        // handlers waiting for the dispatch thread keep the I/O context from running out of work
+        asio::post(*_dispatchContext, [work = asio::make_work_guard(_ioContext), function = std::move(function)] {
+            function();
+        });
+    }
+    else if (_strand != nullptr)
+    {
+        asio::post(*_strand, std::move(function));
+    }
+    else
+    {
+        _ioContext.post(std::move(function));
+    }
 }
 
 
 void AsioIoContext::Dispatch(std::function<void()> function)
 {
-    _ioContext.dispatch(std::move(function));
+    if (_dispatchContext != nullptr)
+    {
+        asio::dispatch(*_dispatchContext, [work = asio::make_work_guard(_ioContext), function = std::move(function)] {
+            function();
+        });
+    }
+    else if (_strand != nullptr)
+    {
+        asio::dispatch(*_strand, std::move(function));
+    }
+    else
+    {
+        _ioContext.dispatch(std::move(function));
+    }
+}
+
+
+auto AsioIoContext::IsRunningInThisThread() -> bool
+{
+    if (_dispatchContext != nullptr)
+    {
+        return _dispatchContext->get_executor().running_in_this_thread();
+    }
+
+    if (_strand != nullptr)
+    {
+        return _strand->running_in_this_thread();
+    }
+
+    return _ioContext.get_executor().running_in_this_thread();
+}
+
+
+auto AsioIoContext::MakeSocketExecutor() -> asio::any_io_executor
+{
+    if (_ioContextOptions.ioWorkerThreads > 1)
+    {
+        return asio::make_strand(_ioContext);
+    }
+
+    return _ioContext.get_executor();
+}
+
+
+void AsioIoContext::RunWorker(asio::io_context& ioContext)
+{
+    while (true)
+    {
+        try
+        {
+            ioContext.run();
+            return;
+        }
+        catch (const std::exception& error)
+        {
+            SilKit::Services::Logging::Error(_logger, "SilKit-IOWorker: Something went wrong: {}", error.what());
+        }
+    }
 }
 
 
@@ -196,7 +323,7 @@ auto AsioIoContext::ConnectTcp(const std::string& address, uint16_t port, std::e
     SILKIT_TRACE_METHOD(_logger, "({}, {})", address, port);
 
     asio::ip::tcp::endpoint endpoint{asio::ip::address::from_string(address), port};
-    asio::ip::tcp::socket socket{_ioContext};
+    asio::ip::tcp::socket socket{MakeSocketExecutor()};
 
     socket.open(endpoint.protocol(), errorCode);
     if (errorCode)
@@ -233,7 +360,7 @@ auto AsioIoContext::ConnectLocal(const std::string& path, std::error_code& error
     SILKIT_TRACE_METHOD(_logger, "({})", path);
 
     asio::local::stream_protocol::endpoint endpoint{path};
-    asio::local::stream_protocol::socket socket{_ioContext};
+    asio::local::stream_protocol::socket socket{MakeSocketExecutor()};
 
     socket.connect(endpoint, errorCode);
     if (errorCode)
@@ -254,7 +381,7 @@ auto AsioIoContext::MakeTcpAcceptor(const std::string& ipAddress, uint16_t port)
 
     auto address = CleanIpAddress(ipAddress);
     asio::ip::tcp::endpoint endpoint{asio::ip::make_address(address), port};
-    asio::ip::tcp::acceptor acceptor{_ioContext.get_executor()};
+    asio::ip::tcp::acceptor acceptor{MakeSocketExecutor()};
 
     OpenAcceptor(acceptor, endpoint, *_logger);
 
@@ -267,7 +394,7 @@ auto AsioIoContext::MakeLocalAcceptor(const std::string& path) -> std::unique_pt
     SILKIT_TRACE_METHOD(_logger, "({})", path);
 
     asio::local::stream_protocol::endpoint endpoint{path};
-    asio::local::stream_protocol::acceptor acceptor{_ioContext.get_executor()};
+    asio::local::stream_protocol::acceptor acceptor{MakeSocketExecutor()};
 
     OpenAcceptor(acceptor, endpoint, *_logger);
 
@@ -280,7 +407,7 @@ auto AsioIoContext::MakeTimer() -> std::unique_ptr<ITimer>
     SILKIT_TRACE_METHOD(_logger, "()");
 
     asio::steady_timer timer{_ioContext.get_executor()};
-    return std::make_unique<AsioTimer>(std::move(timer));
+    return std::make_unique<AsioTimer>(*this, std::move(timer));
 }
 
 
@@ -10,6 +10,7 @@
 #include "asio.hpp"
 
 #include <atomic>
+#include <memory>
 #include <mutex>
 #include <unordered_set>
 
@@ -21,18 +22,26 @@ namespace VSilKit {
 
 class AsioIoContext final : public IIoContext
 {
+    using Strand = asio::strand<asio::io_context::executor_type>;
+
     AsioSocketOptions _socketOptions;
+    AsioIoContextOptions _ioContextOptions;
     asio::io_context _ioContext;
+    // serializes the handlers submitted via Post and Dispatch, if multiple I/O worker threads are used
+    std::unique_ptr<Strand> _strand;
+    // runs the handlers submitted via Post and Dispatch on the dedicated dispatch thread
+    std::unique_ptr<asio::io_context> _dispatchContext;
     SilKit::Services::Logging::ILogger* _logger{nullptr};
 
 public:
-    explicit AsioIoContext(const AsioSocketOptions& socketOptions);
+    explicit AsioIoContext(const AsioSocketOptions& socketOptions, const AsioIoContextOptions& ioContextOptions = {});
     ~AsioIoContext() override;
 
 public: // IIoContext
     void Run() override;
     void Post(std::function<void()> function) override;
     void Dispatch(std::function<void()> function) override;
+    auto IsRunningInThisThread() -> bool override;
     auto ConnectTcp(const std::string& address, uint16_t port, std::error_code& errorCode)
         -> std::unique_ptr<IRawByteStream> override;
     auto ConnectLocal(const std::string& path, std::error_code& errorCode) -> std::unique_ptr<IRawByteStream> override;
@@ -41,6 +50,13 @@ public: // IIoContext
     auto MakeTimer() -> std::unique_ptr<ITimer> override;
     auto Resolve(const std::string& name) -> std::vector<std::string> override;
     void SetLogger(SilKit::Services::Logging::ILogger& logger) override;
+
+public:
+    //! Executor for a new stream. Each stream gets its own strand, if multiple I/O worker threads are used.
+    auto MakeSocketExecutor() -> asio::any_io_executor;
+
+private:
+    void RunWorker(asio::io_context& ioContext);
 };
 
 
@@ -8,8 +8,9 @@
 namespace VSilKit {
 
 
-AsioTimer::AsioTimer(asio::steady_timer timer)
-    : _timer{std::move(timer)}
+AsioTimer::AsioTimer(IIoContext& ioContext, asio::steady_timer timer)
+    : _ioContext{&ioContext}
+    , _timer{std::move(timer)}
 {
 }
 
@@ -35,6 +36,15 @@ void AsioTimer::AsyncWaitFor(std::chrono::nanoseconds duration)
 }
 
 
+void AsioTimer::AsyncWaitUntil(std::chrono::steady_clock::time_point expiry)
+{
+    _timer.expires_at(expiry);
+    _timer.async_wait([this](const asio::error_code& e) {
+        OnAsioAsyncWaitComplete(e);
+    });
+}
+
+
 void AsioTimer::Shutdown()
 {
     _timer.cancel();
@@ -45,7 +55,7 @@ void AsioTimer::OnAsioAsyncWaitComplete(const asio::error_code& errorCode)
 {
     SILKIT_UNUSED_ARG(errorCode);
 
-    asio::post(_timer.get_executor(), [&listener = *_listener, &self = *this] {
+    _ioContext->Post([&listener = *_listener, &self = *this] {
         listener.OnTimerExpired(self);
     });
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 
+#include "IIoContext.hpp"
 #include "ITimer.hpp"
 
 #include "asio.hpp"
@@ -11,16 +12,18 @@ namespace VSilKit {
 
 class AsioTimer : public ITimer
 {
+    IIoContext* _ioContext{nullptr};
     ITimerListener* _listener{nullptr};
 
     asio::steady_timer _timer;
 
 public:
-    explicit AsioTimer(asio::steady_timer timer);
+    AsioTimer(IIoContext& ioContext, asio::steady_timer timer);
 
     void SetListener(ITimerListener& listener) override;
     auto GetExpiry() const -> std::chrono::steady_clock::time_point override;
     void AsyncWaitFor(std::chrono::nanoseconds duration) override;
+    void AsyncWaitUntil(std::chrono::steady_clock::time_point expiry) override;
     void Shutdown() override;
 
 private:
@@ -0,0 +1,250 @@
+#include "InProcessRawByteStream.hpp"
+
+#include "IIoContext.hpp"
+
+#include "util/Exceptions.hpp"
+#include "util/TracingMacros.hpp"
+
+#include <algorithm>
+
+#include <cstring>
+
+
+namespace VSilKit {
+
+
+void InProcessPipe::Transfer(size_t writerSide)
+{
+    auto& writer = ends[writerSide];
+    auto& reader = ends[1 - writerSide];
+
+    if (closed || !writer.writing || !reader.reading)
+    {
+        return;
+    }
+
+    size_t transferred{0};
+
+    auto source = writer.writeBuffers.begin();
+    size_t sourceOffset{0};
+
+    for (const auto& target : reader.readBuffers)
+    {
+        size_t targetOffset{0};
+
+        while (targetOffset != target.GetSize() && source != writer.writeBuffers.end())
+        {
+            const auto count = std::min(target.GetSize() - targetOffset, source->GetSize() - sourceOffset);
+            std::memcpy(static_cast<uint8_t*>(target.GetData()) + targetOffset,
+                        static_cast<const uint8_t*>(source->GetData()) + sourceOffset, count);
+
+            targetOffset += count;
+            sourceOffset += count;
+            transferred += count;
+
+            if (sourceOffset == source->GetSize())
+            {
+                ++source;
+                sourceOffset = 0;
+            }
+        }
+    }
+
+    writer.writing = false;
+    writer.writeBuffers.clear();
+    reader.reading = false;
+    reader.readBuffers.clear();
+
+    writer.stream->PostWriteDone(transferred);
+    reader.stream->PostReadDone(transferred);
+}
+
+
+void InProcessPipe::Close()
+{
+    if (closed)
+    {
+        return;
+    }
+
+    closed = true;
+
+    for (auto& end : ends)
+    {
+        end.reading = false;
+        end.readBuffers.clear();
+        end.writing = false;
+        end.writeBuffers.clear();
+
+        if (end.stream != nullptr && !end.shutdownPosted)
+        {
+            end.shutdownPosted = true;
+            end.stream->PostShutdown();
+        }
+    }
+}
+
+
+auto InProcessRawByteStream::MakePair(IIoContext& connectIoContext, IIoContext& acceptIoContext,
+                                      const std::string& path, SilKit::Services::Logging::ILogger& logger)
+    -> std::pair<std::unique_ptr<InProcessRawByteStream>, std::unique_ptr<InProcessRawByteStream>>
+{
+    auto pipe = std::make_shared<InProcessPipe>();
+
+    // the endpoints mirror those of a connected local-domain socket, where only the accepting side has a path
+    auto connectSide =
+        std::make_unique<InProcessRawByteStream>(pipe, 0, connectIoContext, "local://", "local://" + path, logger);
+    auto acceptSide =
+        std::make_unique<InProcessRawByteStream>(pipe, 1, acceptIoContext, "local://" + path, "local://", logger);
+
+    return {std::move(connectSide), std::move(acceptSide)};
+}
+
+
+InProcessRawByteStream::InProcessRawByteStream(std::shared_ptr<InProcessPipe> pipe, size_t side,
+                                               IIoContext& ioContext, std::string localEndpoint,
+                                               std::string remoteEndpoint, SilKit::Services::Logging::ILogger& logger)
+    : _pipe{std::move(pipe)}
+    , _side{side}
+    , _ioContext{&ioContext}
+    , _logger{&logger}
+    , _localEndpoint{std::move(localEndpoint)}
+    , _remoteEndpoint{std::move(remoteEndpoint)}
+{
+    std::unique_lock<decltype(_pipe->mutex)> lock{_pipe->mutex};
+    _pipe->ends[_side].stream = this;
+}
+
+
+InProcessRawByteStream::~InProcessRawByteStream()
+{
+    std::unique_lock<decltype(_pipe->mutex)> lock{_pipe->mutex};
+
+    // no completion is delivered to this end anymore, the other end is notified about the shutdown
+    _pipe->ends[_side].stream = nullptr;
+    _pipe->Close();
+}
+
+
+void InProcessRawByteStream::SetListener(IRawByteStreamListener& listener)
+{
+    _listener = &listener;
+}
+
+
+auto InProcessRawByteStream::GetIoContext() -> IIoContext&
+{
+    return *_ioContext;
+}
+
+
+auto InProcessRawByteStream::GetLocalEndpoint() -> std::string
+{
+    return _localEndpoint;
+}
+
+
+auto InProcessRawByteStream::GetRemoteEndpoint() -> std::string
+{
+    return _remoteEndpoint;
+}
+
+
+void InProcessRawByteStream::AsyncReadSome(MutableBufferSequence bufferSequence)
+{
+    SILKIT_TRACE_METHOD(_logger, "(...)");
+
+    std::unique_lock<decltype(_pipe->mutex)> lock{_pipe->mutex};
+
+    if (_pipe->closed)
+    {
+        SILKIT_TRACE_METHOD(_logger, "ignored, already shutting down");
+        return;
+    }
+
+    auto& end = _pipe->ends[_side];
+    if (end.reading)
+    {
+        throw InvalidStateError{};
+    }
+
+    end.reading = true;
+    end.readBuffers.assign(bufferSequence.begin(), bufferSequence.end());
+
+    _pipe->Transfer(1 - _side);
+}
+
+
+void InProcessRawByteStream::AsyncWriteSome(ConstBufferSequence bufferSequence)
+{
+    SILKIT_TRACE_METHOD(_logger, "(...)");
+
+    std::unique_lock<decltype(_pipe->mutex)> lock{_pipe->mutex};
+
+    if (_pipe->closed)
+    {
+        SILKIT_TRACE_METHOD(_logger, "ignored, already shutting down");
+        return;
+    }
+
+    auto& end = _pipe->ends[_side];
+    if (end.writing)
+    {
+        throw InvalidStateError{};
+    }
+
+    end.writing = true;
+    end.writeBuffers.assign(bufferSequence.begin(), bufferSequence.end());
+
+    _pipe->Transfer(_side);
+}
+
+
+void InProcessRawByteStream::Shutdown()
+{
+    SILKIT_TRACE_METHOD(_logger, "()");
+
+    std::unique_lock<decltype(_pipe->mutex)> lock{_pipe->mutex};
+    _pipe->Close();
+}
+
+
+void InProcessRawByteStream::Dispatch(std::function<void()> function)
+{
+    // the completions are delivered on the I/O context
+    _ioContext->Dispatch(std::move(function));
+}
+
+
+void InProcessRawByteStream::Post(std::function<void()> function)
+{
+    _ioContext->Post(std::move(function));
+}
+
+
+void InProcessRawByteStream::PostReadDone(size_t bytesTransferred)
+{
+    _ioContext->Post([this, bytesTransferred] {
+        _listener->OnAsyncReadSomeDone(*this, bytesTransferred);
+    });
+}
+
+
+void InProcessRawByteStream::PostWriteDone(size_t bytesTransferred)
+{
+    _ioContext->Post([this, bytesTransferred] {
+        _listener->OnAsyncWriteSomeDone(*this, bytesTransferred);
+    });
+}
+
+
+void InProcessRawByteStream::PostShutdown()
+{
+    // posted, so all previously posted completions are delivered before the shutdown
+    _ioContext->Post([this] {
+        _listener->OnShutdown(*this);
+    });
+}
+
+
+} // namespace VSilKit
@@ -0,0 +1,97 @@
+#pragma once
+
+
+#include "IRawByteStream.hpp"
+#include "MakeInProcessTransport.hpp"
+
+#include "ILogger.hpp"
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+
+
+namespace VSilKit {
+
+
+class InProcessRawByteStream;
+
+
+//! The shared state of the two ends of an in-process connection. The pending operations of both ends are kept here,
+//! bytes are copied from the pending write of one end into the pending read of the other end once both are present.
+struct InProcessPipe
+{
+    struct End
+    {
+        //! Cleared when the end is destroyed
+        InProcessRawByteStream* stream{nullptr};
+
+        std::vector<MutableBuffer> readBuffers;
+        bool reading{false};
+        std::vector<ConstBuffer> writeBuffers;
+        bool writing{false};
+
+        bool shutdownPosted{false};
+    };
+
+    std::mutex mutex;
+    std::array<End, 2> ends;
+    bool closed{false};
+
+public: // all of the following must be called with the mutex held
+    //! Copy from the pending write of the given end into the pending read of the other end, if both are present
+    void Transfer(size_t writerSide);
+    //! Cancel the pending operations and notify both ends about the shutdown
+    void Close();
+};
+
+
+class InProcessRawByteStream final : public IRawByteStream
+{
+    std::shared_ptr<InProcessPipe> _pipe;
+    size_t _side;
+
+    IIoContext* _ioContext{nullptr};
+    IRawByteStreamListener* _listener{nullptr};
+    SilKit::Services::Logging::ILogger* _logger{nullptr};
+
+    std::string _localEndpoint;
+    std::string _remoteEndpoint;
+
+public:
+    //! Create both ends of a connection to the given local-domain socket path. The first end is used by the
+    //! connecting participant, the second one by the accepting participant.
+    static auto MakePair(IIoContext& connectIoContext, IIoContext& acceptIoContext, const std::string& path,
+                         SilKit::Services::Logging::ILogger& logger)
+        -> std::pair<std::unique_ptr<InProcessRawByteStream>, std::unique_ptr<InProcessRawByteStream>>;
+
+    InProcessRawByteStream(std::shared_ptr<InProcessPipe> pipe, size_t side, IIoContext& ioContext,
+                           std::string localEndpoint, std::string remoteEndpoint,
+                           SilKit::Services::Logging::ILogger& logger);
+    ~InProcessRawByteStream() override;
+
+public: // IRawByteStream
+    void SetListener(IRawByteStreamListener& listener) override;
+    auto GetIoContext() -> IIoContext& override;
+    auto GetLocalEndpoint() -> std::string override;
+    auto GetRemoteEndpoint() -> std::string override;
+    void AsyncReadSome(MutableBufferSequence bufferSequence) override;
+    void AsyncWriteSome(ConstBufferSequence bufferSequence) override;
+    void Shutdown() override;
+    void Dispatch(std::function<void()> function) override;
+    void Post(std::function<void()> function) override;
+
+private:
+    friend struct InProcessPipe;
+
+    void PostReadDone(size_t bytesTransferred);
+    void PostWriteDone(size_t bytesTransferred);
+    void PostShutdown();
+};
+
+
+} // namespace VSilKit
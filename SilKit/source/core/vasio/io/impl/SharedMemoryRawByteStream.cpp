@@ -0,0 +1,917 @@
+#include "SharedMemoryRawByteStream.hpp"
+
+#include "IIoContext.hpp"
+
+#include "util/Exceptions.hpp"
+#include "util/TracingMacros.hpp"
+
+#include <algorithm>
+#include <new>
+#include <random>
+#include <sstream>
+
+#include <cstring>
+
+#if !defined(_WIN32)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+
+#if !defined(_WIN32)
+
+
+namespace {
+
+
+namespace Log = SilKit::Services::Logging;
+
+
+// The negotiation happens on the wrapped stream before any SIL Kit message is exchanged. Every message starts with a
+// 32-bit size field of zero, which is never sent by a peer that does not know about the shared memory transport.
+//
+// Offer:  u32 0, u32 magic, u32 version, u32 ringSize, u32 nameLength, char[nameLength] name
+// Answer: u32 0, u32 magic, u32 status
+//
+// After the offer was accepted, the stream only carries single-byte notifications ('doorbells').
+
+constexpr uint32_t NegotiationMagic{0x4d48534b}; // "KSHM"
+constexpr uint32_t NegotiationVersion{1};
+
+constexpr uint32_t AnswerAccepted{0};
+constexpr uint32_t AnswerDeclined{1};
+
+constexpr size_t PeekSize{sizeof(uint32_t)};
+constexpr size_t OfferHeaderSize{5 * sizeof(uint32_t)};
+constexpr size_t AnswerSize{3 * sizeof(uint32_t)};
+
+constexpr size_t MaxSegmentNameLength{255};
+constexpr size_t DoorbellReadSize{64};
+
+constexpr size_t MinRingSize{4096};
+constexpr size_t RingAlignment{64};
+
+
+struct alignas(64) SegmentHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t ringSize;
+};
+
+
+auto RoundUpRingSize(size_t ringSize) -> size_t
+{
+    ringSize = std::max(ringSize, MinRingSize);
+    return (ringSize + RingAlignment - 1) / RingAlignment * RingAlignment;
+}
+
+auto ComputeSegmentSize(size_t ringSize) -> size_t
+{
+    return sizeof(SegmentHeader) + 2 * (sizeof(VSilKit::SharedMemoryRing) + ringSize);
+}
+
+auto GetRing(void* segmentData, size_t ringSize, size_t index) -> VSilKit::SharedMemoryRing*
+{
+    auto* base = static_cast<uint8_t*>(segmentData) + sizeof(SegmentHeader);
+    return reinterpret_cast<VSilKit::SharedMemoryRing*>(base + index * (sizeof(VSilKit::SharedMemoryRing) + ringSize));
+}
+
+auto GetRingData(VSilKit::SharedMemoryRing* ring) -> uint8_t*
+{
+    return reinterpret_cast<uint8_t*>(ring) + sizeof(VSilKit::SharedMemoryRing);
+}
+
+void AppendU32(std::vector<uint8_t>& bytes, uint32_t value)
+{
+    const auto offset = bytes.size();
+    bytes.resize(offset + sizeof(value));
+    std::memcpy(bytes.data() + offset, &value, sizeof(value));
+}
+
+auto ReadU32(const std::vector<uint8_t>& bytes, size_t offset) -> uint32_t
+{
+    uint32_t value;
+    std::memcpy(&value, bytes.data() + offset, sizeof(value));
+    return value;
+}
+
+auto MakeSegmentName() -> std::string
+{
+    static std::atomic<uint32_t> counter{0};
+
+    std::random_device randomDevice;
+
+    std::ostringstream name;
+    name << "/silkit-" << ::getpid() << '-' << counter++ << '-' << std::hex << randomDevice();
+    return name.str();
+}
+
+
+} // namespace
+
+
+namespace VSilKit {
+
+
+// SharedMemorySegment
+
+
+auto SharedMemorySegment::Create(size_t size) -> std::unique_ptr<SharedMemorySegment>
+{
+    std::unique_ptr<SharedMemorySegment> segment{new SharedMemorySegment{}};
+    segment->_name = MakeSegmentName();
+
+    const int fd = ::shm_open(segment->_name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if (fd == -1)
+    {
+        return nullptr;
+    }
+
+    segment->_owner = true;
+
+    if (::ftruncate(fd, static_cast<off_t>(size)) == -1)
+    {
+        ::close(fd);
+        return nullptr;
+    }
+
+    void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    segment->_data = data;
+    segment->_size = size;
+    return segment;
+}
+
+
+auto SharedMemorySegment::Open(const std::string& name, size_t size) -> std::unique_ptr<SharedMemorySegment>
+{
+    std::unique_ptr<SharedMemorySegment> segment{new SharedMemorySegment{}};
+    segment->_name = name;
+
+    const int fd = ::shm_open(segment->_name.c_str(), O_RDWR, 0);
+    if (fd == -1)
+    {
+        return nullptr;
+    }
+
+    struct stat status
+    {
+    };
+    if (::fstat(fd, &status) == -1 || static_cast<size_t>(status.st_size) < size)
+    {
+        ::close(fd);
+        return nullptr;
+    }
+
+    void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    segment->_data = data;
+    segment->_size = size;
+    return segment;
+}
+
+
+SharedMemorySegment::~SharedMemorySegment()
+{
+    if (_data != nullptr)
+    {
+        ::munmap(_data, _size);
+    }
+
+    Unlink();
+}
+
+
+auto SharedMemorySegment::GetName() const -> const std::string&
+{
+    return _name;
+}
+
+
+auto SharedMemorySegment::GetData() const -> void*
+{
+    return _data;
+}
+
+
+auto SharedMemorySegment::GetSize() const -> size_t
+{
+    return _size;
+}
+
+
+void SharedMemorySegment::Unlink()
+{
+    if (_owner)
+    {
+        _owner = false;
+        ::shm_unlink(_name.c_str());
+    }
+}
+
+
+// SharedMemoryRawByteStream
+
+
+SharedMemoryRawByteStream::SharedMemoryRawByteStream(std::unique_ptr<IRawByteStream> stream, SharedMemoryRole role,
+                                                     const SharedMemoryRawByteStreamOptions& options,
+                                                     SilKit::Services::Logging::ILogger& logger)
+    : _stream{std::move(stream)}
+    , _ioContext{&_stream->GetIoContext()}
+    , _logger{&logger}
+    , _role{role}
+    , _ringSize{RoundUpRingSize(options.ringSize)}
+{
+    SILKIT_TRACE_METHOD(_logger, "(..., {}, {})", static_cast<int>(role), _ringSize);
+
+    _controlReadBuffer.resize(OfferHeaderSize + MaxSegmentNameLength);
+    _stream->SetListener(*this);
+}
+
+
+SharedMemoryRawByteStream::~SharedMemoryRawByteStream()
+{
+    SILKIT_TRACE_METHOD(_logger, "()");
+}
+
+
+void SharedMemoryRawByteStream::Start()
+{
+    SILKIT_TRACE_METHOD(_logger, "()");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    if (_role == SharedMemoryRole::Answer)
+    {
+        StartControlRead(PeekSize);
+        return;
+    }
+
+    _segment = SharedMemorySegment::Create(ComputeSegmentSize(_ringSize));
+    if (_segment == nullptr)
+    {
+        Log::Warn(_logger, "SharedMemoryRawByteStream: failed to create the shared memory segment");
+        FallBackToSocket();
+        return;
+    }
+
+    auto* header = new (_segment->GetData()) SegmentHeader{};
+    header->magic = NegotiationMagic;
+    header->version = NegotiationVersion;
+    header->ringSize = _ringSize;
+
+    for (size_t index = 0; index != 2; ++index)
+    {
+        new (GetRing(_segment->GetData(), _ringSize, index)) SharedMemoryRing{};
+    }
+
+    AttachSegment();
+
+    const auto& name = _segment->GetName();
+
+    std::vector<uint8_t> offer;
+    AppendU32(offer, 0);
+    AppendU32(offer, NegotiationMagic);
+    AppendU32(offer, NegotiationVersion);
+    AppendU32(offer, static_cast<uint32_t>(_ringSize));
+    AppendU32(offer, static_cast<uint32_t>(name.size()));
+    offer.insert(offer.end(), name.begin(), name.end());
+
+    StartControlWrite(std::move(offer));
+    StartControlRead(AnswerSize);
+}
+
+
+void SharedMemoryRawByteStream::SetListener(IRawByteStreamListener& listener)
+{
+    SILKIT_TRACE_METHOD(_logger, "({})", static_cast<const void*>(&listener));
+
+    _listener = &listener;
+}
+
+
+auto SharedMemoryRawByteStream::GetIoContext() -> IIoContext&
+{
+    return *_ioContext;
+}
+
+
+auto SharedMemoryRawByteStream::GetLocalEndpoint() -> std::string
+{
+    return _stream->GetLocalEndpoint();
+}
+
+
+auto SharedMemoryRawByteStream::GetRemoteEndpoint() -> std::string
+{
+    return _stream->GetRemoteEndpoint();
+}
+
+
+void SharedMemoryRawByteStream::AsyncReadSome(MutableBufferSequence bufferSequence)
+{
+    SILKIT_TRACE_METHOD(_logger, "(...)");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    if (_shutdown)
+    {
+        SILKIT_TRACE_METHOD(_logger, "ignored, already shutting down");
+        return;
+    }
+
+    if (_readPending)
+    {
+        throw InvalidStateError{};
+    }
+
+    _readPending = true;
+    _pendingRead.assign(bufferSequence.begin(), bufferSequence.end());
+
+    switch (_mode)
+    {
+    case Mode::Negotiating:
+        break;
+    case Mode::Socket:
+        ServeInboundBytes();
+        break;
+    case Mode::SharedMemory:
+        ServicePendingRead();
+        break;
+    }
+}
+
+
+void SharedMemoryRawByteStream::AsyncWriteSome(ConstBufferSequence bufferSequence)
+{
+    SILKIT_TRACE_METHOD(_logger, "(...)");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    if (_shutdown)
+    {
+        SILKIT_TRACE_METHOD(_logger, "ignored, already shutting down");
+        return;
+    }
+
+    if (_writePending)
+    {
+        throw InvalidStateError{};
+    }
+
+    _writePending = true;
+    _pendingWrite.assign(bufferSequence.begin(), bufferSequence.end());
+
+    switch (_mode)
+    {
+    case Mode::Negotiating:
+        break;
+    case Mode::Socket:
+        if (!_streamWriting)
+        {
+            ForwardPendingWrite();
+        }
+        break;
+    case Mode::SharedMemory:
+        ServicePendingWrite();
+        break;
+    }
+}
+
+
+void SharedMemoryRawByteStream::Shutdown()
+{
+    SILKIT_TRACE_METHOD(_logger, "()");
+
+    _stream->Shutdown();
+}
+
+
+void SharedMemoryRawByteStream::Dispatch(std::function<void()> function)
+{
+    // the completions of the rings are delivered on the executor of the underlying stream, just like its own
+    _stream->Dispatch(std::move(function));
+}
+
+
+void SharedMemoryRawByteStream::Post(std::function<void()> function)
+{
+    _stream->Post(std::move(function));
+}
+
+
+void SharedMemoryRawByteStream::OnAsyncReadSomeDone(IRawByteStream&, size_t bytesTransferred)
+{
+    SILKIT_TRACE_METHOD(_logger, "({})", bytesTransferred);
+
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+        if (!_readForwarded)
+        {
+            _controlReadSize += bytesTransferred;
+            HandleControlBytes();
+            return;
+        }
+
+        _readForwarded = false;
+        _readPending = false;
+    }
+
+    _listener->OnAsyncReadSomeDone(*this, bytesTransferred);
+}
+
+
+void SharedMemoryRawByteStream::OnAsyncWriteSomeDone(IRawByteStream&, size_t bytesTransferred)
+{
+    SILKIT_TRACE_METHOD(_logger, "({})", bytesTransferred);
+
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+        if (!_writeForwarded)
+        {
+            _controlWriteSlice.SliceOff(bytesTransferred);
+            if (_controlWriteSlice.GetSize() != 0)
+            {
+                _stream->AsyncWriteSome(ConstBufferSequence{&_controlWriteSlice, 1});
+                return;
+            }
+
+            _streamWriting = false;
+
+            if (_notifyPending)
+            {
+                StartNotify();
+            }
+            else if (_mode == Mode::Socket && _writePending)
+            {
+                ForwardPendingWrite();
+            }
+
+            return;
+        }
+
+        _writeForwarded = false;
+        _writePending = false;
+    }
+
+    _listener->OnAsyncWriteSomeDone(*this, bytesTransferred);
+}
+
+
+void SharedMemoryRawByteStream::OnShutdown(IRawByteStream&)
+{
+    SILKIT_TRACE_METHOD(_logger, "()");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+
+    _shutdown = true;
+
+    // posted, so all previously posted completions are delivered before the shutdown
+    _stream->Post([this] {
+        _listener->OnShutdown(*this);
+    });
+}
+
+
+void SharedMemoryRawByteStream::HandleControlBytes()
+{
+    if (_mode == Mode::SharedMemory)
+    {
+        // the content of the notifications is irrelevant, always check both rings
+        _controlReadSize = 0;
+        ServicePendingRead();
+        ServicePendingWrite();
+        StartControlRead(DoorbellReadSize);
+        return;
+    }
+
+    if (_controlReadSize < _controlReadTarget)
+    {
+        StartControlRead(_controlReadTarget);
+        return;
+    }
+
+    if (_role == SharedMemoryRole::Offer)
+    {
+        HandleAnswer();
+        return;
+    }
+
+    if (_controlReadTarget == PeekSize)
+    {
+        if (ReadU32(_controlReadBuffer, 0) != 0)
+        {
+            // the peer does not offer shared memory, the bytes are the start of a regular message
+            _inboundBytes.assign(_controlReadBuffer.begin(), _controlReadBuffer.begin() + PeekSize);
+            FallBackToSocket();
+            return;
+        }
+
+        StartControlRead(OfferHeaderSize);
+        return;
+    }
+
+    if (_controlReadTarget == OfferHeaderSize)
+    {
+        const auto nameLength = ReadU32(_controlReadBuffer, 4 * sizeof(uint32_t));
+
+        if (ReadU32(_controlReadBuffer, sizeof(uint32_t)) != NegotiationMagic)
+        {
+            AbortNegotiation("invalid offer");
+            return;
+        }
+
+        if (nameLength == 0 || nameLength > MaxSegmentNameLength)
+        {
+            AbortNegotiation("invalid segment name in offer");
+            return;
+        }
+
+        StartControlRead(OfferHeaderSize + nameLength);
+        return;
+    }
+
+    HandleOffer();
+}
+
+
+void SharedMemoryRawByteStream::HandleOffer()
+{
+    const auto version = ReadU32(_controlReadBuffer, 2 * sizeof(uint32_t));
+    const auto ringSize = ReadU32(_controlReadBuffer, 3 * sizeof(uint32_t));
+    const std::string name{_controlReadBuffer.begin() + OfferHeaderSize,
+                           _controlReadBuffer.begin() + static_cast<std::ptrdiff_t>(_controlReadTarget)};
+
+    _controlReadSize = 0;
+
+    if (version == NegotiationVersion && ringSize == RoundUpRingSize(ringSize))
+    {
+        _ringSize = ringSize;
+        _segment = SharedMemorySegment::Open(name, ComputeSegmentSize(_ringSize));
+    }
+
+    if (_segment != nullptr)
+    {
+        const auto* header = static_cast<const SegmentHeader*>(_segment->GetData());
+        if (header->magic != NegotiationMagic || header->version != NegotiationVersion
+            || header->ringSize != _ringSize)
+        {
+            _segment.reset();
+        }
+    }
+
+    std::vector<uint8_t> answer;
+    AppendU32(answer, 0);
+    AppendU32(answer, NegotiationMagic);
+
+    if (_segment == nullptr)
+    {
+        Log::Warn(_logger, "SharedMemoryRawByteStream: declining the shared memory segment '{}' offered by the peer",
+                  name);
+
+        AppendU32(answer, AnswerDeclined);
+        StartControlWrite(std::move(answer));
+        FallBackToSocket();
+        return;
+    }
+
+    AppendU32(answer, AnswerAccepted);
+    StartControlWrite(std::move(answer));
+
+    Log::Debug(_logger, "SharedMemoryRawByteStream: using the shared memory segment '{}' offered by the peer", name);
+
+    AttachSegment();
+}
+
+
+void SharedMemoryRawByteStream::HandleAnswer()
+{
+    _controlReadSize = 0;
+
+    if (ReadU32(_controlReadBuffer, 0) != 0 || ReadU32(_controlReadBuffer, sizeof(uint32_t)) != NegotiationMagic)
+    {
+        AbortNegotiation("invalid answer");
+        return;
+    }
+
+    // the peer has either mapped the segment, or will never do so, the name is not needed anymore
+    _segment->Unlink();
+
+    if (ReadU32(_controlReadBuffer, 2 * sizeof(uint32_t)) != AnswerAccepted)
+    {
+        Log::Warn(_logger, "SharedMemoryRawByteStream: the peer declined the shared memory segment '{}'",
+                  _segment->GetName());
+
+        _segment.reset();
+        _txRing = _rxRing = nullptr;
+        _txData = _rxData = nullptr;
+
+        FallBackToSocket();
+        return;
+    }
+
+    Log::Debug(_logger, "SharedMemoryRawByteStream: the peer accepted the shared memory segment '{}'",
+               _segment->GetName());
+
+    _mode = Mode::SharedMemory;
+
+    ServicePendingRead();
+    ServicePendingWrite();
+    StartControlRead(DoorbellReadSize);
+}
+
+
+void SharedMemoryRawByteStream::AttachSegment()
+{
+    auto* ring0 = GetRing(_segment->GetData(), _ringSize, 0);
+    auto* ring1 = GetRing(_segment->GetData(), _ringSize, 1);
+
+    // ring 0 carries the data from the offering to the answering side, ring 1 the data in the opposite direction
+    _txRing = (_role == SharedMemoryRole::Offer) ? ring0 : ring1;
+    _rxRing = (_role == SharedMemoryRole::Offer) ? ring1 : ring0;
+    _txData = GetRingData(_txRing);
+    _rxData = GetRingData(_rxRing);
+
+    if (_role == SharedMemoryRole::Answer)
+    {
+        _mode = Mode::SharedMemory;
+
+        ServicePendingRead();
+        ServicePendingWrite();
+        StartControlRead(DoorbellReadSize);
+    }
+}
+
+
+void SharedMemoryRawByteStream::FallBackToSocket()
+{
+    _mode = Mode::Socket;
+
+    if (_readPending)
+    {
+        ServeInboundBytes();
+    }
+
+    if (_writePending && !_streamWriting)
+    {
+        ForwardPendingWrite();
+    }
+}
+
+
+void SharedMemoryRawByteStream::AbortNegotiation(const char* reason)
+{
+    Log::Error(_logger, "SharedMemoryRawByteStream: {}, closing the connection", reason);
+
+    _stream->Shutdown();
+}
+
+
+void SharedMemoryRawByteStream::ServicePendingRead()
+{
+    if (!_readPending || _shutdown)
+    {
+        return;
+    }
+
+    auto bytesTransferred = ReadFromRing();
+    if (bytesTransferred == 0)
+    {
+        // announce that a notification is expected, then check again to avoid missing data written in between
+        _rxRing->readerWaiting.store(1);
+
+        bytesTransferred = ReadFromRing();
+        if (bytesTransferred == 0)
+        {
+            return;
+        }
+
+        _rxRing->readerWaiting.store(0);
+    }
+
+    if (_rxRing->writerWaiting.exchange(0) != 0)
+    {
+        StartNotify();
+    }
+
+    PostReadDone(bytesTransferred);
+}
+
+
+void SharedMemoryRawByteStream::ServicePendingWrite()
+{
+    if (!_writePending || _shutdown)
+    {
+        return;
+    }
+
+    auto bytesTransferred = WriteToRing();
+    if (bytesTransferred == 0)
+    {
+        // announce that a notification is expected, then check again to avoid missing space freed in between
+        _txRing->writerWaiting.store(1);
+
+        bytesTransferred = WriteToRing();
+        if (bytesTransferred == 0)
+        {
+            return;
+        }
+
+        _txRing->writerWaiting.store(0);
+    }
+
+    if (_txRing->readerWaiting.exchange(0) != 0)
+    {
+        StartNotify();
+    }
+
+    PostWriteDone(bytesTransferred);
+}
+
+
+auto SharedMemoryRawByteStream::ReadFromRing() -> size_t
+{
+    const uint64_t readPosition = _rxRing->readPosition.load(std::memory_order_relaxed);
+    const uint64_t writePosition = _rxRing->writePosition.load();
+
+    auto available = static_cast<size_t>(writePosition - readPosition);
+    auto offset = static_cast<size_t>(readPosition % _ringSize);
+    size_t transferred{0};
+
+    for (const auto& buffer : _pendingRead)
+    {
+        auto* data = static_cast<uint8_t*>(buffer.GetData());
+        auto size = std::min(buffer.GetSize(), available);
+
+        while (size != 0)
+        {
+            const auto chunk = std::min(size, _ringSize - offset);
+            std::memcpy(data, _rxData + offset, chunk);
+
+            data += chunk;
+            size -= chunk;
+            available -= chunk;
+            transferred += chunk;
+            offset = (offset + chunk) % _ringSize;
+        }
+
+        if (available == 0)
+        {
+            break;
+        }
+    }
+
+    if (transferred != 0)
+    {
+        _rxRing->readPosition.store(readPosition + transferred);
+    }
+
+    return transferred;
+}
+
+
+auto SharedMemoryRawByteStream::WriteToRing() -> size_t
+{
+    const uint64_t writePosition = _txRing->writePosition.load(std::memory_order_relaxed);
+    const uint64_t readPosition = _txRing->readPosition.load();
+
+    auto available = _ringSize - static_cast<size_t>(writePosition - readPosition);
+    auto offset = static_cast<size_t>(writePosition % _ringSize);
+    size_t transferred{0};
+
+    for (const auto& buffer : _pendingWrite)
+    {
+        const auto* data = static_cast<const uint8_t*>(buffer.GetData());
+        auto size = std::min(buffer.GetSize(), available);
+
+        while (size != 0)
+        {
+            const auto chunk = std::min(size, _ringSize - offset);
+            std::memcpy(_txData + offset, data, chunk);
+
+            data += chunk;
+            size -= chunk;
+            available -= chunk;
+            transferred += chunk;
+            offset = (offset + chunk) % _ringSize;
+        }
+
+        if (available == 0)
+        {
+            break;
+        }
+    }
+
+    if (transferred != 0)
+    {
+        _txRing->writePosition.store(writePosition + transferred);
+    }
+
+    return transferred;
+}
+
+
+void SharedMemoryRawByteStream::ServeInboundBytes()
+{
+    if (_inboundBytes.empty())
+    {
+        _readForwarded = true;
+        _stream->AsyncReadSome(MutableBufferSequence{_pendingRead.data(), _pendingRead.size()});
+        return;
+    }
+
+    size_t transferred{0};
+
+    for (const auto& buffer : _pendingRead)
+    {
+        const auto size = std::min(buffer.GetSize(), _inboundBytes.size() - transferred);
+        std::memcpy(buffer.GetData(), _inboundBytes.data() + transferred, size);
+        transferred += size;
+    }
+
+    _inboundBytes.erase(_inboundBytes.begin(), _inboundBytes.begin() + static_cast<std::ptrdiff_t>(transferred));
+
+    PostReadDone(transferred);
+}
+
+
+void SharedMemoryRawByteStream::StartControlRead(size_t targetSize)
+{
+    _controlReadTarget = targetSize;
+
+    MutableBuffer buffer{_controlReadBuffer.data() + _controlReadSize, targetSize - _controlReadSize};
+    _stream->AsyncReadSome(MutableBufferSequence{&buffer, 1});
+}
+
+
+void SharedMemoryRawByteStream::StartControlWrite(std::vector<uint8_t> bytes)
+{
+    _streamWriting = true;
+    _controlWriteBuffer = std::move(bytes);
+    _controlWriteSlice = ConstBuffer{_controlWriteBuffer.data(), _controlWriteBuffer.size()};
+    _stream->AsyncWriteSome(ConstBufferSequence{&_controlWriteSlice, 1});
+}
+
+
+void SharedMemoryRawByteStream::StartNotify()
+{
+    if (_streamWriting)
+    {
+        // a single notification is enough, the peer checks both rings whenever it receives one
+        _notifyPending = true;
+        return;
+    }
+
+    _notifyPending = false;
+    StartControlWrite(std::vector<uint8_t>{1});
+}
+
+
+void SharedMemoryRawByteStream::ForwardPendingWrite()
+{
+    _writeForwarded = true;
+    _stream->AsyncWriteSome(ConstBufferSequence{_pendingWrite.data(), _pendingWrite.size()});
+}
+
+
+void SharedMemoryRawByteStream::PostReadDone(size_t bytesTransferred)
+{
+    _readPending = false;
+
+    _stream->Post([this, bytesTransferred] {
+        _listener->OnAsyncReadSomeDone(*this, bytesTransferred);
+    });
+}
+
+
+void SharedMemoryRawByteStream::PostWriteDone(size_t bytesTransferred)
+{
+    _writePending = false;
+
+    _stream->Post([this, bytesTransferred] {
+        _listener->OnAsyncWriteSomeDone(*this, bytesTransferred);
+    });
+}
+
+
+} // namespace VSilKit
+
+
+#endif
@@ -0,0 +1,163 @@
+#pragma once
+
+
+#include "IRawByteStream.hpp"
+#include "MakeSharedMemoryRawByteStream.hpp"
+
+#include "ILogger.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace VSilKit {
+
+
+//! Single-producer single-consumer byte ring, placed in shared memory. The positions are the total number of bytes
+//! written and read, the waiting flags tell the other side that a notification is expected.
+struct SharedMemoryRing
+{
+    alignas(64) std::atomic<uint64_t> writePosition;
+    alignas(64) std::atomic<uint64_t> readPosition;
+    alignas(64) std::atomic<uint32_t> readerWaiting;
+    std::atomic<uint32_t> writerWaiting;
+};
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+              "the shared memory transport requires address-free atomics");
+
+
+class SharedMemorySegment
+{
+    std::string _name;
+    bool _owner{false};
+    void* _data{nullptr};
+    size_t _size{0};
+
+public:
+    //! Create a new segment with a unique name
+    static auto Create(size_t size) -> std::unique_ptr<SharedMemorySegment>;
+    //! Open and map the segment created by the peer
+    static auto Open(const std::string& name, size_t size) -> std::unique_ptr<SharedMemorySegment>;
+
+    ~SharedMemorySegment();
+
+    auto GetName() const -> const std::string&;
+    auto GetData() const -> void*;
+    auto GetSize() const -> size_t;
+
+    //! Remove the name of the segment, the mapping stays valid
+    void Unlink();
+
+private:
+    SharedMemorySegment() = default;
+};
+
+
+class SharedMemoryRawByteStream final
+    : public IRawByteStream
+    , private IRawByteStreamListener
+{
+    enum struct Mode
+    {
+        Negotiating,
+        Socket,
+        SharedMemory,
+    };
+
+    std::unique_ptr<IRawByteStream> _stream;
+    IIoContext* _ioContext{nullptr};
+    IRawByteStreamListener* _listener{nullptr};
+    SilKit::Services::Logging::ILogger* _logger{nullptr};
+
+    SharedMemoryRole _role;
+    size_t _ringSize{0};
+
+    std::mutex _mutex;
+    Mode _mode{Mode::Negotiating};
+    bool _shutdown{false};
+
+    // negotiation messages and notifications received on the stream
+    std::vector<uint8_t> _controlReadBuffer;
+    size_t _controlReadSize{0};
+    size_t _controlReadTarget{0};
+
+    // bytes received on the stream during the negotiation, which belong to the listener after falling back
+    std::vector<uint8_t> _inboundBytes;
+
+    // negotiation messages and notifications sent on the stream
+    std::vector<uint8_t> _controlWriteBuffer;
+    ConstBuffer _controlWriteSlice;
+    bool _streamWriting{false};
+    bool _notifyPending{false};
+
+    // operations requested by the listener
+    std::vector<MutableBuffer> _pendingRead;
+    bool _readPending{false};
+    bool _readForwarded{false};
+    std::vector<ConstBuffer> _pendingWrite;
+    bool _writePending{false};
+    bool _writeForwarded{false};
+
+    std::unique_ptr<SharedMemorySegment> _segment;
+    SharedMemoryRing* _txRing{nullptr};
+    uint8_t* _txData{nullptr};
+    SharedMemoryRing* _rxRing{nullptr};
+    uint8_t* _rxData{nullptr};
+
+public:
+    SharedMemoryRawByteStream(std::unique_ptr<IRawByteStream> stream, SharedMemoryRole role,
+                              const SharedMemoryRawByteStreamOptions& options,
+                              SilKit::Services::Logging::ILogger& logger);
+    ~SharedMemoryRawByteStream() override;
+
+    //! Start the negotiation
+    void Start();
+
+public: // IRawByteStream
+    void SetListener(IRawByteStreamListener& listener) override;
+    auto GetIoContext() -> IIoContext& override;
+    auto GetLocalEndpoint() -> std::string override;
+    auto GetRemoteEndpoint() -> std::string override;
+    void AsyncReadSome(MutableBufferSequence bufferSequence) override;
+    void AsyncWriteSome(ConstBufferSequence bufferSequence) override;
+    void Shutdown() override;
+    void Dispatch(std::function<void()> function) override;
+    void Post(std::function<void()> function) override;
+
+private: // IRawByteStreamListener
+    void OnAsyncReadSomeDone(IRawByteStream& stream, size_t bytesTransferred) override;
+    void OnAsyncWriteSomeDone(IRawByteStream& stream, size_t bytesTransferred) override;
+    void OnShutdown(IRawByteStream& stream) override;
+
+private: // all of the following must be called with the mutex held
+    void HandleControlBytes();
+    void HandleOffer();
+    void HandleAnswer();
+    void AttachSegment();
+    void FallBackToSocket();
+    void AbortNegotiation(const char* reason);
+
+    void ServicePendingRead();
+    void ServicePendingWrite();
+    auto ReadFromRing() -> size_t;
+    auto WriteToRing() -> size_t;
+    void ServeInboundBytes();
+
+    void StartControlRead(size_t targetSize);
+    void StartControlWrite(std::vector<uint8_t> bytes);
+    void StartNotify();
+    void ForwardPendingWrite();
+
+    void PostReadDone(size_t bytesTransferred);
+    void PostWriteDone(size_t bytesTransferred);
+};
+
+
+} // namespace VSilKit
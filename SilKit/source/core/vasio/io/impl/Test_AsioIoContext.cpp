@@ -0,0 +1,139 @@
+#include "gtest/gtest.h"
+
+#include "AsioIoContext.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+
+namespace {
+
+
+using VSilKit::AsioIoContext;
+using VSilKit::AsioIoContextOptions;
+using VSilKit::AsioSocketOptions;
+
+
+constexpr size_t HandlerCount{1000};
+
+
+struct HandlerRecorder
+{
+    std::mutex mutex;
+    std::set<std::thread::id> threadIds;
+    std::atomic<size_t> concurrentHandlers{0};
+    bool handlersOverlapped{false};
+    bool handlersRanInContext{true};
+    size_t handlerCount{0};
+
+    void Record(AsioIoContext& ioContext)
+    {
+        if (concurrentHandlers.fetch_add(1) != 0)
+        {
+            handlersOverlapped = true;
+        }
+
+        {
+            std::lock_guard<decltype(mutex)> lock{mutex};
+            threadIds.insert(std::this_thread::get_id());
+            handlersRanInContext = handlersRanInContext && ioContext.IsRunningInThisThread();
+            handlerCount += 1;
+        }
+
+        concurrentHandlers.fetch_sub(1);
+    }
+};
+
+
+void PostHandlers(AsioIoContext& ioContext, HandlerRecorder& recorder)
+{
+    for (size_t index = 0; index != HandlerCount; ++index)
+    {
+        ioContext.Post([&ioContext, &recorder] {
+            recorder.Record(ioContext);
+        });
+    }
+}
+
+
+TEST(Test_AsioIoContext, single_worker_runs_handlers_on_calling_thread)
+{
+    AsioIoContext ioContext{AsioSocketOptions{}};
+    HandlerRecorder recorder;
+
+    PostHandlers(ioContext, recorder);
+    ioContext.Run();
+
+    EXPECT_EQ(recorder.handlerCount, HandlerCount);
+    EXPECT_FALSE(recorder.handlersOverlapped);
+    EXPECT_TRUE(recorder.handlersRanInContext);
+    EXPECT_EQ(recorder.threadIds, std::set<std::thread::id>{std::this_thread::get_id()});
+    EXPECT_FALSE(ioContext.IsRunningInThisThread());
+}
+
+
+TEST(Test_AsioIoContext, worker_pool_runs_posted_handlers_sequentially)
+{
+    AsioIoContextOptions ioContextOptions{};
+    ioContextOptions.ioWorkerThreads = 4;
+
+    AsioIoContext ioContext{AsioSocketOptions{}, ioContextOptions};
+    HandlerRecorder recorder;
+
+    PostHandlers(ioContext, recorder);
+    ioContext.Run();
+
+    EXPECT_EQ(recorder.handlerCount, HandlerCount);
+    EXPECT_FALSE(recorder.handlersOverlapped);
+    EXPECT_TRUE(recorder.handlersRanInContext);
+}
+
+
+TEST(Test_AsioIoContext, dedicated_dispatch_thread_runs_posted_handlers)
+{
+    AsioIoContextOptions ioContextOptions{};
+    ioContextOptions.ioWorkerThreads = 2;
+    ioContextOptions.dedicatedDispatchThread = true;
+
+    AsioIoContext ioContext{AsioSocketOptions{}, ioContextOptions};
+    HandlerRecorder recorder;
+
+    // handlers posted from within the dispatch thread are still run before Run returns
+    ioContext.Post([&ioContext, &recorder] {
+        PostHandlers(ioContext, recorder);
+    });
+    ioContext.Run();
+
+    EXPECT_EQ(recorder.handlerCount, HandlerCount);
+    EXPECT_FALSE(recorder.handlersOverlapped);
+    EXPECT_TRUE(recorder.handlersRanInContext);
+    ASSERT_EQ(recorder.threadIds.size(), 1u);
+    EXPECT_NE(*recorder.threadIds.begin(), std::this_thread::get_id());
+}
+
+
+TEST(Test_AsioIoContext, dispatch_runs_inline_when_called_from_the_context)
+{
+    AsioIoContextOptions ioContextOptions{};
+    ioContextOptions.ioWorkerThreads = 4;
+
+    AsioIoContext ioContext{AsioSocketOptions{}, ioContextOptions};
+
+    bool dispatchedInline{false};
+    ioContext.Post([&ioContext, &dispatchedInline] {
+        bool done{false};
+        ioContext.Dispatch([&done] {
+            done = true;
+        });
+        dispatchedInline = done;
+    });
+    ioContext.Run();
+
+    EXPECT_TRUE(dispatchedInline);
+}
+
+
+} // namespace
@@ -0,0 +1,201 @@
+#include "gtest/gtest.h"
+
+#include "AsioIoContext.hpp"
+#include "MakeInProcessTransport.hpp"
+
+#include <functional>
+#include <numeric>
+#include <vector>
+
+
+namespace {
+
+
+using namespace VSilKit;
+
+
+constexpr size_t PayloadSize{100 * 1500 + 123};
+const std::string SocketPath{"/tmp/silkit-in-process-test.silkit"};
+
+
+struct NullLogger : SilKit::Services::Logging::ILogger
+{
+    void Log(SilKit::Services::Logging::Level, const std::string&) override {}
+    void Trace(const std::string&) override {}
+    void Debug(const std::string&) override {}
+    void Info(const std::string&) override {}
+    void Warn(const std::string&) override {}
+    void Error(const std::string&) override {}
+    void Critical(const std::string&) override {}
+    auto GetLogLevel() const -> SilKit::Services::Logging::Level override
+    {
+        return SilKit::Services::Logging::Level::Off;
+    }
+};
+
+
+auto MakePayload(uint8_t seed) -> std::vector<uint8_t>
+{
+    std::vector<uint8_t> payload(PayloadSize);
+    std::iota(payload.begin(), payload.end(), seed);
+    return payload;
+}
+
+
+// Writes its payload and reads the payload of the other side, both in chunks of whatever size the stream accepts
+struct Endpoint : IRawByteStreamListener
+{
+    std::unique_ptr<IRawByteStream> stream;
+    std::vector<uint8_t> sendData;
+    size_t bytesWritten{0};
+    std::vector<uint8_t> receivedData;
+    size_t expectedSize{0};
+    uint8_t readBuffer[1500];
+    bool shutdown{false};
+    std::function<void()> onProgress;
+
+    void Start(std::unique_ptr<IRawByteStream> newStream)
+    {
+        stream = std::move(newStream);
+        stream->SetListener(*this);
+        Read();
+        Write();
+    }
+
+    auto IsDone() const -> bool
+    {
+        return bytesWritten == sendData.size() && receivedData.size() == expectedSize;
+    }
+
+    void Read()
+    {
+        if (receivedData.size() == expectedSize)
+        {
+            return;
+        }
+
+        // split the read buffer, the bytes are scattered across both parts
+        MutableBuffer buffers[2]{{readBuffer, 100}, {readBuffer + 100, sizeof(readBuffer) - 100}};
+        stream->AsyncReadSome(MutableBufferSequence{buffers, 2});
+    }
+
+    void Write()
+    {
+        if (bytesWritten == sendData.size())
+        {
+            return;
+        }
+
+        ConstBuffer buffer{sendData.data() + bytesWritten, sendData.size() - bytesWritten};
+        stream->AsyncWriteSome(ConstBufferSequence{&buffer, 1});
+    }
+
+    void OnAsyncReadSomeDone(IRawByteStream&, size_t bytesTransferred) override
+    {
+        receivedData.insert(receivedData.end(), readBuffer, readBuffer + bytesTransferred);
+        Read();
+        onProgress();
+    }
+
+    void OnAsyncWriteSomeDone(IRawByteStream&, size_t bytesTransferred) override
+    {
+        bytesWritten += bytesTransferred;
+        Write();
+        onProgress();
+    }
+
+    void OnShutdown(IRawByteStream&) override
+    {
+        shutdown = true;
+    }
+};
+
+
+struct Test_InProcessRawByteStream
+    : testing::Test
+    , IInProcessAcceptorListener
+{
+    AsioIoContext ioContext{AsioSocketOptions{}};
+    NullLogger logger;
+    std::unique_ptr<IInProcessAcceptor> acceptor;
+
+    Endpoint client;
+    Endpoint server;
+    bool closed{false};
+
+    void SetUp() override
+    {
+        ioContext.SetLogger(logger);
+
+        client.sendData = MakePayload(1);
+        client.expectedSize = PayloadSize;
+        server.sendData = MakePayload(2);
+        server.expectedSize = PayloadSize;
+
+        client.onProgress = server.onProgress = [this] {
+            if (!closed && client.IsDone() && server.IsDone())
+            {
+                closed = true;
+                client.stream->Shutdown();
+            }
+        };
+    }
+
+    void OnInProcessAccept(std::unique_ptr<IRawByteStream> stream) override
+    {
+        server.Start(std::move(stream));
+    }
+};
+
+
+TEST_F(Test_InProcessRawByteStream, transfers_payload_in_both_directions)
+{
+    acceptor = MakeInProcessAcceptor(ioContext, SocketPath, *this, logger);
+
+    auto stream = ConnectInProcess(ioContext, SocketPath, logger);
+    ASSERT_NE(stream, nullptr);
+    EXPECT_EQ(stream->GetRemoteEndpoint(), "local://" + SocketPath);
+
+    client.Start(std::move(stream));
+
+    ioContext.Run();
+
+    EXPECT_TRUE(closed);
+    EXPECT_TRUE(client.shutdown);
+    EXPECT_TRUE(server.shutdown);
+    EXPECT_EQ(client.receivedData, server.sendData);
+    EXPECT_EQ(server.receivedData, client.sendData);
+    EXPECT_EQ(server.stream->GetLocalEndpoint(), "local://" + SocketPath);
+}
+
+
+TEST_F(Test_InProcessRawByteStream, connect_fails_without_acceptor_in_this_process)
+{
+    EXPECT_EQ(ConnectInProcess(ioContext, SocketPath, logger), nullptr);
+
+    acceptor = MakeInProcessAcceptor(ioContext, SocketPath, *this, logger);
+    acceptor->Shutdown();
+
+    EXPECT_EQ(ConnectInProcess(ioContext, SocketPath, logger), nullptr);
+}
+
+
+TEST_F(Test_InProcessRawByteStream, connection_is_shut_down_if_the_acceptor_is_shut_down_before_accepting)
+{
+    acceptor = MakeInProcessAcceptor(ioContext, SocketPath, *this, logger);
+
+    auto stream = ConnectInProcess(ioContext, SocketPath, logger);
+    ASSERT_NE(stream, nullptr);
+    acceptor->Shutdown();
+
+    client.Start(std::move(stream));
+
+    ioContext.Run();
+
+    EXPECT_EQ(server.stream, nullptr);
+    EXPECT_TRUE(client.shutdown);
+    EXPECT_TRUE(client.receivedData.empty());
+}
+
+
+} // namespace
@@ -0,0 +1,224 @@
+#include "gtest/gtest.h"
+
+#include "AsioIoContext.hpp"
+#include "MakeSharedMemoryRawByteStream.hpp"
+
+#include "Filesystem.hpp"
+
+#include <functional>
+#include <numeric>
+#include <sstream>
+#include <vector>
+
+#include <cstdio>
+
+
+#if !defined(_WIN32)
+
+
+namespace {
+
+
+using namespace VSilKit;
+
+namespace fs = SilKit::Filesystem;
+
+
+constexpr size_t RingSize{4096};
+constexpr size_t PayloadSize{100 * RingSize + 123};
+
+
+struct NullLogger : SilKit::Services::Logging::ILogger
+{
+    void Log(SilKit::Services::Logging::Level, const std::string&) override {}
+    void Trace(const std::string&) override {}
+    void Debug(const std::string&) override {}
+    void Info(const std::string&) override {}
+    void Warn(const std::string&) override {}
+    void Error(const std::string&) override {}
+    void Critical(const std::string&) override {}
+    auto GetLogLevel() const -> SilKit::Services::Logging::Level override
+    {
+        return SilKit::Services::Logging::Level::Off;
+    }
+};
+
+
+auto MakePayload(uint8_t seed) -> std::vector<uint8_t>
+{
+    std::vector<uint8_t> payload(PayloadSize);
+    std::iota(payload.begin(), payload.end(), seed);
+    return payload;
+}
+
+
+// Writes its payload and reads the payload of the other side, both in chunks of whatever size the stream accepts
+struct Endpoint : IRawByteStreamListener
+{
+    std::unique_ptr<IRawByteStream> stream;
+    std::vector<uint8_t> sendData;
+    size_t bytesWritten{0};
+    std::vector<uint8_t> receivedData;
+    size_t expectedSize{0};
+    uint8_t readBuffer[1500];
+    bool shutdown{false};
+    std::function<void()> onProgress;
+
+    void Start(std::unique_ptr<IRawByteStream> newStream)
+    {
+        stream = std::move(newStream);
+        stream->SetListener(*this);
+        Read();
+        Write();
+    }
+
+    auto IsDone() const -> bool
+    {
+        return bytesWritten == sendData.size() && receivedData.size() == expectedSize;
+    }
+
+    void Read()
+    {
+        if (receivedData.size() == expectedSize)
+        {
+            return;
+        }
+
+        MutableBuffer buffer{readBuffer, sizeof(readBuffer)};
+        stream->AsyncReadSome(MutableBufferSequence{&buffer, 1});
+    }
+
+    void Write()
+    {
+        if (bytesWritten == sendData.size())
+        {
+            return;
+        }
+
+        ConstBuffer buffer{sendData.data() + bytesWritten, sendData.size() - bytesWritten};
+        stream->AsyncWriteSome(ConstBufferSequence{&buffer, 1});
+    }
+
+    void OnAsyncReadSomeDone(IRawByteStream&, size_t bytesTransferred) override
+    {
+        receivedData.insert(receivedData.end(), readBuffer, readBuffer + bytesTransferred);
+        Read();
+        onProgress();
+    }
+
+    void OnAsyncWriteSomeDone(IRawByteStream&, size_t bytesTransferred) override
+    {
+        bytesWritten += bytesTransferred;
+        Write();
+        onProgress();
+    }
+
+    void OnShutdown(IRawByteStream&) override
+    {
+        shutdown = true;
+    }
+};
+
+
+struct Test_SharedMemoryRawByteStream
+    : testing::Test
+    , IAcceptorListener
+{
+    AsioIoContext ioContext{AsioSocketOptions{}};
+    NullLogger logger;
+    std::string socketPath;
+    std::unique_ptr<IAcceptor> acceptor;
+
+    SharedMemoryRawByteStreamOptions options;
+    bool wrapClient{true};
+
+    Endpoint client;
+    Endpoint server;
+    bool closed{false};
+
+    void SetUp() override
+    {
+        std::ostringstream path;
+        path << fs::temp_directory_path().string() << fs::path::preferred_separator << "silkit-shm-test-"
+             << static_cast<const void*>(this) << ".silkit";
+        socketPath = path.str();
+        std::remove(socketPath.c_str());
+
+        ioContext.SetLogger(logger);
+        options.ringSize = RingSize;
+
+        client.sendData = MakePayload(1);
+        client.expectedSize = PayloadSize;
+        server.sendData = MakePayload(2);
+        server.expectedSize = PayloadSize;
+
+        client.onProgress = server.onProgress = [this] {
+            if (!closed && client.IsDone() && server.IsDone())
+            {
+                closed = true;
+                client.stream->Shutdown();
+                server.stream->Shutdown();
+            }
+        };
+    }
+
+    void TearDown() override
+    {
+        std::remove(socketPath.c_str());
+    }
+
+    void RunExchange()
+    {
+        acceptor = ioContext.MakeLocalAcceptor(socketPath);
+        acceptor->SetListener(*this);
+        acceptor->AsyncAccept(std::chrono::milliseconds{0});
+
+        std::error_code errorCode;
+        auto stream = ioContext.ConnectLocal(socketPath, errorCode);
+        ASSERT_NE(stream, nullptr);
+
+        if (wrapClient)
+        {
+            stream = MakeSharedMemoryRawByteStream(std::move(stream), SharedMemoryRole::Offer, options, logger);
+        }
+        client.Start(std::move(stream));
+
+        ioContext.Run();
+
+        EXPECT_TRUE(closed);
+        EXPECT_TRUE(client.shutdown);
+        EXPECT_TRUE(server.shutdown);
+        EXPECT_EQ(client.receivedData, server.sendData);
+        EXPECT_EQ(server.receivedData, client.sendData);
+    }
+
+    void OnAsyncAcceptSuccess(IAcceptor&, std::unique_ptr<IRawByteStream> stream) override
+    {
+        server.Start(MakeSharedMemoryRawByteStream(std::move(stream), SharedMemoryRole::Answer, options, logger));
+        acceptor->Shutdown();
+    }
+
+    void OnAsyncAcceptFailure(IAcceptor&) override {}
+};
+
+
+TEST_F(Test_SharedMemoryRawByteStream, transfers_payload_larger_than_the_ring_in_both_directions)
+{
+    ASSERT_TRUE(IsSharedMemoryTransportSupported());
+
+    RunExchange();
+}
+
+
+TEST_F(Test_SharedMemoryRawByteStream, answer_passes_through_a_peer_without_shared_memory)
+{
+    wrapClient = false;
+
+    RunExchange();
+}
+
+
+} // namespace
+
+
+#endif
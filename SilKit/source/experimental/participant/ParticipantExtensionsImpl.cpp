@@ -22,6 +22,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "ParticipantExtensionsImpl.hpp"
 #include "IParticipantInternal.hpp"
 
+#include "silkit/experimental/participant/ParticipantDatatypesExtensions.hpp"
+
 namespace SilKit {
 namespace Experimental {
 namespace Participant {
@@ -42,6 +44,36 @@ auto CreateSystemControllerImpl(IParticipant* participant)
     return participantInternal->GetSystemController();
 }
 
+auto GetSendQueueStatusImpl(IParticipant* participant, const std::string& participantName)
+    -> SilKit::Experimental::Participant::SendQueueStatus
+{
+    auto participantInternal = dynamic_cast<SilKit::Core::IParticipantInternal*>(participant);
+    if (participantInternal == nullptr)
+    {
+        throw SilKitError("participant is not a valid SilKit::IParticipant*");
+    }
+
+    const auto sendQueueStatus = participantInternal->GetSendQueueStatus();
+    const auto it = sendQueueStatus.find(participantName);
+    if (it == sendQueueStatus.end())
+    {
+        throw SilKitError("participant '" + participantName + "' is not connected to participant '"
+                          + participantInternal->GetParticipantName() + "'");
+    }
+
+    const auto& status = it->second;
+
+    SilKit::Experimental::Participant::SendQueueStatus result{};
+    result.queuedMessages = status.queuedMessages;
+    result.queuedBytes = status.queuedBytes;
+    result.maxQueuedBytes = status.maxQueuedBytes;
+    result.droppedMessages = status.droppedMessages;
+    result.rejectedMessages = status.rejectedMessages;
+    result.blockedSends = status.blockedSends;
+    result.conflatedMessages = status.conflatedMessages;
+    return result;
+}
+
 } // namespace Participant
 } // namespace Experimental
 } // namespace SilKit
@@ -26,6 +26,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 //             nor public), as it is used to implement the 'legacy' ABI functions.
 // ================================================================================
 
+#include <string>
 
 // Forward Declarations
 
@@ -43,6 +44,14 @@ class ISystemController;
 } // namespace Experimental
 } // namespace SilKit
 
+namespace SilKit {
+namespace Experimental {
+namespace Participant {
+struct SendQueueStatus;
+} // namespace Participant
+} // namespace Experimental
+} // namespace SilKit
+
 
 // Function Declarations
 
@@ -53,6 +62,9 @@ namespace Participant {
 auto CreateSystemControllerImpl(IParticipant* participant)
     -> SilKit::Experimental::Services::Orchestration::ISystemController*;
 
+auto GetSendQueueStatusImpl(IParticipant* participant, const std::string& participantName)
+    -> SilKit::Experimental::Participant::SendQueueStatus;
+
 } // namespace Participant
 } // namespace Experimental
 } // namespace SilKit
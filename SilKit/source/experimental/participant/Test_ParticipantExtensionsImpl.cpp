@@ -26,6 +26,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "gtest/gtest.h"
 
 #include "silkit/participant/exception.hpp"
+#include "silkit/experimental/participant/ParticipantDatatypesExtensions.hpp"
 
 #include "NullConnectionParticipant.hpp"
 #include "ConfigurationTestUtils.hpp"
@@ -60,4 +61,13 @@ TEST_F(Test_ParticipantExtensionsImpl, error_on_create_system_controller_twice)
     EXPECT_THROW(SilKit::Experimental::Participant::CreateSystemControllerImpl(participant.get()), SilKit::SilKitError);
 }
 
+TEST_F(Test_ParticipantExtensionsImpl, error_on_send_queue_status_of_unknown_participant)
+{
+    auto participant =
+        CreateNullConnectionParticipantImpl(SilKit::Config::MakeEmptyParticipantConfigurationImpl(), "TestParticipant");
+
+    EXPECT_THROW(SilKit::Experimental::Participant::GetSendQueueStatusImpl(participant.get(), "OtherParticipant"),
+                 SilKit::SilKitError);
+}
+
 } // anonymous namespace
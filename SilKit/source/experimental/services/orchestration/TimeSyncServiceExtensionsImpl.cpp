@@ -0,0 +1,68 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "silkit/services/orchestration/ITimeSyncService.hpp"
+#include "silkit/experimental/services/orchestration/OrchestrationDatatypesExtensions.hpp"
+
+#include "TimeSyncServiceExtensionsImpl.hpp"
+#include "TimeSyncService.hpp"
+
+namespace SilKit {
+namespace Experimental {
+namespace Services {
+namespace Orchestration {
+
+void SetNextEventTimeImpl(SilKit::Services::Orchestration::ITimeSyncService* timeSyncService,
+                          std::chrono::nanoseconds nextEventTime)
+{
+    auto timeSyncServiceImpl = dynamic_cast<SilKit::Services::Orchestration::TimeSyncService*>(timeSyncService);
+    if (timeSyncServiceImpl == nullptr)
+    {
+        throw SilKit::SilKitError("timeSyncService is not a valid SilKit::Services::Orchestration::ITimeSyncService*");
+    }
+    timeSyncServiceImpl->SetNextEventTime(nextEventTime);
+}
+
+auto GetRealTimePacingStatisticsImpl(SilKit::Services::Orchestration::ITimeSyncService* timeSyncService)
+    -> SilKit::Experimental::Services::Orchestration::RealTimePacingStatistics
+{
+    auto timeSyncServiceImpl = dynamic_cast<SilKit::Services::Orchestration::TimeSyncService*>(timeSyncService);
+    if (timeSyncServiceImpl == nullptr)
+    {
+        throw SilKit::SilKitError("timeSyncService is not a valid SilKit::Services::Orchestration::ITimeSyncService*");
+    }
+
+    const auto statistics = timeSyncServiceImpl->GetRealTimePacer().GetStatistics();
+
+    RealTimePacingStatistics result{};
+    result.steps = statistics.steps;
+    result.overruns = statistics.overruns;
+    result.lastLag = statistics.lastLag;
+    result.maxLag = statistics.maxLag;
+    result.totalLag = statistics.totalLag;
+    return result;
+}
+
+} // namespace Orchestration
+} // namespace Services
+} // namespace Experimental
+} // namespace SilKit
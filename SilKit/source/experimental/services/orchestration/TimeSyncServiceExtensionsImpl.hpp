@@ -0,0 +1,69 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+// ================================================================================
+//  ATTENTION: This header must NOT include any SIL Kit header (neither internal,
+//             nor public), as it is used to implement the 'legacy' ABI functions.
+// ================================================================================
+
+#include <chrono>
+
+// Forward Declarations
+
+namespace SilKit {
+namespace Services {
+namespace Orchestration {
+class ITimeSyncService;
+} // namespace Orchestration
+} // namespace Services
+} // namespace SilKit
+
+namespace SilKit {
+namespace Experimental {
+namespace Services {
+namespace Orchestration {
+struct RealTimePacingStatistics;
+} // namespace Orchestration
+} // namespace Services
+} // namespace Experimental
+} // namespace SilKit
+
+
+// Function Declarations
+
+namespace SilKit {
+namespace Experimental {
+namespace Services {
+namespace Orchestration {
+
+void SetNextEventTimeImpl(SilKit::Services::Orchestration::ITimeSyncService* timeSyncService,
+                          std::chrono::nanoseconds nextEventTime);
+
+auto GetRealTimePacingStatisticsImpl(SilKit::Services::Orchestration::ITimeSyncService* timeSyncService)
+    -> SilKit::Experimental::Services::Orchestration::RealTimePacingStatistics;
+
+} // namespace Orchestration
+} // namespace Services
+} // namespace Experimental
+} // namespace SilKit
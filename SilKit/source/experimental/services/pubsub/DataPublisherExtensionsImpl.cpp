@@ -0,0 +1,72 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "silkit/services/pubsub/IDataPublisher.hpp"
+#include "silkit/participant/exception.hpp"
+
+#include "DataPublisherExtensionsImpl.hpp"
+#include "DataPublisher.hpp"
+#include "DataSerdes.hpp"
+
+namespace SilKit {
+namespace Experimental {
+namespace Services {
+namespace PubSub {
+
+namespace {
+
+auto GetDataPublisherImpl(SilKit::Services::PubSub::IDataPublisher* dataPublisher)
+    -> SilKit::Services::PubSub::DataPublisher&
+{
+    auto dataPublisherImpl = dynamic_cast<SilKit::Services::PubSub::DataPublisher*>(dataPublisher);
+    if (dataPublisherImpl == nullptr)
+    {
+        throw SilKit::SilKitError("dataPublisher is not a valid SilKit::Services::PubSub::IDataPublisher*");
+    }
+    return *dataPublisherImpl;
+}
+
+} // namespace
+
+auto LoanBufferImpl(SilKit::Services::PubSub::IDataPublisher* dataPublisher, size_t size)
+    -> std::unique_ptr<DataPublisherLoanImpl>
+{
+    auto loan = std::make_unique<DataPublisherLoanImpl>();
+    loan->buffer = GetDataPublisherImpl(dataPublisher).LoanBuffer(size);
+    loan->data = loan->buffer.data() + SilKit::Services::PubSub::SerializedDataMessageDataOffset;
+    return loan;
+}
+
+void PublishLoanImpl(SilKit::Services::PubSub::IDataPublisher* dataPublisher,
+                     std::unique_ptr<DataPublisherLoanImpl> loan)
+{
+    if (loan == nullptr)
+    {
+        throw SilKit::SilKitError("loan must not be null");
+    }
+    GetDataPublisherImpl(dataPublisher).PublishLoan(std::move(loan->buffer));
+}
+
+} // namespace PubSub
+} // namespace Services
+} // namespace Experimental
+} // namespace SilKit
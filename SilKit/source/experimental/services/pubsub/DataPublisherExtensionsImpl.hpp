@@ -0,0 +1,71 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+// ================================================================================
+//  ATTENTION: This header must NOT include any SIL Kit header (neither internal,
+//             nor public), as it is used to implement the 'legacy' ABI functions.
+// ================================================================================
+
+#include <memory>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+// Forward Declarations
+
+namespace SilKit {
+namespace Services {
+namespace PubSub {
+class IDataPublisher;
+} // namespace PubSub
+} // namespace Services
+} // namespace SilKit
+
+
+// Function Declarations
+
+namespace SilKit {
+namespace Experimental {
+namespace Services {
+namespace PubSub {
+
+//! Buffer loaned from a DataPublisher, the object behind a SilKit_Experimental_DataPublisherLoan handle
+struct DataPublisherLoanImpl
+{
+    std::vector<uint8_t> buffer;
+    //! The data to be filled by the user, located inside the buffer
+    uint8_t* data{nullptr};
+};
+
+auto LoanBufferImpl(SilKit::Services::PubSub::IDataPublisher* dataPublisher, size_t size)
+    -> std::unique_ptr<DataPublisherLoanImpl>;
+
+void PublishLoanImpl(SilKit::Services::PubSub::IDataPublisher* dataPublisher,
+                     std::unique_ptr<DataPublisherLoanImpl> loan);
+
+} // namespace PubSub
+} // namespace Services
+} // namespace Experimental
+} // namespace SilKit
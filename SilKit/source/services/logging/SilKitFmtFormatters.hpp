@@ -95,6 +95,7 @@ MAKE_FORMATTER(SilKit::Services::Logging::LogMsg);
 MAKE_FORMATTER(SilKit::Services::Orchestration::NextSimTask);
 MAKE_FORMATTER(SilKit::Services::Orchestration::ParticipantState);
 MAKE_FORMATTER(SilKit::Services::Orchestration::ParticipantStatus);
+MAKE_FORMATTER(SilKit::Services::Orchestration::CompactParticipantStatus);
 MAKE_FORMATTER(SilKit::Services::Orchestration::SystemState);
 MAKE_FORMATTER(SilKit::Services::Orchestration::SystemCommand);
 MAKE_FORMATTER(SilKit::Services::Orchestration::WorkflowConfiguration);
@@ -31,7 +31,7 @@ namespace Orchestration {
 
 class IMsgForLifecycleService
     : public Core::IReceiver<SystemCommand>
-    , public Core::ISender<ParticipantStatus>
+    , public Core::ISender<ParticipantStatus, CompactParticipantStatus>
 {
 };
 
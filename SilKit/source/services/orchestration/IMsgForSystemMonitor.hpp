@@ -21,7 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
-#include "silkit/services/orchestration/OrchestrationDatatypes.hpp"
+#include "OrchestrationDatatypes.hpp"
 #include "IReceiver.hpp"
 #include "ISender.hpp"
 
@@ -30,7 +30,7 @@ namespace Services {
 namespace Orchestration {
 
 class IMsgForSystemMonitor
-    : public Core::IReceiver<ParticipantStatus, WorkflowConfiguration>
+    : public Core::IReceiver<ParticipantStatus, WorkflowConfiguration, CompactParticipantStatus>
     , public Core::ISender<>
 {
 };
@@ -19,6 +19,7 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <algorithm>
 #include <future>
 
 #include "silkit/services/orchestration/ISystemMonitor.hpp"
@@ -30,6 +31,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "IServiceDiscovery.hpp"
 #include "ILogger.hpp"
 #include "LifecycleManagement.hpp"
+#include "traits/SilKitMsgTraits.hpp"
 
 using namespace std::chrono_literals;
 
@@ -37,9 +39,10 @@ namespace SilKit {
 namespace Services {
 namespace Orchestration {
 
-LifecycleService::LifecycleService(Core::IParticipantInternal* participant)
+LifecycleService::LifecycleService(Core::IParticipantInternal* participant, bool compactStartupStatus)
     : _participant{participant}
     , _logger{participant->GetLogger()}
+    , _compactStartupStatus{compactStartupStatus}
     , _lifecycleManager{participant, participant->GetLogger(), this}
     , _finalStatePromise{std::make_unique<std::promise<ParticipantState>>()}
     , _finalStateFuture{_finalStatePromise->get_future()}
@@ -460,6 +463,25 @@ void LifecycleService::SetWorkflowConfiguration(const WorkflowConfiguration& con
     }
 }
 
+namespace {
+
+bool IsStartupState(ParticipantState state)
+{
+    switch (state)
+    {
+    case ParticipantState::ServicesCreated:
+    case ParticipantState::CommunicationInitializing:
+    case ParticipantState::CommunicationInitialized:
+    case ParticipantState::ReadyToRun:
+    case ParticipantState::Running:
+        return true;
+    default:
+        return false;
+    }
+}
+
+} // namespace
+
 void LifecycleService::ChangeParticipantState(ParticipantState newState, std::string reason)
 {
     ParticipantStatus status{};
@@ -479,9 +501,48 @@ void LifecycleService::ChangeParticipantState(ParticipantState newState, std::st
         _status = status;
     }
 
+    // Only the startup states are sent as compact status, e.g., errors and stopping are sent as full status
+    if (_compactStartupStatus && IsStartupState(newState))
+    {
+        SendCompactStatus(status);
+        return;
+    }
+
     SendMsg(status);
 }
 
+void LifecycleService::SendCompactStatus(const ParticipantStatus& status)
+{
+    CompactParticipantStatus compactStatus{};
+    compactStatus.state = status.state;
+    compactStatus.enterReason = status.enterReason;
+    compactStatus.enterTime = status.enterTime;
+
+    SendMsg(compactStatus);
+
+    // A system monitor subscribes to the full status before the compact one. If both have the same number of remote
+    // receivers, there is no participant of an older version, which does not know the compact status.
+    const auto compactStatusName = Core::SilKitMsgTraits<CompactParticipantStatus>::SerdesName();
+    const auto statusName = Core::SilKitMsgTraits<ParticipantStatus>::SerdesName();
+    if (_participant->GetNumberOfRemoteReceivers(this, statusName)
+        == _participant->GetNumberOfRemoteReceivers(this, compactStatusName))
+    {
+        return;
+    }
+
+    // Participants of older versions are sent the full status instead
+    const auto compactStatusReceivers = _participant->GetParticipantNamesOfRemoteReceivers(this, compactStatusName);
+    const auto statusReceivers = _participant->GetParticipantNamesOfRemoteReceivers(this, statusName);
+    for (const auto& receiver : statusReceivers)
+    {
+        if (std::find(compactStatusReceivers.begin(), compactStatusReceivers.end(), receiver)
+            == compactStatusReceivers.end())
+        {
+            _participant->SendMsg(this, receiver, status);
+        }
+    }
+}
+
 void LifecycleService::SetTimeSyncService(TimeSyncService* timeSyncService)
 {
     _timeSyncService = timeSyncService;
@@ -53,7 +53,7 @@ class LifecycleService
 public:
     // ----------------------------------------
     // Constructors, Destructor, and Assignment
-    LifecycleService(Core::IParticipantInternal* participant);
+    LifecycleService(Core::IParticipantInternal* participant, bool compactStartupStatus = false);
 
     ~LifecycleService();
 
@@ -141,6 +141,9 @@ private:
     /// Uses the mutex _requiredParticipantNamesMx.
     bool HasRequiredParticipantNames() const;
 
+    /// Sends the status as CompactParticipantStatus, and as full status to the participants of older versions.
+    void SendCompactStatus(const ParticipantStatus& status);
+
 private:
     // ----------------------------------------
     // private members
@@ -158,6 +161,9 @@ private:
     /// LifecycleService::Status() always causes a data-race because the access cannot be protected.
     mutable ParticipantStatus _returnValueForStatus;
 
+    // With the compact startup status, the startup states are sent as CompactParticipantStatus
+    bool _compactStartupStatus{false};
+
     std::atomic<bool> _isLifecycleStarted{false};
     std::atomic<bool> _abortedBeforeLifecycleStart{false};
     
@@ -0,0 +1,168 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "RealTimePacer.hpp"
+
+#include <algorithm>
+
+#include "ILogger.hpp"
+
+namespace {
+
+struct MonotonicClock : public SilKit::Services::Orchestration::RealTimePacer::IClock
+{
+    auto Now() const -> std::chrono::nanoseconds override
+    {
+        return std::chrono::steady_clock::now().time_since_epoch();
+    }
+};
+
+auto GetMonotonicClock() -> MonotonicClock&
+{
+    static MonotonicClock monotonicClock{};
+    return monotonicClock;
+}
+
+using DoubleMicroseconds = std::chrono::duration<double, std::micro>;
+
+} // namespace
+
+namespace SilKit {
+namespace Services {
+namespace Orchestration {
+
+RealTimePacer::RealTimePacer(const Config::TimeSynchronization& timeSyncConfig, Logging::ILogger* logger,
+                             IClock* clock)
+    : _factor{timeSyncConfig.realTimeFactor}
+    , _catchUp{timeSyncConfig.realTimeCatchUp}
+    , _logger{logger}
+    , _clock{clock ? clock : &GetMonotonicClock()}
+{
+}
+
+RealTimePacer::~RealTimePacer()
+{
+    if (_statistics.steps > 0)
+    {
+        Logging::Info(_logger, "Real-time pacing: {} steps, {} overruns, mean lag {}us, max lag {}us",
+                      _statistics.steps, _statistics.overruns,
+                      std::chrono::duration_cast<DoubleMicroseconds>(_statistics.totalLag).count()
+                          / static_cast<double>(_statistics.steps),
+                      std::chrono::duration_cast<DoubleMicroseconds>(_statistics.maxLag).count());
+    }
+}
+
+bool RealTimePacer::IsEnabled() const
+{
+    return _factor > 0.0;
+}
+
+bool RealTimePacer::IsDue(std::chrono::nanoseconds timePoint)
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    if (!_anchored || _clock->Now() >= DeadlineOf(timePoint))
+    {
+        return true;
+    }
+
+    _waitedForTimePoint = timePoint;
+    return false;
+}
+
+auto RealTimePacer::GetDeadline(std::chrono::nanoseconds timePoint) const -> std::chrono::nanoseconds
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    return _anchored ? DeadlineOf(timePoint) : _clock->Now();
+}
+
+auto RealTimePacer::StartStep(std::chrono::nanoseconds timePoint) -> std::chrono::nanoseconds
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    _statistics.steps += 1;
+
+    const auto now = _clock->Now();
+    if (!_anchored)
+    {
+        _anchored = true;
+        _anchorWallClock = now;
+        _anchorTimePoint = timePoint;
+        _statistics.lastLag = std::chrono::nanoseconds{0};
+        return _statistics.lastLag;
+    }
+
+    const auto deadline = DeadlineOf(timePoint);
+    const bool isOverrun = _waitedForTimePoint != timePoint && now >= deadline;
+    _waitedForTimePoint = std::chrono::nanoseconds::min();
+
+    const auto lag = std::max(now - deadline, std::chrono::nanoseconds{0});
+    _statistics.lastLag = lag;
+    _statistics.maxLag = std::max(_statistics.maxLag, lag);
+    _statistics.totalLag += lag;
+
+    if (isOverrun)
+    {
+        _statistics.overruns += 1;
+        Logging::Debug(_logger, "Real-time pacing: simulation step at {}ns started {}us after its deadline",
+                       timePoint.count(), std::chrono::duration_cast<DoubleMicroseconds>(lag).count());
+
+        if (_catchUp == Config::TimeSynchronization::RealTimeCatchUp::Skip)
+        {
+            // continue the schedule from this step, instead of executing the next steps without waiting
+            _anchorWallClock = now;
+            _anchorTimePoint = timePoint;
+        }
+    }
+    else
+    {
+        Logging::Trace(_logger, "Real-time pacing: simulation step at {}ns started with a lag of {}us",
+                       timePoint.count(), std::chrono::duration_cast<DoubleMicroseconds>(lag).count());
+    }
+
+    return lag;
+}
+
+void RealTimePacer::Rebase()
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    _anchored = false;
+}
+
+auto RealTimePacer::GetStatistics() const -> Statistics
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    return _statistics;
+}
+
+auto RealTimePacer::DeadlineOf(std::chrono::nanoseconds timePoint) const -> std::chrono::nanoseconds
+{
+    return _anchorWallClock + ToWallClock(timePoint - _anchorTimePoint);
+}
+
+auto RealTimePacer::ToWallClock(std::chrono::nanoseconds simulationDuration) const -> std::chrono::nanoseconds
+{
+    return std::chrono::nanoseconds{
+        static_cast<std::chrono::nanoseconds::rep>(static_cast<double>(simulationDuration.count()) / _factor)};
+}
+
+} // namespace Orchestration
+} // namespace Services
+} // namespace SilKit
@@ -0,0 +1,106 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+#include "ParticipantConfiguration.hpp"
+#include "silkit/services/logging/ILogger.hpp"
+
+namespace SilKit {
+namespace Services {
+namespace Orchestration {
+
+//! Paces the simulation steps of a synchronized participant to the wall clock. The deadline of each step is computed
+//! from the wall-clock time and the simulation time of the first step, and the speed factor. Waiting for an absolute
+//! deadline, instead of sleeping for the remaining step duration, does not accumulate the wake-up latencies.
+//! The pacer does not wait itself: The caller checks whether a step is due, and otherwise waits for the deadline with
+//! a timer, without blocking its thread. The statistics may be read from any thread.
+class RealTimePacer
+{
+public:
+    struct IClock
+    {
+        virtual ~IClock() = default;
+
+        //! Returns the current time of the steady clock, since its epoch
+        virtual auto Now() const -> std::chrono::nanoseconds = 0;
+    };
+
+    struct Statistics
+    {
+        uint64_t steps{0};
+        //! Steps whose deadline had already passed when the participant got to execute them
+        uint64_t overruns{0};
+        //! Delay between the deadline and the actual start of the step
+        std::chrono::nanoseconds lastLag{0};
+        std::chrono::nanoseconds maxLag{0};
+        std::chrono::nanoseconds totalLag{0};
+    };
+
+public:
+    RealTimePacer(const Config::TimeSynchronization& timeSyncConfig, Logging::ILogger* logger,
+                  IClock* clock = nullptr);
+    ~RealTimePacer();
+
+public:
+    bool IsEnabled() const;
+
+    //! Returns true if the simulation step at the given time is due. Otherwise, the caller waits for the deadline,
+    //! see GetDeadline, and checks again. The first step of the schedule is always due.
+    bool IsDue(std::chrono::nanoseconds timePoint);
+    //! The wall-clock deadline of the simulation step at the given time, on the steady clock
+    auto GetDeadline(std::chrono::nanoseconds timePoint) const -> std::chrono::nanoseconds;
+    //! Records the start of the simulation step at the given time. Returns the lag of the step start.
+    auto StartStep(std::chrono::nanoseconds timePoint) -> std::chrono::nanoseconds;
+    //! Restarts the schedule with the next step, e.g., after the simulation was paused
+    void Rebase();
+
+    auto GetStatistics() const -> Statistics;
+
+private:
+    auto DeadlineOf(std::chrono::nanoseconds timePoint) const -> std::chrono::nanoseconds;
+    auto ToWallClock(std::chrono::nanoseconds simulationDuration) const -> std::chrono::nanoseconds;
+
+private:
+    double _factor;
+    Config::TimeSynchronization::RealTimeCatchUp _catchUp;
+    Logging::ILogger* _logger;
+    IClock* _clock;
+
+    mutable std::mutex _mutex;
+
+    bool _anchored{false};
+    std::chrono::nanoseconds _anchorWallClock{0};
+    std::chrono::nanoseconds _anchorTimePoint{0};
+    //! The step which was not yet due when it was checked, i.e., which was waited for
+    std::chrono::nanoseconds _waitedForTimePoint{std::chrono::nanoseconds::min()};
+
+    Statistics _statistics;
+};
+
+} // namespace Orchestration
+} // namespace Services
+} // namespace SilKit
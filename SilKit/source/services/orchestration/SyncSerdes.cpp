@@ -71,6 +71,23 @@ inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buff
     return buffer;
 }
 
+inline SilKit::Core::MessageBuffer& operator<<(SilKit::Core::MessageBuffer& buffer,
+                                               const SilKit::Services::Orchestration::CompactParticipantStatus& compactStatus)
+{
+    buffer << compactStatus.state
+           << compactStatus.enterReason
+           << compactStatus.enterTime;
+    return buffer;
+}
+inline SilKit::Core::MessageBuffer& operator>>(SilKit::Core::MessageBuffer& buffer,
+                                               SilKit::Services::Orchestration::CompactParticipantStatus& compactStatus)
+{
+    buffer >> compactStatus.state
+           >> compactStatus.enterReason
+           >> compactStatus.enterTime;
+    return buffer;
+}
+
 inline SilKit::Core::MessageBuffer& operator<<(SilKit::Core::MessageBuffer& buffer,
                                          const SilKit::Services::Orchestration::WorkflowConfiguration& workflowConfiguration)
 {
@@ -95,6 +112,11 @@ void Serialize(SilKit::Core::MessageBuffer& buffer, const ParticipantStatus& msg
     buffer << msg;
     return;
 }
+void Serialize(SilKit::Core::MessageBuffer& buffer, const CompactParticipantStatus& msg)
+{
+    buffer << msg;
+    return;
+}
 void Serialize(SilKit::Core::MessageBuffer& buffer, const WorkflowConfiguration& msg)
 {
     buffer << msg;
@@ -114,6 +136,10 @@ void Deserialize(SilKit::Core::MessageBuffer& buffer, ParticipantStatus& out)
 {
     buffer >> out;
 }
+void Deserialize(SilKit::Core::MessageBuffer& buffer, CompactParticipantStatus& out)
+{
+    buffer >> out;
+}
 void Deserialize(SilKit::Core::MessageBuffer& buffer, WorkflowConfiguration& out)
 {
     buffer >> out;
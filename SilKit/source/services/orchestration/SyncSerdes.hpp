@@ -30,11 +30,13 @@ namespace Orchestration {
 
 void Serialize(SilKit::Core::MessageBuffer& buffer, const SystemCommand& msg);
 void Serialize(SilKit::Core::MessageBuffer& buffer, const ParticipantStatus& msg);
+void Serialize(SilKit::Core::MessageBuffer& buffer, const CompactParticipantStatus& msg);
 void Serialize(SilKit::Core::MessageBuffer& buffer, const WorkflowConfiguration& msg);
 void Serialize(SilKit::Core::MessageBuffer& buffer, const NextSimTask& msg);
 
 void Deserialize(SilKit::Core::MessageBuffer& buffer, SystemCommand& out);
 void Deserialize(SilKit::Core::MessageBuffer& buffer, ParticipantStatus& out);
+void Deserialize(SilKit::Core::MessageBuffer& buffer, CompactParticipantStatus& out);
 void Deserialize(SilKit::Core::MessageBuffer& buffer, WorkflowConfiguration& out);
 void Deserialize(SilKit::Core::MessageBuffer& buffer, NextSimTask& out);
 
@@ -56,16 +56,14 @@ void SystemMonitor::UpdateRequiredParticipantNames(const std::vector<std::string
     _requiredParticipantNames = requiredParticipantNames;
 
     bool allRequiredParticipantsKnown = true;
-    // Init new participants in status map
-    for (auto&& name : _requiredParticipantNames)
     {
         std::unique_lock<decltype(_participantStatusMx)> lock{_participantStatusMx};
 
-        auto&& statusIter = _participantStatus.find(name);
-        if (statusIter == _participantStatus.end())
-        {
-            allRequiredParticipantsKnown = false;
-        }
+        _requiredParticipantNameSet.clear();
+        _requiredParticipantNameSet.insert(_requiredParticipantNames.begin(), _requiredParticipantNames.end());
+        RecountRequiredParticipantStates();
+
+        allRequiredParticipantsKnown = (_requiredParticipantsWithoutStatus == 0);
     }
 
     // Update / propagate the system state in case status updated for all required participants have been received already
@@ -171,26 +169,54 @@ auto SystemMonitor::ParticipantStatus(const std::string& participantName) const
 }
 
 
-void SystemMonitor::ReceiveMsg(const IServiceEndpoint* /*from*/, const Orchestration::ParticipantStatus& newParticipantStatus)
+void SystemMonitor::ReceiveMsg(const IServiceEndpoint* from, const Orchestration::CompactParticipantStatus& msg)
 {
-    auto participantName = newParticipantStatus.participantName;
+    const auto& participantName = from->GetServiceDescriptor().GetParticipantName();
 
-    // Explicitly initialize unknown participants
-    auto&& statusIter = _participantStatus.find(participantName);
-    if (statusIter == _participantStatus.end())
     {
         std::unique_lock<decltype(_participantStatusMx)> lock{_participantStatusMx};
-        auto initialStatus = Orchestration::ParticipantStatus{};
-        initialStatus.participantName = participantName;
-        initialStatus.state = Orchestration::ParticipantState::Invalid;
-        _participantStatus.emplace(participantName, initialStatus);
+        auto&& statusIter = _participantStatus.find(participantName);
+        if (statusIter != _participantStatus.end())
+        {
+            // The state may already be known from the full status, e.g., the history delivered to a late joiner
+            const auto& knownStatus = statusIter->second;
+            if (msg.enterTime < knownStatus.enterTime
+                || (msg.enterTime == knownStatus.enterTime && msg.state == knownStatus.state))
+            {
+                return;
+            }
+        }
     }
 
-    // Save former state
+    Orchestration::ParticipantStatus participantStatus{};
+    participantStatus.participantName = participantName;
+    participantStatus.state = msg.state;
+    participantStatus.enterReason = msg.enterReason;
+    participantStatus.enterTime = msg.enterTime;
+    participantStatus.refreshTime = msg.enterTime;
+    ReceiveMsg(from, participantStatus);
+}
+
+void SystemMonitor::ReceiveMsg(const IServiceEndpoint* /*from*/, const Orchestration::ParticipantStatus& newParticipantStatus)
+{
+    auto participantName = newParticipantStatus.participantName;
+
+    // Explicitly initialize unknown participants and save the former state
     ParticipantState oldParticipantState;
     {
         std::unique_lock<decltype(_participantStatusMx)> lock{_participantStatusMx};
-        oldParticipantState = _participantStatus.at(participantName).state;
+
+        auto&& statusIter = _participantStatus.find(participantName);
+        if (statusIter == _participantStatus.end())
+        {
+            auto initialStatus = Orchestration::ParticipantStatus{};
+            initialStatus.participantName = participantName;
+            initialStatus.state = Orchestration::ParticipantState::Invalid;
+            statusIter = _participantStatus.emplace(participantName, initialStatus).first;
+            CountRequiredParticipantState(participantName, initialStatus.state, +1);
+        }
+
+        oldParticipantState = statusIter->second.state;
     }
 
     // Check if transition is valid
@@ -205,7 +231,10 @@ void SystemMonitor::ReceiveMsg(const IServiceEndpoint* /*from*/, const Orchestra
     // Update status map
     {
         std::unique_lock<decltype(_participantStatusMx)> lock{_participantStatusMx};
-        _participantStatus.at(participantName) = newParticipantStatus;
+        auto& participantStatus = _participantStatus.at(participantName);
+        CountRequiredParticipantState(participantName, participantStatus.state, -1);
+        participantStatus = newParticipantStatus;
+        CountRequiredParticipantState(participantName, participantStatus.state, +1);
     }
 
     // On new participant state
@@ -332,6 +361,7 @@ void SystemMonitor::OnParticipantDisconnected(const ParticipantConnectionInforma
         auto it = _participantStatus.find(participantConnectionInformation.participantName);
         if (it != _participantStatus.end())
         {
+            CountRequiredParticipantState(it->first, it->second.state, -1);
             _participantStatus.erase(it);
         }
     }
@@ -343,30 +373,84 @@ void SystemMonitor::OnParticipantDisconnected(const ParticipantConnectionInforma
     }
 }
 
+namespace {
+
+auto ToStateIndex(Orchestration::ParticipantState state) -> size_t
+{
+    switch (state)
+    {
+    case Orchestration::ParticipantState::Invalid: return 0;
+    case Orchestration::ParticipantState::ServicesCreated: return 1;
+    case Orchestration::ParticipantState::CommunicationInitializing: return 2;
+    case Orchestration::ParticipantState::CommunicationInitialized: return 3;
+    case Orchestration::ParticipantState::ReadyToRun: return 4;
+    case Orchestration::ParticipantState::Running: return 5;
+    case Orchestration::ParticipantState::Paused: return 6;
+    case Orchestration::ParticipantState::Stopping: return 7;
+    case Orchestration::ParticipantState::Stopped: return 8;
+    case Orchestration::ParticipantState::Error: return 9;
+    case Orchestration::ParticipantState::ShuttingDown: return 10;
+    case Orchestration::ParticipantState::Shutdown: return 11;
+    case Orchestration::ParticipantState::Aborting: return 12;
+    }
+    // unknown states, e.g., received from a newer participant, are never accepted
+    return 13;
+}
+
+} // namespace
+
 bool SystemMonitor::AllRequiredParticipantsInState(std::initializer_list<Orchestration::ParticipantState> acceptedStates) const
 {
-    for (auto&& name : _requiredParticipantNames)
+    std::unique_lock<decltype(_participantStatusMx)> lock{_participantStatusMx};
+
+    // This also blocks any SystemState updates if a required participant has disconnected and thus removed from _participantStatus.
+    if (_requiredParticipantsWithoutStatus != 0)
+    {
+        return false;
+    }
+
+    size_t acceptedCount{0};
+    for (auto&& acceptedState : acceptedStates)
+    {
+        acceptedCount += _requiredParticipantStateCounts[ToStateIndex(acceptedState)];
+    }
+    return acceptedCount == _requiredParticipantNameSet.size();
+}
+
+void SystemMonitor::CountRequiredParticipantState(const std::string& participantName,
+                                                  Orchestration::ParticipantState state, int delta)
+{
+    if (_requiredParticipantNameSet.count(participantName) == 0)
+    {
+        return;
+    }
+
+    auto& stateCount = _requiredParticipantStateCounts[ToStateIndex(state)];
+    if (delta > 0)
+    {
+        stateCount += 1;
+        _requiredParticipantsWithoutStatus -= 1;
+    }
+    else
+    {
+        stateCount -= 1;
+        _requiredParticipantsWithoutStatus += 1;
+    }
+}
+
+void SystemMonitor::RecountRequiredParticipantStates()
+{
+    _requiredParticipantStateCounts.fill(0);
+    _requiredParticipantsWithoutStatus = _requiredParticipantNameSet.size();
+
+    for (auto&& name : _requiredParticipantNameSet)
     {
-        // Check if required participant hasn't been removed from _participantStatus map.
-        // This also blocks any SystemState updates if a required participant has disconnected and thus removed from _participantStatus.
         auto&& it = _participantStatus.find(name);
-        if (it == _participantStatus.end())
+        if (it != _participantStatus.end())
         {
-            return false;
+            CountRequiredParticipantState(name, it->second.state, +1);
         }
-
-        auto participantState = [this, &name] {
-            std::unique_lock<decltype(_participantStatusMx)> lock{_participantStatusMx};
-            return _participantStatus.at(name).state;
-        }();
-
-        bool isAcceptedState = std::any_of(begin(acceptedStates), end(acceptedStates), [participantState](auto acceptedState) {
-            return participantState == acceptedState;
-        });
-        if (!isAcceptedState)
-            return false;
     }
-    return true;
 }
 
 void SystemMonitor::ValidateParticipantStatusUpdate(const Orchestration::ParticipantStatus& newStatus, Orchestration::ParticipantState oldState)
@@ -450,10 +534,12 @@ void SystemMonitor::ValidateParticipantStatusUpdate(const Orchestration::Partici
 
 void SystemMonitor::UpdateSystemState(const Orchestration::ParticipantStatus& newStatus)
 {
-    auto&& nameIter = std::find(_requiredParticipantNames.begin(), _requiredParticipantNames.end(), newStatus.participantName);
-    if (nameIter == _requiredParticipantNames.end())
     {
-        return;
+        std::unique_lock<decltype(_participantStatusMx)> lock{_participantStatusMx};
+        if (_requiredParticipantNameSet.count(newStatus.participantName) == 0)
+        {
+            return;
+        }
     }
 
     switch (newStatus.state)
@@ -21,6 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <array>
 #include <map>
 #include <memory>
 #include <unordered_set>
@@ -72,6 +73,7 @@ public:
 
     void ReceiveMsg(const IServiceEndpoint* from, const Orchestration::ParticipantStatus& msg) override;
     void ReceiveMsg(const IServiceEndpoint* from, const Orchestration::WorkflowConfiguration& msg) override;
+    void ReceiveMsg(const IServiceEndpoint* from, const Orchestration::CompactParticipantStatus& msg) override;
 
     void SetParticipantConnectedHandler(ParticipantConnectedHandler handler) override;
     void SetParticipantDisconnectedHandler(ParticipantDisconnectedHandler handler) override;
@@ -110,6 +112,10 @@ private:
     // ----------------------------------------
     // private methods
     bool AllRequiredParticipantsInState(std::initializer_list<Orchestration::ParticipantState> acceptedStates) const;
+    // Must be called with _participantStatusMx held
+    void CountRequiredParticipantState(const std::string& participantName, Orchestration::ParticipantState state,
+                                       int delta);
+    void RecountRequiredParticipantStates();
     void ValidateParticipantStatusUpdate(const Orchestration::ParticipantStatus& newStatus, Orchestration::ParticipantState oldState);
     void UpdateSystemState(const Orchestration::ParticipantStatus& newStatus);
     inline void SetSystemState(Orchestration::SystemState newState);
@@ -127,6 +133,14 @@ private:
     mutable std::mutex _participantStatusMx;
     std::map<std::string, Orchestration::ParticipantStatus> _participantStatus;
 
+    // Number of required participants in each state, updated with every status change, so the system state is
+    // derived without iterating over the required participants. Protected by _participantStatusMx.
+    static constexpr size_t ParticipantStateCount = 14;
+    std::unordered_set<std::string> _requiredParticipantNameSet;
+    std::array<size_t, ParticipantStateCount> _requiredParticipantStateCounts{};
+    //! Required participants without a status, i.e., not yet seen or disconnected
+    size_t _requiredParticipantsWithoutStatus{0};
+
     Orchestration::SystemState _systemState{Orchestration::SystemState::Invalid};
 
     unsigned int _invalidTransitionCount{0u};
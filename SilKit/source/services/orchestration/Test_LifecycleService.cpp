@@ -74,10 +74,43 @@ public:
 public:
     MOCK_METHOD(TimeSyncService*, CreateTimeSyncService, (LifecycleService*));
     MOCK_METHOD(void, SendMsg, (const IServiceEndpoint*, const ParticipantStatus& msg));
+    MOCK_METHOD(void, SendMsg, (const IServiceEndpoint*, const CompactParticipantStatus& msg));
+    MOCK_METHOD(void, SendMsg, (const IServiceEndpoint*, const std::string& targetParticipantName,
+                                const ParticipantStatus& msg));
 
 public:
 };
 
+// Knows a remote participant of the current version, and optionally one of an older version, which does not receive
+// the compact status
+class CompactStartupParticipant : public MockParticipant
+{
+public:
+    std::vector<std::string> GetParticipantNamesOfRemoteReceivers(const IServiceEndpoint* /*service*/,
+                                                                  const std::string& msgTypeName) override
+    {
+        ++numberOfNameLookups;
+        return RemoteReceivers(msgTypeName);
+    }
+
+    size_t GetNumberOfRemoteReceivers(const IServiceEndpoint* /*service*/, const std::string& msgTypeName) override
+    {
+        return RemoteReceivers(msgTypeName).size();
+    }
+
+    auto RemoteReceivers(const std::string& msgTypeName) const -> std::vector<std::string>
+    {
+        if (msgTypeName == "COMPACTPARTICIPANTSTATUS" || !hasOlderVersion)
+        {
+            return {"P2"};
+        }
+        return {"P2", "OldVersion"};
+    }
+
+    bool hasOlderVersion{true};
+    size_t numberOfNameLookups{0};
+};
+
 
 // Factory method to create a ParticipantStatus matcher that checks the state field
 auto AParticipantStatusWithState(ParticipantState expected)
@@ -1336,4 +1369,82 @@ TEST_F(Test_LifecycleService, error_on_not_required_coordinated)
     EXPECT_EQ(lifecycleService.State(), ParticipantState::Error);
     
 }
+
+TEST_F(Test_LifecycleService, compact_startup_sends_each_startup_state_once_with_its_reason)
+{
+    NiceMock<CompactStartupParticipant> compactParticipant;
+    LifecycleService lifecycleService(&compactParticipant, true);
+    lifecycleService.SetLifecycleConfiguration(StartAutonomous());
+    MockTimeSync mockTimeSync(&compactParticipant, &compactParticipant.mockTimeProvider, healthCheckConfig,
+                              &lifecycleService);
+    lifecycleService.SetTimeSyncService(&mockTimeSync);
+    lifecycleService.SetServiceDescriptor(p1Id.GetServiceDescriptor());
+
+    const std::vector<ParticipantState> startupStates{
+        ParticipantState::ServicesCreated, ParticipantState::CommunicationInitializing,
+        ParticipantState::CommunicationInitialized, ParticipantState::ReadyToRun, ParticipantState::Running};
+
+    // a compact status per state instead of the full status, participants of older versions are sent the full status
+    std::vector<CompactParticipantStatus> compactStatuses;
+    std::vector<ParticipantStatus> oldVersionStatuses;
+    EXPECT_CALL(compactParticipant, SendMsg(&lifecycleService, A<const ParticipantStatus&>())).Times(0);
+    EXPECT_CALL(compactParticipant, SendMsg(&lifecycleService, A<const CompactParticipantStatus&>()))
+        .Times(5)
+        .WillRepeatedly(Invoke([&compactStatuses](const IServiceEndpoint*, const CompactParticipantStatus& compactStatus) {
+            compactStatuses.push_back(compactStatus);
+        }));
+    EXPECT_CALL(compactParticipant, SendMsg(&lifecycleService, "OldVersion", A<const ParticipantStatus&>()))
+        .Times(5)
+        .WillRepeatedly(Invoke([&oldVersionStatuses](const IServiceEndpoint*, const std::string&,
+                                                     const ParticipantStatus& status) {
+            oldVersionStatuses.push_back(status);
+        }));
+    EXPECT_CALL(compactParticipant, SendMsg(&lifecycleService, "P2", A<const ParticipantStatus&>())).Times(0);
+
+    lifecycleService.StartLifecycle();
+    EXPECT_EQ(lifecycleService.State(), ParticipantState::Running);
+    Mock::VerifyAndClearExpectations(&compactParticipant);
+
+    ASSERT_EQ(compactStatuses.size(), startupStates.size());
+    ASSERT_EQ(oldVersionStatuses.size(), startupStates.size());
+    for (size_t index = 0; index != startupStates.size(); ++index)
+    {
+        EXPECT_EQ(compactStatuses[index].state, startupStates[index]);
+        EXPECT_FALSE(compactStatuses[index].enterReason.empty());
+        EXPECT_EQ(oldVersionStatuses[index].state, compactStatuses[index].state);
+        EXPECT_EQ(oldVersionStatuses[index].enterReason, compactStatuses[index].enterReason);
+        EXPECT_EQ(oldVersionStatuses[index].enterTime, compactStatuses[index].enterTime);
+    }
+
+    // states after the startup are sent as full status
+    EXPECT_CALL(compactParticipant,
+                SendMsg(&lifecycleService, AParticipantStatusWithState(ParticipantState::Paused)))
+        .Times(1);
+    EXPECT_CALL(compactParticipant, SendMsg(&lifecycleService, A<const CompactParticipantStatus&>())).Times(0);
+
+    lifecycleService.Pause("pause");
+}
+
+TEST_F(Test_LifecycleService, compact_startup_without_older_versions_sends_only_the_compact_status)
+{
+    NiceMock<CompactStartupParticipant> compactParticipant;
+    compactParticipant.hasOlderVersion = false;
+    LifecycleService lifecycleService(&compactParticipant, true);
+    lifecycleService.SetLifecycleConfiguration(StartAutonomous());
+    MockTimeSync mockTimeSync(&compactParticipant, &compactParticipant.mockTimeProvider, healthCheckConfig,
+                              &lifecycleService);
+    lifecycleService.SetTimeSyncService(&mockTimeSync);
+    lifecycleService.SetServiceDescriptor(p1Id.GetServiceDescriptor());
+
+    EXPECT_CALL(compactParticipant, SendMsg(&lifecycleService, A<const ParticipantStatus&>())).Times(0);
+    EXPECT_CALL(compactParticipant, SendMsg(&lifecycleService, A<const CompactParticipantStatus&>())).Times(5);
+    EXPECT_CALL(compactParticipant, SendMsg(&lifecycleService, _, A<const ParticipantStatus&>())).Times(0);
+
+    lifecycleService.StartLifecycle();
+    EXPECT_EQ(lifecycleService.State(), ParticipantState::Running);
+
+    // the numbers of receivers match, the participant names are not looked up
+    EXPECT_EQ(compactParticipant.numberOfNameLookups, 0u);
+}
+
 } // namespace
@@ -0,0 +1,195 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include <chrono>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "RealTimePacer.hpp"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+using namespace SilKit::Services::Orchestration;
+using SilKit::Config::TimeSynchronization;
+
+struct FakeClock : RealTimePacer::IClock
+{
+    std::chrono::nanoseconds now{1s};
+
+    auto Now() const -> std::chrono::nanoseconds override
+    {
+        return now;
+    }
+};
+
+//! Executes the steps like the time synchronization: A step which is not yet due waits for a timer expiring at its
+//! deadline. The timers are recorded and expire late by the wake-up latency, unless the step is supposed to take longer.
+struct FakeTimeSync
+{
+    RealTimePacer& pacer;
+    FakeClock& clock;
+    std::chrono::nanoseconds wakeUpLatency{0};
+    std::vector<std::chrono::nanoseconds> deadlines;
+
+    auto ExecuteStep(std::chrono::nanoseconds timePoint) -> std::chrono::nanoseconds
+    {
+        while (!pacer.IsDue(timePoint))
+        {
+            const auto deadline = pacer.GetDeadline(timePoint);
+            deadlines.push_back(deadline);
+            clock.now = deadline + wakeUpLatency;
+        }
+        return pacer.StartStep(timePoint);
+    }
+};
+
+auto MakeConfig(double realTimeFactor, TimeSynchronization::RealTimeCatchUp catchUp) -> TimeSynchronization
+{
+    TimeSynchronization config;
+    config.realTimeFactor = realTimeFactor;
+    config.realTimeCatchUp = catchUp;
+    return config;
+}
+
+TEST(Test_RealTimePacer, disabled_by_default)
+{
+    RealTimePacer pacer{TimeSynchronization{}, nullptr};
+    EXPECT_FALSE(pacer.IsEnabled());
+}
+
+TEST(Test_RealTimePacer, deadlines_are_scaled_by_the_factor)
+{
+    FakeClock clock;
+    RealTimePacer pacer{MakeConfig(2.0, TimeSynchronization::RealTimeCatchUp::Burst), nullptr, &clock};
+    ASSERT_TRUE(pacer.IsEnabled());
+    FakeTimeSync timeSync{pacer, clock};
+
+    // the first step anchors the schedule and does not wait
+    timeSync.ExecuteStep(10ms);
+    timeSync.ExecuteStep(20ms);
+    timeSync.ExecuteStep(30ms);
+
+    EXPECT_EQ(timeSync.deadlines, (std::vector<std::chrono::nanoseconds>{1s + 5ms, 1s + 10ms}));
+}
+
+TEST(Test_RealTimePacer, step_is_not_due_before_its_deadline)
+{
+    FakeClock clock;
+    RealTimePacer pacer{MakeConfig(1.0, TimeSynchronization::RealTimeCatchUp::Burst), nullptr, &clock};
+
+    EXPECT_TRUE(pacer.IsDue(0ms));
+    pacer.StartStep(0ms);
+
+    EXPECT_FALSE(pacer.IsDue(1ms));
+    EXPECT_EQ(pacer.GetDeadline(1ms), 1s + 1ms);
+
+    // the check does not wait
+    EXPECT_EQ(clock.now, 1s);
+    clock.now = 1s + 1ms;
+    EXPECT_TRUE(pacer.IsDue(1ms));
+}
+
+TEST(Test_RealTimePacer, wake_up_latency_does_not_accumulate)
+{
+    FakeClock clock;
+    RealTimePacer pacer{MakeConfig(1.0, TimeSynchronization::RealTimeCatchUp::Burst), nullptr, &clock};
+    FakeTimeSync timeSync{pacer, clock};
+    timeSync.wakeUpLatency = 100us;
+
+    timeSync.ExecuteStep(0ms);
+    for (auto timePoint = 1ms; timePoint <= 10ms; timePoint += 1ms)
+    {
+        EXPECT_EQ(timeSync.ExecuteStep(timePoint), 100us);
+    }
+
+    EXPECT_EQ(timeSync.deadlines.back(), 1s + 10ms);
+
+    const auto statistics = pacer.GetStatistics();
+    EXPECT_EQ(statistics.steps, 11u);
+    EXPECT_EQ(statistics.overruns, 0u);
+    EXPECT_EQ(statistics.maxLag, 100us);
+    EXPECT_EQ(statistics.totalLag, 1ms);
+}
+
+TEST(Test_RealTimePacer, burst_keeps_the_schedule_after_an_overrun)
+{
+    FakeClock clock;
+    RealTimePacer pacer{MakeConfig(1.0, TimeSynchronization::RealTimeCatchUp::Burst), nullptr, &clock};
+    FakeTimeSync timeSync{pacer, clock};
+
+    timeSync.ExecuteStep(0ms);
+    // the step at 0ms took 3.5ms of wall-clock time
+    clock.now += 3500us;
+
+    EXPECT_EQ(timeSync.ExecuteStep(1ms), 2500us);
+    EXPECT_EQ(timeSync.ExecuteStep(2ms), 1500us);
+    EXPECT_EQ(timeSync.ExecuteStep(3ms), 500us);
+    EXPECT_TRUE(timeSync.deadlines.empty());
+
+    EXPECT_EQ(timeSync.ExecuteStep(4ms), 0ms);
+    EXPECT_EQ(timeSync.deadlines, (std::vector<std::chrono::nanoseconds>{1s + 4ms}));
+
+    const auto statistics = pacer.GetStatistics();
+    EXPECT_EQ(statistics.overruns, 3u);
+    EXPECT_EQ(statistics.maxLag, 2500us);
+    EXPECT_EQ(statistics.totalLag, 4500us);
+}
+
+TEST(Test_RealTimePacer, skip_restarts_the_schedule_after_an_overrun)
+{
+    FakeClock clock;
+    RealTimePacer pacer{MakeConfig(1.0, TimeSynchronization::RealTimeCatchUp::Skip), nullptr, &clock};
+    FakeTimeSync timeSync{pacer, clock};
+
+    timeSync.ExecuteStep(0ms);
+    clock.now += 3500us;
+
+    EXPECT_EQ(timeSync.ExecuteStep(1ms), 2500us);
+    EXPECT_EQ(timeSync.ExecuteStep(2ms), 0ms);
+    EXPECT_EQ(timeSync.deadlines, (std::vector<std::chrono::nanoseconds>{1s + 4500us}));
+
+    EXPECT_EQ(pacer.GetStatistics().overruns, 1u);
+}
+
+TEST(Test_RealTimePacer, rebase_anchors_the_schedule_at_the_next_step)
+{
+    FakeClock clock;
+    RealTimePacer pacer{MakeConfig(1.0, TimeSynchronization::RealTimeCatchUp::Burst), nullptr, &clock};
+    FakeTimeSync timeSync{pacer, clock};
+
+    timeSync.ExecuteStep(0ms);
+    timeSync.ExecuteStep(1ms);
+
+    // e.g., the simulation was paused for a while
+    clock.now += 10s;
+    pacer.Rebase();
+
+    EXPECT_EQ(timeSync.ExecuteStep(2ms), 0ms);
+    timeSync.ExecuteStep(3ms);
+    EXPECT_EQ(timeSync.deadlines.back(), 11s + 2ms);
+    EXPECT_EQ(pacer.GetStatistics().overruns, 0u);
+}
+
+} // namespace
@@ -70,5 +70,28 @@ TEST(Test_SyncSerdes, MwSync_ParticipantStatus)
     EXPECT_EQ(in.refreshTime, out.refreshTime);
 }
 
+TEST(Test_SyncSerdes, MwSync_CompactParticipantStatus)
+{
+    using namespace SilKit::Services::Orchestration;
+    SilKit::Core::MessageBuffer buffer;
+
+    auto now = std::chrono::system_clock::now();
+    decltype(now) nowUs = std::chrono::system_clock::time_point{std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch())};
+
+    CompactParticipantStatus in;
+    CompactParticipantStatus out{};
+
+    in.state = ParticipantState::ReadyToRun;
+    in.enterReason = "ready";
+    in.enterTime = nowUs;
+
+    Serialize(buffer , in);
+    Deserialize(buffer,out);
+
+    EXPECT_EQ(in.state, out.state);
+    EXPECT_EQ(in.enterReason, out.enterReason);
+    EXPECT_EQ(in.enterTime, out.enterTime);
+}
+
 } // anonymous namespace
 
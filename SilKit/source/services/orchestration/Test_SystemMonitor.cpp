@@ -771,4 +771,125 @@ TEST_F(Test_SystemMonitor, add_and_remove_system_state_and_participant_status_ha
     EXPECT_EQ(monitor.InvalidTransitionCount(), 0u);
 }
 
+TEST_F(Test_SystemMonitor, ignore_participants_that_are_not_required)
+{
+    ParticipantStatus status;
+    status.participantName = "NotRequired";
+    status.state = ParticipantState::ServicesCreated;
+    monitor.ReceiveMsg(&monitorFrom, status);
+    status.state = ParticipantState::CommunicationInitializing;
+    monitor.ReceiveMsg(&monitorFrom, status);
+
+    EXPECT_EQ(monitor.SystemState(), SystemState::Invalid);
+
+    SetAllParticipantStates(ParticipantState::ServicesCreated);
+    EXPECT_EQ(monitor.SystemState(), SystemState::ServicesCreated);
+
+    SetParticipantStatus(1, ParticipantState::CommunicationInitializing);
+    SetParticipantStatus(2, ParticipantState::CommunicationInitializing);
+    EXPECT_EQ(monitor.SystemState(), SystemState::ServicesCreated);
+    SetParticipantStatus(3, ParticipantState::CommunicationInitializing);
+    EXPECT_EQ(monitor.SystemState(), SystemState::CommunicationInitializing);
+}
+
+TEST_F(Test_SystemMonitor, update_required_participants_after_receiving_their_status)
+{
+    SystemMonitor lateMonitor{&participant};
+
+    for (auto&& name : syncParticipantNames)
+    {
+        ParticipantStatus status;
+        status.participantName = name;
+        status.state = ParticipantState::ServicesCreated;
+        lateMonitor.ReceiveMsg(&monitorFrom, status);
+    }
+    EXPECT_EQ(lateMonitor.SystemState(), SystemState::Invalid);
+
+    lateMonitor.UpdateRequiredParticipantNames(syncParticipantNames);
+    EXPECT_EQ(lateMonitor.SystemState(), SystemState::ServicesCreated);
+}
+
+TEST_F(Test_SystemMonitor, disconnected_required_participant_blocks_the_system_state)
+{
+    SetAllParticipantStates(ParticipantState::ServicesCreated);
+    ASSERT_EQ(monitor.SystemState(), SystemState::ServicesCreated);
+
+    // the status of a participant which shut down is removed when it disconnects
+    SetParticipantStatus(3, ParticipantState::Shutdown);
+    monitor.OnParticipantDisconnected(ParticipantConnectionInformation{"P3"});
+
+    SetParticipantStatus(1, ParticipantState::CommunicationInitializing);
+    SetParticipantStatus(2, ParticipantState::CommunicationInitializing);
+    EXPECT_EQ(monitor.SystemState(), SystemState::ServicesCreated);
+}
+
+TEST_F(Test_SystemMonitor, compact_status_keeps_the_reason_and_enter_time_of_each_state)
+{
+    SetParticipantStatus(2, ParticipantState::ServicesCreated);
+    SetParticipantStatus(3, ParticipantState::ServicesCreated);
+
+    const auto startTime = std::chrono::system_clock::now();
+
+    AddParticipantStatusHandler();
+    {
+        InSequence seq;
+        EXPECT_CALL(callbacks,
+                    ParticipantStatusHandler(AllOf(
+                        Field(&ParticipantStatus::state, ParticipantState::ServicesCreated),
+                        Field(&ParticipantStatus::enterReason, "created"),
+                        Field(&ParticipantStatus::enterTime, startTime))))
+            .Times(1);
+        EXPECT_CALL(callbacks,
+                    ParticipantStatusHandler(AllOf(
+                        Field(&ParticipantStatus::state, ParticipantState::CommunicationInitializing),
+                        Field(&ParticipantStatus::enterReason, "initializing"),
+                        Field(&ParticipantStatus::enterTime, startTime + 1ms))))
+            .Times(1);
+    }
+
+    // the participant is identified by the sender of the compactStatus
+    monitorFrom.SetServiceDescriptor(ServiceDescriptor{"P1", "N1", "C2", 1024});
+    CompactParticipantStatus compactStatus;
+    compactStatus.state = ParticipantState::ServicesCreated;
+    compactStatus.enterReason = "created";
+    compactStatus.enterTime = startTime;
+    monitor.ReceiveMsg(&monitorFrom, compactStatus);
+    compactStatus.state = ParticipantState::CommunicationInitializing;
+    compactStatus.enterReason = "initializing";
+    compactStatus.enterTime = startTime + 1ms;
+    monitor.ReceiveMsg(&monitorFrom, compactStatus);
+
+    EXPECT_EQ(monitor.ParticipantStatus("P1").state, ParticipantState::CommunicationInitializing);
+    EXPECT_EQ(monitor.SystemState(), SystemState::ServicesCreated);
+    EXPECT_EQ(monitor.InvalidTransitionCount(), 0u);
+}
+
+TEST_F(Test_SystemMonitor, compact_status_ignores_a_state_known_from_the_full_status)
+{
+    const auto startTime = std::chrono::system_clock::now();
+
+    ParticipantStatus status;
+    status.participantName = "P1";
+    status.state = ParticipantState::ServicesCreated;
+    status.enterTime = startTime;
+    monitorFrom.SetServiceDescriptor(ServiceDescriptor{"P1", "N1", "C2", 1024});
+    monitor.ReceiveMsg(&monitorFrom, status);
+
+    AddParticipantStatusHandler();
+    EXPECT_CALL(callbacks, ParticipantStatusHandler(_)).Times(0);
+
+    // e.g., the same state received as full status and as compactStatus from the history
+    CompactParticipantStatus compactStatus;
+    compactStatus.state = ParticipantState::ServicesCreated;
+    compactStatus.enterTime = startTime;
+    monitor.ReceiveMsg(&monitorFrom, compactStatus);
+
+    // an outdated compactStatus does not revert a newer state
+    compactStatus.state = ParticipantState::Running;
+    compactStatus.enterTime = startTime - 1ms;
+    monitor.ReceiveMsg(&monitorFrom, compactStatus);
+
+    EXPECT_EQ(monitor.ParticipantStatus("P1").state, ParticipantState::ServicesCreated);
+}
+
 } // anonymous namespace
@@ -0,0 +1,261 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "MockParticipant.hpp"
+#include "TimeConfiguration.hpp"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+using namespace testing;
+
+using namespace SilKit::Services::Orchestration;
+using SilKit::Core::Tests::MockLogger;
+
+auto MakeTask(std::chrono::nanoseconds timePoint) -> NextSimTask
+{
+    NextSimTask task;
+    task.timePoint = timePoint;
+    task.duration = 1ms;
+    return task;
+}
+
+TEST(Test_TimeConfiguration, other_next_sim_tasks_yield_the_earliest_task)
+{
+    OtherNextSimTasks tasks;
+    EXPECT_EQ(tasks.Earliest(), nullptr);
+
+    EXPECT_TRUE(tasks.Add("P1", MakeTask(3ms)));
+    EXPECT_TRUE(tasks.Add("P2", MakeTask(1ms)));
+    EXPECT_TRUE(tasks.Add("P3", MakeTask(2ms)));
+    EXPECT_FALSE(tasks.Add("P2", MakeTask(0ms)));
+    EXPECT_EQ(tasks.Size(), 3u);
+    EXPECT_EQ(tasks.Earliest()->participantName, "P2");
+
+    tasks.Update(tasks.Find("P2"), MakeTask(4ms));
+    EXPECT_EQ(tasks.Earliest()->participantName, "P3");
+
+    tasks.Update(tasks.Find("P1"), MakeTask(0ms));
+    EXPECT_EQ(tasks.Earliest()->participantName, "P1");
+
+    EXPECT_TRUE(tasks.Remove("P1"));
+    EXPECT_FALSE(tasks.Remove("P1"));
+    EXPECT_EQ(tasks.Find("P1"), OtherNextSimTasks::npos);
+    EXPECT_EQ(tasks.Earliest()->participantName, "P3");
+
+    // the index of a removed participant is reused
+    EXPECT_TRUE(tasks.Add("P4", MakeTask(1ms)));
+    EXPECT_EQ(tasks.Earliest()->participantName, "P4");
+    EXPECT_EQ(tasks.Size(), 3u);
+}
+
+TEST(Test_TimeConfiguration, other_next_sim_tasks_match_a_linear_search)
+{
+    std::mt19937 random{42};
+    std::uniform_int_distribution<int> participantDistribution{0, 15};
+    std::uniform_int_distribution<int> actionDistribution{0, 9};
+    std::uniform_int_distribution<int> timeDistribution{0, 1000};
+
+    OtherNextSimTasks tasks;
+    std::map<std::string, std::chrono::nanoseconds> expected;
+
+    for (int iteration = 0; iteration < 10000; ++iteration)
+    {
+        const auto name = "P" + std::to_string(participantDistribution(random));
+        const auto timePoint = std::chrono::nanoseconds{timeDistribution(random)};
+        const auto action = actionDistribution(random);
+
+        if (action == 0)
+        {
+            EXPECT_EQ(tasks.Remove(name), expected.erase(name) == 1);
+        }
+        else if (expected.count(name) == 0)
+        {
+            EXPECT_TRUE(tasks.Add(name, MakeTask(timePoint)));
+            expected[name] = timePoint;
+        }
+        else
+        {
+            tasks.Update(tasks.Find(name), MakeTask(timePoint));
+            expected[name] = timePoint;
+        }
+
+        ASSERT_EQ(tasks.Size(), expected.size());
+        if (expected.empty())
+        {
+            ASSERT_EQ(tasks.Earliest(), nullptr);
+            continue;
+        }
+
+        auto minimum = std::min_element(expected.begin(), expected.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.second < rhs.second;
+        });
+        ASSERT_NE(tasks.Earliest(), nullptr);
+        ASSERT_EQ(tasks.Earliest()->task.timePoint, minimum->second);
+        ASSERT_EQ(expected.at(tasks.Earliest()->participantName), minimum->second);
+    }
+}
+
+TEST(Test_TimeConfiguration, time_advance_waits_for_the_slowest_participant)
+{
+    NiceMock<MockLogger> logger;
+    TimeConfiguration configuration{&logger};
+    configuration.SetStepDuration(1ms);
+
+    configuration.AddSynchronizedParticipant("P1");
+    configuration.AddSynchronizedParticipant("P2");
+    // not yet received the initial NextSimTask
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("P1", MakeTask(0ms));
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+    configuration.OnReceiveNextSimStep("P2", MakeTask(0ms));
+    EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.AdvanceTimeStep();
+    EXPECT_EQ(configuration.NextSimStep().timePoint, 1ms);
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("P2", MakeTask(5ms));
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    // hop-off of the slowest participant
+    EXPECT_TRUE(configuration.RemoveSynchronizedParticipant("P1"));
+    EXPECT_FALSE(configuration.RemoveSynchronizedParticipant("P1"));
+    EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+    EXPECT_EQ(configuration.GetSynchronizedParticipantNames(), std::vector<std::string>{"P2"});
+}
+
+TEST(Test_TimeConfiguration, synchronized_participant_names_are_sorted)
+{
+    NiceMock<MockLogger> logger;
+    TimeConfiguration configuration{&logger};
+    configuration.SetStepDuration(1ms);
+
+    for (const auto* name : {"P3", "P1", "P4", "P2"})
+    {
+        configuration.AddSynchronizedParticipant(name);
+    }
+    configuration.OnReceiveNextSimStep("P4", MakeTask(0ms));
+    configuration.OnReceiveNextSimStep("P2", MakeTask(5ms));
+
+    EXPECT_EQ(configuration.GetSynchronizedParticipantNames(), (std::vector<std::string>{"P1", "P2", "P3", "P4"}));
+}
+
+TEST(Test_TimeConfiguration, lookahead_lets_participants_advance_in_parallel)
+{
+    NiceMock<MockLogger> logger;
+    TimeConfiguration configuration{&logger};
+    configuration.SetStepDuration(1ms);
+
+    configuration.AddSynchronizedParticipant("Slow", 5ms);
+    // the lookahead does not apply before the first NextSimTask, which keeps the hop-on detection intact
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("Slow", MakeTask(0ms));
+    for (auto step = 0; step <= 5; ++step)
+    {
+        EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+        configuration.AdvanceTimeStep();
+    }
+
+    // our next timepoint is 6ms, which is beyond the time bound of 0ms + 5ms
+    EXPECT_EQ(configuration.NextSimStep().timePoint, 6ms);
+    EXPECT_TRUE(configuration.OtherParticipantHasLowerTimepoint());
+
+    configuration.OnReceiveNextSimStep("Slow", MakeTask(10ms));
+    EXPECT_FALSE(configuration.OtherParticipantHasLowerTimepoint());
+}
+
+TEST(Test_TimeConfiguration, next_event_time_announces_the_skipped_interval)
+{
+    NiceMock<MockLogger> logger;
+    TimeConfiguration configuration{&logger};
+    configuration.SetStepDuration(1ms);
+
+    configuration.AdvanceTimeStep();
+    configuration.SetNextEventTime(10ms);
+    EXPECT_EQ(configuration.NextSimStep().timePoint, 10ms);
+    // a single executed step, which must not be mistaken for a hop-on
+    EXPECT_EQ(configuration.NextSimStep().duration, 10ms);
+
+    // waking up before the end of the current step
+    configuration.SetNextEventTime(0ms);
+    EXPECT_EQ(configuration.NextSimStep().timePoint, 1ms);
+    EXPECT_EQ(configuration.NextSimStep().duration, 1ms);
+}
+
+TEST(Test_TimeConfiguration, announced_next_event_time_only_moves_later)
+{
+    NiceMock<MockLogger> logger;
+    TimeConfiguration configuration{&logger};
+    configuration.SetStepDuration(1ms);
+
+    configuration.AdvanceTimeStep();
+    configuration.SetNextEventTime(10ms);
+
+    // between the steps, the announced step is postponed
+    EXPECT_TRUE(configuration.PostponeNextEventTime(12ms));
+    EXPECT_EQ(configuration.NextSimStep().timePoint, 12ms);
+
+    // but an earlier wake-up is kept until the announced step
+    EXPECT_FALSE(configuration.PostponeNextEventTime(2ms));
+    EXPECT_EQ(configuration.NextSimStep().timePoint, 12ms);
+    EXPECT_FALSE(configuration.PostponeNextEventTime(20ms));
+    EXPECT_EQ(configuration.NextSimStep().timePoint, 12ms);
+
+    // the announced step does not skip the steps after it
+    configuration.AdvanceTimeStep();
+    configuration.SetNextEventTime(20ms);
+    EXPECT_EQ(configuration.NextSimStep().timePoint, 13ms);
+
+    // the wake-up was served
+    configuration.AdvanceTimeStep();
+    configuration.SetNextEventTime(20ms);
+    EXPECT_EQ(configuration.NextSimStep().timePoint, 20ms);
+}
+
+TEST(Test_TimeConfiguration, lower_next_sim_task_is_a_chronology_error)
+{
+    NiceMock<MockLogger> logger;
+    TimeConfiguration configuration{&logger};
+
+    configuration.AddSynchronizedParticipant("P1");
+    configuration.OnReceiveNextSimStep("P1", {10ms, 9ms});
+
+    EXPECT_CALL(logger, Log(_, _)).Times(AnyNumber());
+    EXPECT_CALL(logger, Log(SilKit::Services::Logging::Level::Error, _)).Times(1);
+    configuration.OnReceiveNextSimStep("P1", {2ms, 1ms});
+}
+
+} // namespace
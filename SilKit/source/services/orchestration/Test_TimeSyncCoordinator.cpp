@@ -0,0 +1,208 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+
+#include <chrono>
+#include <map>
+#include <random>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "TimeSyncCoordinator.hpp"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+using namespace SilKit::Services::Orchestration;
+
+auto MakeTask(std::chrono::nanoseconds timePoint) -> NextSimTask
+{
+    NextSimTask task;
+    task.timePoint = timePoint;
+    task.duration = 1ms;
+    return task;
+}
+
+struct Test_TimeSyncCoordinator : testing::Test
+{
+    std::map<std::string, NextSimTask> grants;
+    size_t grantCount{0};
+
+    TimeSyncCoordinator coordinator{[this](const std::string& participantName, const NextSimTask& grant) {
+        grants[participantName] = grant;
+        grantCount += 1;
+    }};
+
+    auto Granted(const std::string& participantName) -> std::chrono::nanoseconds
+    {
+        return grants.at(participantName).timePoint;
+    }
+};
+
+TEST_F(Test_TimeSyncCoordinator, grants_the_lowest_time_of_the_other_participants)
+{
+    coordinator.AddParticipant("P1");
+    coordinator.AddParticipant("P2");
+    coordinator.AddParticipant("P3");
+    EXPECT_EQ(Granted("P1"), -1ns);
+    EXPECT_EQ(Granted("P2"), -1ns);
+    EXPECT_EQ(Granted("P3"), -1ns);
+
+    coordinator.OnReceiveNextSimTask("P1", MakeTask(0ms));
+    coordinator.OnReceiveNextSimTask("P2", MakeTask(0ms));
+    EXPECT_EQ(Granted("P1"), -1ns);
+    EXPECT_EQ(Granted("P2"), -1ns);
+    EXPECT_EQ(Granted("P3"), 0ms);
+
+    coordinator.OnReceiveNextSimTask("P3", MakeTask(0ms));
+    EXPECT_EQ(Granted("P1"), 0ms);
+    EXPECT_EQ(Granted("P2"), 0ms);
+    EXPECT_EQ(Granted("P3"), 0ms);
+
+    coordinator.OnReceiveNextSimTask("P1", MakeTask(1ms));
+    coordinator.OnReceiveNextSimTask("P2", MakeTask(2ms));
+    EXPECT_EQ(Granted("P1"), 0ms);
+    EXPECT_EQ(Granted("P2"), 0ms);
+    EXPECT_EQ(Granted("P3"), 1ms);
+}
+
+TEST_F(Test_TimeSyncCoordinator, sends_one_grant_per_participant_and_step)
+{
+    const size_t participantCount{20};
+    for (size_t index = 0; index != participantCount; ++index)
+    {
+        coordinator.AddParticipant("P" + std::to_string(index));
+    }
+    for (size_t index = 0; index != participantCount; ++index)
+    {
+        coordinator.OnReceiveNextSimTask("P" + std::to_string(index), MakeTask(0ms));
+    }
+
+    for (auto step = 1ms; step <= 10ms; step += 1ms)
+    {
+        grantCount = 0;
+        for (size_t index = 0; index != participantCount; ++index)
+        {
+            coordinator.OnReceiveNextSimTask("P" + std::to_string(index), MakeTask(step));
+        }
+        EXPECT_EQ(grantCount, participantCount);
+        for (const auto& grant : grants)
+        {
+            EXPECT_EQ(grant.second.timePoint, step);
+        }
+    }
+}
+
+TEST_F(Test_TimeSyncCoordinator, answers_the_first_report_of_a_participant)
+{
+    coordinator.AddParticipant("P1");
+    coordinator.AddParticipant("P2");
+    coordinator.OnReceiveNextSimTask("P1", MakeTask(0ms));
+
+    grants.clear();
+    coordinator.OnReceiveNextSimTask("P2", MakeTask(5ms));
+    EXPECT_EQ(Granted("P2"), 0ms);
+
+    grants.clear();
+    coordinator.OnReceiveNextSimTask("P2", MakeTask(6ms));
+    EXPECT_EQ(grants.count("P2"), 0u);
+}
+
+TEST_F(Test_TimeSyncCoordinator, includes_the_lookahead_in_the_grants)
+{
+    coordinator.AddParticipant("P1", 2ms);
+    coordinator.AddParticipant("P2");
+    coordinator.OnReceiveNextSimTask("P1", MakeTask(1ms));
+    coordinator.OnReceiveNextSimTask("P2", MakeTask(1ms));
+
+    EXPECT_EQ(Granted("P1"), 1ms);
+    EXPECT_EQ(Granted("P2"), 3ms);
+    // the start of the last step is kept for the hop-on detection
+    EXPECT_EQ(grants.at("P2").duration, 3ms);
+}
+
+TEST_F(Test_TimeSyncCoordinator, joining_and_leaving_participants_change_the_grants)
+{
+    coordinator.AddParticipant("P1");
+    coordinator.AddParticipant("P2");
+    coordinator.OnReceiveNextSimTask("P1", MakeTask(4ms));
+    coordinator.OnReceiveNextSimTask("P2", MakeTask(5ms));
+    EXPECT_EQ(Granted("P1"), 5ms);
+    EXPECT_EQ(Granted("P2"), 4ms);
+
+    // the joining participant holds back the others until it reports
+    coordinator.AddParticipant("P3");
+    EXPECT_EQ(Granted("P1"), -1ns);
+    EXPECT_EQ(Granted("P2"), -1ns);
+    EXPECT_EQ(Granted("P3"), 4ms);
+
+    coordinator.RemoveParticipant("P3");
+    EXPECT_EQ(Granted("P1"), 5ms);
+    EXPECT_EQ(Granted("P2"), 4ms);
+
+    // a single participant is not granted anything
+    coordinator.RemoveParticipant("P1");
+    grants.clear();
+    coordinator.OnReceiveNextSimTask("P2", MakeTask(6ms));
+    EXPECT_TRUE(grants.empty());
+}
+
+TEST_F(Test_TimeSyncCoordinator, grants_match_the_full_mesh_for_random_updates)
+{
+    const size_t participantCount{8};
+    std::map<std::string, std::chrono::nanoseconds> timePoints;
+    for (size_t index = 0; index != participantCount; ++index)
+    {
+        const auto participantName = "P" + std::to_string(index);
+        coordinator.AddParticipant(participantName);
+        timePoints[participantName] = -1ns;
+    }
+
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<size_t> participantDistribution{0, participantCount - 1};
+    std::uniform_int_distribution<int> advanceDistribution{0, 3};
+
+    for (int round = 0; round != 1000; ++round)
+    {
+        const auto participantName = "P" + std::to_string(participantDistribution(generator));
+        auto& timePoint = timePoints[participantName];
+        timePoint = std::max(timePoint, 0ns) + std::chrono::milliseconds{advanceDistribution(generator)};
+        coordinator.OnReceiveNextSimTask(participantName, MakeTask(timePoint));
+
+        for (const auto& participant : timePoints)
+        {
+            auto expected = std::chrono::nanoseconds::max();
+            for (const auto& other : timePoints)
+            {
+                if (other.first != participant.first)
+                {
+                    expected = std::min(expected, other.second);
+                }
+            }
+            ASSERT_EQ(Granted(participant.first), expected);
+        }
+    }
+}
+
+} // namespace
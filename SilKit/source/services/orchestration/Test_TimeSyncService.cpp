@@ -22,6 +22,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <chrono>
 #include <functional>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -32,6 +34,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "MockParticipant.hpp"
 #include "MockServiceEndpoint.hpp"
 #include "ParticipantConfiguration.hpp"
+#include "ServiceConfigKeys.hpp"
 #include "SyncDatatypeUtils.hpp"
 #include "TimeSyncService.hpp"
 #include "LifecycleService.hpp"
@@ -168,4 +171,198 @@ TEST_F(Test_TimeSyncService, async_simtask_mismatching_number_of_complete_calls)
         << "Calling too many CompleteSimulationStep() should not wreak havoc"; 
 }
 
+TEST_F(Test_TimeSyncService, async_simtask_pipelined_runs_ahead_of_completion)
+{
+    Config::TimeSynchronization timeSyncConfig;
+    timeSyncConfig.asyncPipelineDepth = 1;
+    timeSyncService = std::make_unique<TimeSyncService>(&participant, &timeProvider, healthCheckConfig,
+                                                        lifecycleService.get(), timeSyncConfig);
+    lifecycleService->SetTimeSyncService(timeSyncService.get());
+
+    std::vector<std::chrono::nanoseconds> stepTimes;
+    timeSyncService->SetSimulationStepHandlerAsync(
+        [&](auto now, auto) {
+            stepTimes.push_back(now);
+        },
+        1ms);
+
+    PrepareLifecycle();
+
+    // the next step is announced when the handler returns, and may execute before the previous step is completed
+    timeSyncService->ReceiveMsg(&endpoint, {0ms});
+    timeSyncService->ReceiveMsg(&endpoint, {1ms});
+    EXPECT_EQ(stepTimes, (std::vector<std::chrono::nanoseconds>{0ms, 1ms}));
+
+    // the pipeline is full until a step is completed
+    timeSyncService->ReceiveMsg(&endpoint, {2ms});
+    EXPECT_EQ(stepTimes, (std::vector<std::chrono::nanoseconds>{0ms, 1ms}));
+
+    timeSyncService->CompleteSimulationStep();
+    EXPECT_EQ(stepTimes, (std::vector<std::chrono::nanoseconds>{0ms, 1ms, 2ms}));
+
+    timeSyncService->CompleteSimulationStep();
+    timeSyncService->CompleteSimulationStep();
+    timeSyncService->ReceiveMsg(&endpoint, {3ms});
+    timeSyncService->ReceiveMsg(&endpoint, {4ms});
+    EXPECT_EQ(stepTimes, (std::vector<std::chrono::nanoseconds>{0ms, 1ms, 2ms, 3ms, 4ms}));
+}
+
+TEST_F(Test_TimeSyncService, next_event_time_skips_idle_steps)
+{
+    std::vector<std::chrono::nanoseconds> stepTimes;
+    timeSyncService->SetSimulationStepHandler(
+        [&](auto now, auto) {
+            stepTimes.push_back(now);
+            if (now == 0ms)
+            {
+                timeSyncService->SetNextEventTime(5ms);
+            }
+        },
+        1ms);
+
+    PrepareLifecycle();
+
+    for (auto otherTime = 0ms; otherTime <= 6ms; otherTime += 1ms)
+    {
+        timeSyncService->ReceiveMsg(&endpoint, {otherTime, 1ms});
+    }
+
+    EXPECT_EQ(stepTimes, (std::vector<std::chrono::nanoseconds>{0ms, 5ms, 6ms}));
+}
+
+TEST_F(Test_TimeSyncService, next_event_time_between_steps_does_not_wake_up_the_participant_early)
+{
+    std::vector<std::chrono::nanoseconds> stepTimes;
+    timeSyncService->SetSimulationStepHandler(
+        [&](auto now, auto) {
+            stepTimes.push_back(now);
+            timeSyncService->SetNextEventTime(now + 10ms);
+        },
+        1ms);
+
+    PrepareLifecycle();
+
+    timeSyncService->ReceiveMsg(&endpoint, {0ms, 1ms});
+    timeSyncService->ReceiveMsg(&endpoint, {2ms, 1ms});
+
+    // e.g., from a message handler: the step at 10ms was already announced
+    timeSyncService->SetNextEventTime(0ms);
+    EXPECT_EQ(timeSyncService->GetTimeConfiguration()->NextSimStep().timePoint, 10ms);
+
+    for (auto otherTime = 3ms; otherTime <= 12ms; otherTime += 1ms)
+    {
+        timeSyncService->ReceiveMsg(&endpoint, {otherTime, 1ms});
+    }
+
+    // the step after the announced one is not skipped
+    EXPECT_EQ(stepTimes, (std::vector<std::chrono::nanoseconds>{0ms, 10ms, 11ms}));
+}
+
+TEST_F(Test_TimeSyncService, next_event_time_between_steps_postpones_the_announced_step)
+{
+    std::vector<std::chrono::nanoseconds> stepTimes;
+    timeSyncService->SetSimulationStepHandler(
+        [&](auto now, auto) {
+            stepTimes.push_back(now);
+            if (now == 0ms)
+            {
+                timeSyncService->SetNextEventTime(5ms);
+            }
+        },
+        1ms);
+
+    PrepareLifecycle();
+
+    timeSyncService->ReceiveMsg(&endpoint, {0ms, 1ms});
+    timeSyncService->SetNextEventTime(8ms);
+    EXPECT_EQ(timeSyncService->GetTimeConfiguration()->NextSimStep().timePoint, 8ms);
+
+    for (auto otherTime = 1ms; otherTime <= 8ms; otherTime += 1ms)
+    {
+        timeSyncService->ReceiveMsg(&endpoint, {otherTime, 1ms});
+    }
+
+    EXPECT_EQ(stepTimes, (std::vector<std::chrono::nanoseconds>{0ms, 8ms}));
+}
+
+TEST_F(Test_TimeSyncService, real_time_pacing_waits_for_the_deadline_with_a_timer)
+{
+    Config::TimeSynchronization timeSyncConfig;
+    timeSyncConfig.realTimeFactor = 1.0;
+    timeSyncService = std::make_unique<TimeSyncService>(&participant, &timeProvider, healthCheckConfig,
+                                                        lifecycleService.get(), timeSyncConfig);
+    lifecycleService->SetTimeSyncService(timeSyncService.get());
+
+    std::vector<std::chrono::nanoseconds> stepTimes;
+    timeSyncService->SetSimulationStepHandler(
+        [&](auto now, auto) {
+            stepTimes.push_back(now);
+        },
+        100ms);
+
+    PrepareLifecycle();
+
+    // the first step starts the real-time schedule
+    timeSyncService->ReceiveMsg(&endpoint, {0ms, 100ms});
+    timeSyncService->ReceiveMsg(&endpoint, {100ms, 100ms});
+
+    // the step at 100ms is not due yet, it is executed from a timer instead of blocking the receiving thread
+    EXPECT_EQ(stepTimes, (std::vector<std::chrono::nanoseconds>{0ms}));
+    ASSERT_EQ(participant.deferredAtCallbacks.size(), 1u);
+
+    timeSyncService->ReceiveMsg(&endpoint, {200ms, 100ms});
+    ASSERT_EQ(participant.deferredAtCallbacks.size(), 1u);
+
+    const auto deadline = participant.deferredAtCallbacks.front().first;
+    auto timerExpired = std::move(participant.deferredAtCallbacks.front().second);
+    participant.deferredAtCallbacks.clear();
+
+    std::this_thread::sleep_until(deadline);
+    timerExpired();
+    EXPECT_EQ(stepTimes, (std::vector<std::chrono::nanoseconds>{0ms, 100ms}));
+
+    const auto statistics = timeSyncService->GetRealTimePacer().GetStatistics();
+    EXPECT_EQ(statistics.steps, 2u);
+    EXPECT_EQ(statistics.overruns, 0u);
+}
+
+TEST_F(Test_TimeSyncService, coordinator_mode_holds_back_the_next_sim_task_until_the_coordinator_is_discovered)
+{
+    struct CoordinatorModeParticipant : DummyParticipant
+    {
+        MOCK_METHOD(void, SendMsg,
+                    (const IServiceEndpoint*, const std::string&, const Services::Orchestration::NextSimTask&),
+                    (override));
+    };
+
+    NiceMock<CoordinatorModeParticipant> coordinatorModeParticipant;
+    Core::Discovery::ServiceDiscoveryHandler discoveryHandler;
+    ON_CALL(coordinatorModeParticipant.mockServiceDiscovery, RegisterServiceDiscoveryHandler(_))
+        .WillByDefault(SaveArg<0>(&discoveryHandler));
+
+    LifecycleService coordinatorModeLifecycleService{&coordinatorModeParticipant};
+    coordinatorModeLifecycleService.SetLifecycleConfiguration(LifecycleConfiguration{OperationMode::Coordinated});
+    Config::TimeSynchronization timeSyncConfig;
+    timeSyncConfig.coordinator = "Coordinator";
+    TimeSyncService coordinatorModeTimeSyncService{&coordinatorModeParticipant, &timeProvider, healthCheckConfig,
+                                                   &coordinatorModeLifecycleService, timeSyncConfig};
+    ASSERT_TRUE(discoveryHandler);
+
+    // the targeted send would fail without a connection to the coordinator
+    EXPECT_CALL(coordinatorModeParticipant, SendMsg(_, "Coordinator", _)).Times(0);
+    coordinatorModeTimeSyncService.SendNextSimTask({0ms, 1ms});
+    Mock::VerifyAndClearExpectations(&coordinatorModeParticipant);
+
+    ServiceDescriptor coordinatorDescriptor{"Coordinator", "default", "TimeSyncService", 1};
+    coordinatorDescriptor.SetServiceType(ServiceType::InternalController);
+    coordinatorDescriptor.SetSupplementalDataItem(Core::Discovery::controllerType,
+                                                  Core::Discovery::controllerTypeTimeSyncService);
+    coordinatorDescriptor.SetSupplementalDataItem(Core::Discovery::timeSyncActive, "1");
+    coordinatorDescriptor.SetSupplementalDataItem(Core::Discovery::timeSyncCoordinator, "Coordinator");
+    discoveryHandler(Core::Discovery::ServiceDiscoveryEvent::Type::ServiceCreated, coordinatorDescriptor);
+
+    EXPECT_CALL(coordinatorModeParticipant, SendMsg(_, "Coordinator", _)).Times(1);
+    coordinatorModeTimeSyncService.SendNextSimTask({0ms, 1ms});
+}
+
 } // namespace
@@ -21,6 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include <chrono>
 #include <functional>
+#include <future>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -40,70 +41,15 @@ using namespace testing;
 using namespace SilKit;
 using namespace SilKit::Services::Orchestration;
 
-class LimitedMockClock : public WatchDog::IClock
+class ManualClock : public WatchDog::IClock
 {
 public:
-    explicit LimitedMockClock(std::chrono::nanoseconds limit, std::chrono::nanoseconds tick = 1ms)
-        : _limitRep{static_cast<std::chrono::nanoseconds>(limit).count()}
-        , _tick{tick}
-    {
-    }
-
     auto Now() const -> std::chrono::nanoseconds override
     {
-        _now += _tick;
-
-        // set the flag that the limit has been reached (but only _once_, otherwise an exception is thrown)
-        if (_now >= GetLimit())
-        {
-            if (!_limitReachedFlagged.exchange(true))
-            {
-                _limitReached.set_value();
-            }
-        }
-
-        return _now;
-    }
-
-    /// This function waits until either, the mock time has reached the current limit, or, the wall-clock timeout has
-    /// been reached.
-    ///
-    /// \param wallClockTimeout How long this function should wait for the limit to be reached
-    /// \return true if the limit was reached, false if the wall-clock timeout was reached
-    bool WaitUntilLimitReachedFor(std::chrono::nanoseconds wallClockTimeout)
-    {
-        const auto status = _limitReached.get_future().wait_for(wallClockTimeout);
-        return status == std::future_status::ready;
-    }
-
-    /// Advances the limit and resets the reached flag. Therefore WaitUntilLimitReachedFor can be called again
-    /// afterwards, even if the limit had been reached before.
-    ///
-    /// \param advance By how much the current limit should be advanced
-    void AdvanceLimitBy(std::chrono::nanoseconds advance)
-    {
-        _limitRep += static_cast<std::chrono::nanoseconds>(advance).count();
-
-        if (_limitReachedFlagged)
-        {
-            _limitReached = {};
-            _limitReachedFlagged = false;
-        }
+        return now;
     }
 
-private:
-    auto GetLimit() const -> std::chrono::nanoseconds { return std::chrono::nanoseconds{_limitRep}; }
-
-private:
-    std::atomic<std::chrono::nanoseconds::rep> _limitRep;
-    std::chrono::nanoseconds _tick;
-
-    // stores the current mock-time
-    mutable std::chrono::nanoseconds _now{};
-    // true if the promise has already been set
-    mutable std::atomic<bool> _limitReachedFlagged{false};
-    // will be set once (!) if _now is greater or equal to _limit
-    mutable std::promise<void> _limitReached{};
+    std::chrono::nanoseconds now{0};
 };
 
 class Test_WatchDog : public testing::Test
@@ -113,8 +59,6 @@ protected:
     {
         MOCK_METHOD1(WarnHandler, void(std::chrono::milliseconds));
         MOCK_METHOD1(ErrorHandler, void(std::chrono::milliseconds));
-
-        MOCK_METHOD(void, SequencePoint, ());
     };
 
 protected:
@@ -124,25 +68,31 @@ protected:
     // ----------------------------------------
     // Helper Methods
 
+    //! Advances the manual clock and processes the deadlines which have been reached
+    void AdvanceTo(std::chrono::nanoseconds now)
+    {
+        clock.now = now;
+        scheduler->ProcessDeadlines();
+    }
+
+    auto MakeWatchDog(const Config::HealthCheck& healthCheck) -> std::unique_ptr<WatchDog>
+    {
+        auto watchDog = std::make_unique<WatchDog>(healthCheck, scheduler);
+        watchDog->SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
+        watchDog->SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
+        return watchDog;
+    }
+
 protected:
     // ----------------------------------------
     // Members
     Callbacks callbacks;
+    ManualClock clock;
+    std::shared_ptr<WatchDogScheduler> scheduler{std::make_shared<WatchDogScheduler>(clock)};
 
     const std::chrono::milliseconds WAIT_EXPECT_READY = 10s;
-    const std::chrono::milliseconds WAIT_EXPECT_TIMEOUT = 50ms;
 };
 
-// ================================================================================
-// IMPORTANT: Set expectations (EXPECT_CALL) before the call to watchDog.Start()!
-// ================================================================================
-//
-// Note: The watchdog is running in a separate thread in the background and
-//       uses the wall clock for periodic checks. It is possible that
-//       scheduling might lead to test failures in rare cases. To make the
-//       tests entirely deterministic, this stepping must be refactored out
-//       of the watchdog into it's own interface as well.
-
 TEST_F(Test_WatchDog, throw_if_warn_timeout_is_zero)
 {
     EXPECT_THROW(WatchDog(Config::HealthCheck{0ms, 10ms}), SilKitError);
@@ -155,88 +105,99 @@ TEST_F(Test_WatchDog, throw_if_error_timeout_is_zero)
 
 TEST_F(Test_WatchDog, warn_after_timeout)
 {
-    LimitedMockClock mockClock{50ms, 2ms};
+    auto watchDog = MakeWatchDog(Config::HealthCheck{10ms, std::chrono::milliseconds::max()});
 
-    WatchDog watchDog{Config::HealthCheck{10ms, std::chrono::milliseconds::max()}, &mockClock};
-    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
+    watchDog->Start();
 
-    EXPECT_CALL(callbacks, WarnHandler(_)).Times(1);
-
-    watchDog.Start();
+    EXPECT_CALL(callbacks, WarnHandler(_)).Times(0);
+    AdvanceTo(9ms);
+    Mock::VerifyAndClearExpectations(&callbacks);
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    EXPECT_CALL(callbacks, WarnHandler(10ms)).Times(1);
+    AdvanceTo(10ms);
 }
 
 TEST_F(Test_WatchDog, error_after_timeout)
 {
-    LimitedMockClock mockClock{100ms, 5ms};
-
-    WatchDog watchDog{Config::HealthCheck{10ms, 50ms}, &mockClock};
-    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
+    auto watchDog = MakeWatchDog(Config::HealthCheck{10ms, 50ms});
 
-    EXPECT_CALL(callbacks, ErrorHandler(_)).Times(1);
-
-    watchDog.Start();
+    EXPECT_CALL(callbacks, WarnHandler(10ms)).Times(1);
+    EXPECT_CALL(callbacks, ErrorHandler(50ms)).Times(1);
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    watchDog->Start();
+    AdvanceTo(10ms);
+    AdvanceTo(49ms);
+    AdvanceTo(50ms);
 }
 
 TEST_F(Test_WatchDog, warn_only_once)
 {
-    LimitedMockClock mockClock{100ms, 10ms};
-
-    WatchDog watchDog{Config::HealthCheck{20ms, std::chrono::milliseconds::max()}, &mockClock};
-    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
-    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
+    auto watchDog = MakeWatchDog(Config::HealthCheck{20ms, std::chrono::milliseconds::max()});
 
     EXPECT_CALL(callbacks, WarnHandler(_)).Times(1);
     EXPECT_CALL(callbacks, ErrorHandler(_)).Times(0);
 
-    watchDog.Start();
-
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    watchDog->Start();
+    for (auto now = 10ms; now <= 100ms; now += 10ms)
+    {
+        AdvanceTo(now);
+    }
 }
 
 TEST_F(Test_WatchDog, error_only_once)
 {
-    LimitedMockClock mockClock{100ms, 10ms};
-
-    WatchDog watchDog{Config::HealthCheck{10ms, 50ms}, &mockClock};
-    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
+    auto watchDog = MakeWatchDog(Config::HealthCheck{10ms, 50ms});
 
+    EXPECT_CALL(callbacks, WarnHandler(_)).Times(1);
     EXPECT_CALL(callbacks, ErrorHandler(_)).Times(1);
 
-    watchDog.Start();
+    watchDog->Start();
+    for (auto now = 10ms; now <= 100ms; now += 10ms)
+    {
+        AdvanceTo(now);
+    }
+}
+
+TEST_F(Test_WatchDog, late_warning_is_skipped_after_the_error_timeout)
+{
+    auto watchDog = MakeWatchDog(Config::HealthCheck{10ms, 50ms});
+
+    EXPECT_CALL(callbacks, WarnHandler(_)).Times(0);
+    EXPECT_CALL(callbacks, ErrorHandler(60ms)).Times(1);
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    watchDog->Start();
+    AdvanceTo(60ms);
+    AdvanceTo(100ms);
 }
 
 TEST_F(Test_WatchDog, no_callback_if_reset_in_time)
 {
-    LimitedMockClock mockClock{1s, 100ms};
-
-    WatchDog watchDog{Config::HealthCheck{2000ms, 3000ms}, &mockClock};
-    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
-    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
+    auto watchDog = MakeWatchDog(Config::HealthCheck{2000ms, 3000ms});
 
     EXPECT_CALL(callbacks, WarnHandler(_)).Times(0);
     EXPECT_CALL(callbacks, ErrorHandler(_)).Times(0);
 
-    watchDog.Start();
-
-    // After being started, the watchdog will ask the clock for the current time periodically. This will advance the
-    // mock time each time and eventually the limit will be reached.
+    watchDog->Start();
+    AdvanceTo(1s);
+    watchDog->Reset();
+    AdvanceTo(5s);
+}
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
-    mockClock.AdvanceLimitBy(1s);
+TEST_F(Test_WatchDog, restart_measures_from_the_new_start)
+{
+    auto watchDog = MakeWatchDog(Config::HealthCheck{10ms, 20ms});
 
-    watchDog.Reset();
+    watchDog->Start();
+    AdvanceTo(5ms);
+    watchDog->Reset();
+    watchDog->Start();
 
-    // After being reset, the watchdog will not ask the clock for the current time anymore. Since the mock time only
-    // advances when the watchdog asks for it, the new limit will never be reached.
+    EXPECT_CALL(callbacks, WarnHandler(_)).Times(0);
+    AdvanceTo(14ms);
+    Mock::VerifyAndClearExpectations(&callbacks);
 
-    // The wall-clock timeout is deliberately chosen rather small since it should be reached.
-    ASSERT_FALSE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_TIMEOUT));
+    EXPECT_CALL(callbacks, WarnHandler(10ms)).Times(1);
+    AdvanceTo(15ms);
 }
 
 TEST_F(Test_WatchDog, create_health_check_unconfigured)
@@ -258,98 +219,94 @@ TEST_F(Test_WatchDog, create_health_check_unconfigured)
 
 TEST_F(Test_WatchDog, create_health_check_configured)
 {
-    LimitedMockClock mockClock{1000ms, 250ms};
-
-    WatchDog watchDog{Config::HealthCheck{2000ms, 3000ms}, &mockClock};
-    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
-    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
+    auto watchDog = MakeWatchDog(Config::HealthCheck{2000ms, 3000ms});
 
     EXPECT_CALL(callbacks, WarnHandler(_)).Times(0);
     EXPECT_CALL(callbacks, ErrorHandler(_)).Times(0);
 
-    watchDog.Start();
-
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
-
-    watchDog.Reset();
+    watchDog->Start();
+    AdvanceTo(1000ms);
+    watchDog->Reset();
 }
 
 TEST_F(Test_WatchDog, nothing_without_soft_and_hard)
 {
-    LimitedMockClock mockClock{200ms, 50ms};
-
-    WatchDog watchDog{Config::HealthCheck{{}, {}}, &mockClock};
-    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
-    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
+    auto watchDog = MakeWatchDog(Config::HealthCheck{{}, {}});
 
     EXPECT_CALL(callbacks, WarnHandler(_)).Times(0);
     EXPECT_CALL(callbacks, ErrorHandler(_)).Times(0);
 
-    watchDog.Start();
-
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    watchDog->Start();
+    AdvanceTo(std::chrono::hours{24});
 }
 
 TEST_F(Test_WatchDog, warn_with_soft_without_hard)
 {
-    LimitedMockClock mockClock{200ms, 50ms};
-
-    WatchDog watchDog{Config::HealthCheck{100ms, {}}, &mockClock};
-    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
-    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
+    auto watchDog = MakeWatchDog(Config::HealthCheck{100ms, {}});
 
     EXPECT_CALL(callbacks, WarnHandler(_)).Times(1);
     EXPECT_CALL(callbacks, ErrorHandler(_)).Times(0);
 
-    watchDog.Start();
-
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    watchDog->Start();
+    AdvanceTo(200ms);
+    AdvanceTo(std::chrono::hours{24});
 }
 
 TEST_F(Test_WatchDog, error_with_hard_without_soft)
 {
-    LimitedMockClock mockClock{200ms, 50ms};
-
-    WatchDog watchDog{Config::HealthCheck{{}, 100ms}, &mockClock};
-    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
-    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
+    auto watchDog = MakeWatchDog(Config::HealthCheck{{}, 100ms});
 
     EXPECT_CALL(callbacks, WarnHandler(_)).Times(0);
     EXPECT_CALL(callbacks, ErrorHandler(_)).Times(1);
 
-    watchDog.Start();
-
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+    watchDog->Start();
+    AdvanceTo(200ms);
 }
 
 TEST_F(Test_WatchDog, warn_and_error_with_soft_and_hard)
 {
-    LimitedMockClock mockClock{150ms, 10ms};
-
-    WatchDog watchDog{Config::HealthCheck{100ms, 200ms}, &mockClock};
-    watchDog.SetWarnHandler(Util::bind_method(&callbacks, &Callbacks::WarnHandler));
-    watchDog.SetErrorHandler(Util::bind_method(&callbacks, &Callbacks::ErrorHandler));
+    auto watchDog = MakeWatchDog(Config::HealthCheck{100ms, 200ms});
 
-    // NB: It is undefined behavior to interleave setting expectations and calling mock methods.
-
-    // The expectations on WarnHandler and ErrorHandler are partially ordered. The explicit call to SequencePoint
-    // separates two sets of expectations.
-    testing::Sequence warnSequence, errorSequence;
+    EXPECT_CALL(callbacks, WarnHandler(_)).Times(1);
+    EXPECT_CALL(callbacks, ErrorHandler(_)).Times(0);
 
-    EXPECT_CALL(callbacks, WarnHandler(_)).Times(1).InSequence(warnSequence);
-    EXPECT_CALL(callbacks, ErrorHandler(_)).Times(0).InSequence(errorSequence);
-    EXPECT_CALL(callbacks, SequencePoint()).Times(1).InSequence(warnSequence, errorSequence);
-    EXPECT_CALL(callbacks, WarnHandler(_)).Times(0).InSequence(warnSequence);
-    EXPECT_CALL(callbacks, ErrorHandler(_)).Times(1).InSequence(errorSequence);
+    watchDog->Start();
+    AdvanceTo(150ms);
+    Mock::VerifyAndClearExpectations(&callbacks);
 
-    watchDog.Start();
+    EXPECT_CALL(callbacks, WarnHandler(_)).Times(0);
+    EXPECT_CALL(callbacks, ErrorHandler(_)).Times(1);
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
-    callbacks.SequencePoint();
+    AdvanceTo(250ms);
+}
 
-    mockClock.AdvanceLimitBy(100ms);
+TEST_F(Test_WatchDog, shared_scheduler_thread_invokes_the_handlers)
+{
+    std::promise<void> warned;
+    std::promise<void> failed;
+
+    // separate watchdogs, a warning would be skipped if the thread is delayed beyond the error timeout
+    WatchDog warningWatchDog{Config::HealthCheck{1ms, {}}};
+    warningWatchDog.SetWarnHandler([&warned](std::chrono::milliseconds) {
+        warned.set_value();
+    });
+    WatchDog errorWatchDog{Config::HealthCheck{{}, 1ms}};
+    errorWatchDog.SetErrorHandler([&failed](std::chrono::milliseconds) {
+        failed.set_value();
+    });
+
+    warningWatchDog.Start();
+    errorWatchDog.Start();
+
+    ASSERT_EQ(warned.get_future().wait_for(WAIT_EXPECT_READY), std::future_status::ready);
+    ASSERT_EQ(failed.get_future().wait_for(WAIT_EXPECT_READY), std::future_status::ready);
+}
 
-    ASSERT_TRUE(mockClock.WaitUntilLimitReachedFor(WAIT_EXPECT_READY));
+TEST_F(Test_WatchDog, watchdogs_share_a_single_scheduler)
+{
+    auto first = WatchDogScheduler::GetShared();
+    auto second = WatchDogScheduler::GetShared();
+    EXPECT_EQ(first, second);
 }
 
 } // anonymous namespace
@@ -19,6 +19,8 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <algorithm>
+
 #include "TimeConfiguration.hpp"
 #include "ILogger.hpp"
 
@@ -26,6 +28,186 @@ namespace SilKit {
 namespace Services {
 namespace Orchestration {
 
+// OtherNextSimTasks
+
+constexpr size_t OtherNextSimTasks::npos;
+
+bool OtherNextSimTasks::Add(const std::string& participantName, NextSimTask task, std::chrono::nanoseconds lookahead)
+{
+    if (_indices.find(participantName) != _indices.end())
+    {
+        return false;
+    }
+
+    size_t index;
+    if (_freeIndices.empty())
+    {
+        index = _entries.size();
+        _entries.emplace_back();
+    }
+    else
+    {
+        index = _freeIndices.back();
+        _freeIndices.pop_back();
+    }
+
+    auto& entry = _entries[index];
+    entry.participantName = participantName;
+    entry.task = std::move(task);
+    entry.lookahead = lookahead;
+    entry.heapPosition = _heap.size();
+
+    _indices.emplace(participantName, index);
+    _heap.push_back(index);
+    SiftUp(entry.heapPosition);
+    return true;
+}
+
+bool OtherNextSimTasks::Remove(const std::string& participantName)
+{
+    auto it = _indices.find(participantName);
+    if (it == _indices.end())
+    {
+        return false;
+    }
+
+    const auto index = it->second;
+    const auto position = _entries[index].heapPosition;
+    const auto lastPosition = _heap.size() - 1;
+
+    if (position != lastPosition)
+    {
+        Swap(position, lastPosition);
+    }
+    _heap.pop_back();
+
+    if (position != lastPosition)
+    {
+        // the former last element may belong above or below the position of the removed one
+        const auto movedIndex = _heap[position];
+        SiftUp(position);
+        SiftDown(_entries[movedIndex].heapPosition);
+    }
+
+    _entries[index] = Entry{};
+    _freeIndices.push_back(index);
+    _indices.erase(it);
+    return true;
+}
+
+auto OtherNextSimTasks::Find(const std::string& participantName) const -> size_t
+{
+    auto it = _indices.find(participantName);
+    if (it == _indices.end())
+    {
+        return npos;
+    }
+    return it->second;
+}
+
+auto OtherNextSimTasks::Get(size_t index) const -> const Entry&
+{
+    return _entries.at(index);
+}
+
+void OtherNextSimTasks::Update(size_t index, NextSimTask task)
+{
+    auto& entry = _entries.at(index);
+    const auto previousTimeBound = entry.TimeBound();
+    entry.task = std::move(task);
+
+    if (entry.TimeBound() < previousTimeBound)
+    {
+        SiftUp(entry.heapPosition);
+    }
+    else
+    {
+        SiftDown(entry.heapPosition);
+    }
+}
+
+auto OtherNextSimTasks::Earliest() const -> const Entry*
+{
+    if (_heap.empty())
+    {
+        return nullptr;
+    }
+    return &_entries[_heap.front()];
+}
+
+auto OtherNextSimTasks::SecondEarliest() const -> const Entry*
+{
+    // the second lowest time bound is one of the children of the root
+    if (_heap.size() < 2)
+    {
+        return nullptr;
+    }
+    if (_heap.size() > 2 && Less(2, 1))
+    {
+        return &_entries[_heap[2]];
+    }
+    return &_entries[_heap[1]];
+}
+
+auto OtherNextSimTasks::Size() const -> size_t
+{
+    return _heap.size();
+}
+
+bool OtherNextSimTasks::Less(size_t lhsPosition, size_t rhsPosition) const
+{
+    return _entries[_heap[lhsPosition]].TimeBound() < _entries[_heap[rhsPosition]].TimeBound();
+}
+
+void OtherNextSimTasks::Swap(size_t lhsPosition, size_t rhsPosition)
+{
+    std::swap(_heap[lhsPosition], _heap[rhsPosition]);
+    _entries[_heap[lhsPosition]].heapPosition = lhsPosition;
+    _entries[_heap[rhsPosition]].heapPosition = rhsPosition;
+}
+
+void OtherNextSimTasks::SiftUp(size_t position)
+{
+    while (position > 0)
+    {
+        const auto parent = (position - 1) / 2;
+        if (!Less(position, parent))
+        {
+            break;
+        }
+        Swap(position, parent);
+        position = parent;
+    }
+}
+
+void OtherNextSimTasks::SiftDown(size_t position)
+{
+    const auto size = _heap.size();
+    while (true)
+    {
+        const auto left = 2 * position + 1;
+        const auto right = left + 1;
+
+        auto smallest = position;
+        if (left < size && Less(left, smallest))
+        {
+            smallest = left;
+        }
+        if (right < size && Less(right, smallest))
+        {
+            smallest = right;
+        }
+        if (smallest == position)
+        {
+            break;
+        }
+        Swap(position, smallest);
+        position = smallest;
+    }
+}
+
+// TimeConfiguration
+
 TimeConfiguration::TimeConfiguration(Logging::ILogger* logger) 
     : _blocking(false)
     , _logger(logger)
@@ -41,40 +223,34 @@ void TimeConfiguration::SetBlockingMode(bool blocking)
     _blocking = blocking;
 }
 
-void TimeConfiguration::AddSynchronizedParticipant(const std::string& otherParticipantName)
+void TimeConfiguration::AddSynchronizedParticipant(const std::string& otherParticipantName,
+                                                   std::chrono::nanoseconds lookahead)
 {
     Lock lock{_mx};
-    if (_otherNextTasks.find(otherParticipantName) != _otherNextTasks.end())
-    {
-        // ignore already known participants
-        return;
-    }
     NextSimTask task;
     task.timePoint = -1ns;
     task.duration = 0ns;
-    _otherNextTasks.emplace(otherParticipantName, task);
+    // already known participants are ignored
+    _otherNextTasks.Add(otherParticipantName, task, lookahead);
 }
 
 
 bool TimeConfiguration::RemoveSynchronizedParticipant(const std::string& otherParticipantName)
 {
     Lock lock{_mx};
-    auto it = _otherNextTasks.find(otherParticipantName);
-    if (it != _otherNextTasks.end())
-    {
-        _otherNextTasks.erase(it);
-        return true;
-    }
-    return false;
+    return _otherNextTasks.Remove(otherParticipantName);
 }
 
 auto TimeConfiguration::GetSynchronizedParticipantNames() -> std::vector<std::string>
 {
+    Lock lock{_mx};
     std::vector<std::string> participantNames;
-    for (auto const& it : _otherNextTasks)
-    {
-        participantNames.push_back(it.first);
-    }
+    participantNames.reserve(_otherNextTasks.Size());
+    _otherNextTasks.ForEach([&participantNames](const OtherNextSimTasks::Entry& entry) {
+        participantNames.push_back(entry.participantName);
+    });
+    // the heap order changes with the received tasks, the names are sorted like in the former map
+    std::sort(participantNames.begin(), participantNames.end());
     return participantNames;
 }
 
@@ -82,39 +258,51 @@ void TimeConfiguration::OnReceiveNextSimStep(const std::string& participantName,
 {
     Lock lock{_mx};
 
-    auto&& itOtherNextTask = _otherNextTasks.find(participantName);
-    if (itOtherNextTask == _otherNextTasks.end())
+    const auto index = _otherNextTasks.Find(participantName);
+    if (index == OtherNextSimTasks::npos)
     {
         Logging::Error(_logger, "Received NextSimTask from unknown participant {}", participantName);
         return;
     }
 
-    if (nextStep.timePoint < itOtherNextTask->second.timePoint)
+    const auto& otherNextTask = _otherNextTasks.Get(index).task;
+    if (nextStep.timePoint < otherNextTask.timePoint)
     {
         Logging::Error(_logger,
                        "Chonology error: Received NextSimTask from participant \'{}\' with lower timePoint {} than last "
                        "known timePoint {}",
-                       participantName, nextStep.timePoint.count(), itOtherNextTask->second.timePoint.count());
+                       participantName, nextStep.timePoint.count(), otherNextTask.timePoint.count());
     }
 
-    _otherNextTasks.at(participantName) = std::move(nextStep);
     Logging::Debug(_logger, "Updated _otherNextTasks for participant {} with time {}", participantName,
                    nextStep.timePoint.count());
+    _otherNextTasks.Update(index, std::move(nextStep));
+}
+
+void TimeConfiguration::OnReceiveTimeGrant(const std::string& coordinatorName, NextSimTask grant)
+{
+    Lock lock{_mx};
+
+    const auto index = _otherNextTasks.Find(coordinatorName);
+    if (index == OtherNextSimTasks::npos)
+    {
+        Logging::Error(_logger, "Received a time grant from participant {}, which is not the time sync coordinator",
+                       coordinatorName);
+        return;
+    }
+
+    Logging::Debug(_logger, "Time sync coordinator {} granted time {}", coordinatorName, grant.timePoint.count());
+    _otherNextTasks.Update(index, std::move(grant));
 }
 
 void TimeConfiguration::SynchronizedParticipantRemoved(const std::string& otherParticipantName)
 {
     Lock lock{_mx};
-    if (_otherNextTasks.find(otherParticipantName) != _otherNextTasks.end())
+    if (!_otherNextTasks.Remove(otherParticipantName))
     {
         const std::string errorMessage{"Participant " + otherParticipantName + " unknown."};
         throw SilKitError{errorMessage};
     }
-    auto it = _otherNextTasks.find(otherParticipantName);
-    if (it != _otherNextTasks.end())
-    {
-        _otherNextTasks.erase(it);
-    }
 }
 void TimeConfiguration::SetStepDuration(std::chrono::nanoseconds duration)
 {
@@ -125,6 +313,11 @@ void TimeConfiguration::SetStepDuration(std::chrono::nanoseconds duration)
 void TimeConfiguration::AdvanceTimeStep()
 {
     Lock lock{_mx};
+    // a pending wake-up is served by the step following its request
+    if (_pendingNextEventTime <= _currentTask.timePoint)
+    {
+        _pendingNextEventTime = std::chrono::nanoseconds::max();
+    }
     _currentTask = _myNextTask;
     _myNextTask.timePoint = _currentTask.timePoint + _currentTask.duration;
 }
@@ -138,21 +331,63 @@ auto TimeConfiguration::CurrentSimStep() const -> NextSimTask
 auto TimeConfiguration::NextSimStep() const -> NextSimTask
 {
     Lock lock{_mx};
-    return _myNextTask;
+    auto nextTask = _myNextTask;
+    // After skipping steps, the skipped interval is announced as the duration. The other participants use the duration
+    // to tell a hop-on from a participant which has only executed a single step.
+    const auto lastTimePoint = std::max(_currentTask.timePoint, 0ns);
+    if (nextTask.timePoint > lastTimePoint + nextTask.duration)
+    {
+        nextTask.duration = nextTask.timePoint - lastTimePoint;
+    }
+    return nextTask;
+}
+
+void TimeConfiguration::SetNextEventTime(std::chrono::nanoseconds nextEventTime)
+{
+    Lock lock{_mx};
+    // The next step must not start before the end of the current step
+    const auto earliestTimePoint = _currentTask.timePoint < 0ns ? 0ns : _currentTask.timePoint + _currentTask.duration;
+    _myNextTask.timePoint = std::max((std::min)(nextEventTime, _pendingNextEventTime), earliestTimePoint);
+    Logging::Debug(_logger, "Next simulation step is scheduled at {}ns", _myNextTask.timePoint.count());
+}
+
+bool TimeConfiguration::PostponeNextEventTime(std::chrono::nanoseconds nextEventTime)
+{
+    Lock lock{_mx};
+    // The other participants may already have advanced beyond an earlier time than the announced one. The earlier
+    // wake-up is kept until the next step is announced, i.e., until the announced step is executed.
+    if (nextEventTime < _myNextTask.timePoint)
+    {
+        const auto earliestTimePoint =
+            _currentTask.timePoint < 0ns ? 0ns : _currentTask.timePoint + _currentTask.duration;
+        _pendingNextEventTime = (std::min)(_pendingNextEventTime, std::max(nextEventTime, earliestTimePoint));
+        Logging::Debug(_logger, "Wake-up at {}ns is deferred to the announced simulation step at {}ns",
+                       nextEventTime.count(), _myNextTask.timePoint.count());
+        return false;
+    }
+
+    // the announced step serves the pending wake-up
+    if (nextEventTime == _myNextTask.timePoint || _pendingNextEventTime != std::chrono::nanoseconds::max())
+    {
+        return false;
+    }
+
+    _myNextTask.timePoint = nextEventTime;
+    Logging::Debug(_logger, "Next simulation step is postponed to {}ns", _myNextTask.timePoint.count());
+    return true;
 }
 
 bool TimeConfiguration::OtherParticipantHasLowerTimepoint() const
 {
     Lock lock{_mx};
 
-    for (const auto& otherTask : _otherNextTasks)
+    // With a lookahead, the other participant may lag behind our next timepoint by up to the lookahead
+    const auto* earliest = _otherNextTasks.Earliest();
+    if (earliest != nullptr && _myNextTask.timePoint > earliest->TimeBound())
     {
-        if (_myNextTask.timePoint > otherTask.second.timePoint)
-        {
-            Debug(_logger, "Not advancing because participant \'{}\' has lower timepoint {}", otherTask.first,
-                  otherTask.second.timePoint.count());
-            return true;
-        }
+        Debug(_logger, "Not advancing because participant \'{}\' has lower timepoint {} (lookahead {})",
+              earliest->participantName, earliest->task.timePoint.count(), earliest->lookahead.count());
+        return true;
     }
     return false;
 }
@@ -181,18 +416,17 @@ bool TimeConfiguration::HandleHopOn()
         if (_currentTask.timePoint == -1ns) // On initial time
         {
             std::chrono::nanoseconds minimalOtherTime = std::chrono::nanoseconds::max();
-            for (const auto& otherTask : _otherNextTasks)
-            {
+            _otherNextTasks.ForEach([this, &minimalOtherTime](const OtherNextSimTasks::Entry& entry) {
                 // Any other participant has already advanced further that its duration -> HopOn
-                if (otherTask.second.timePoint > otherTask.second.duration)
+                if (entry.task.timePoint > entry.task.duration)
                 {
                     _hoppedOn = true;
-                    if (otherTask.second.timePoint < minimalOtherTime)
+                    if (entry.task.timePoint < minimalOtherTime)
                     {
-                        minimalOtherTime = otherTask.second.timePoint;
+                        minimalOtherTime = entry.task.timePoint;
                     }
                 }
-            }
+            });
             if (_hoppedOn)
             {
                 _myNextTask.timePoint = minimalOtherTime;
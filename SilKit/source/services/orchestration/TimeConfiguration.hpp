@@ -19,10 +19,13 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#pragma once
+
 #include <string>
 #include <chrono>
-#include <map>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include "OrchestrationDatatypes.hpp"
 #include "silkit/services/logging/ILogger.hpp"
@@ -32,6 +35,69 @@ namespace Services {
 namespace Orchestration {
 
 using namespace std::chrono_literals;
+
+//! Next sim tasks of the other synchronized participants. The participant names are interned to indices, which are
+//! kept in a binary min-heap ordered by the time bound of the next sim task, i.e., its time point plus the lookahead
+//! of the participant. The earliest bound is available in O(1), adding, updating, and removing a participant takes
+//! O(log N).
+class OtherNextSimTasks
+{
+public:
+    static constexpr size_t npos{static_cast<size_t>(-1)};
+
+    struct Entry
+    {
+        std::string participantName;
+        NextSimTask task;
+        //! Minimum delay between receiving a message and sending a reaction, as announced by the participant
+        std::chrono::nanoseconds lookahead{0};
+        size_t heapPosition{npos};
+
+        //! Time point up to which the participant will not send any more messages. The lookahead only applies once
+        //! the participant has announced its first sim task, so the initial hop-on check is not bypassed.
+        auto TimeBound() const -> std::chrono::nanoseconds
+        {
+            return task.timePoint < 0ns ? task.timePoint : task.timePoint + lookahead;
+        }
+    };
+
+public:
+    //! Returns false if the participant is already known
+    bool Add(const std::string& participantName, NextSimTask task, std::chrono::nanoseconds lookahead = 0ns);
+    //! Returns false if the participant is unknown
+    bool Remove(const std::string& participantName);
+    //! Returns the index of the participant, or npos if it is unknown
+    auto Find(const std::string& participantName) const -> size_t;
+    auto Get(size_t index) const -> const Entry&;
+    void Update(size_t index, NextSimTask task);
+    //! Returns the entry with the lowest time bound, or nullptr if there are no other participants
+    auto Earliest() const -> const Entry*;
+    //! Returns the entry with the lowest time bound apart from the earliest one, or nullptr if there is none
+    auto SecondEarliest() const -> const Entry*;
+    auto Size() const -> size_t;
+
+    template <typename FunctionT>
+    void ForEach(FunctionT&& function) const
+    {
+        for (const auto index : _heap)
+        {
+            function(_entries[index]);
+        }
+    }
+
+private:
+    bool Less(size_t lhsPosition, size_t rhsPosition) const;
+    void Swap(size_t lhsPosition, size_t rhsPosition);
+    void SiftUp(size_t position);
+    void SiftDown(size_t position);
+
+private:
+    std::unordered_map<std::string, size_t> _indices;
+    std::vector<Entry> _entries;
+    std::vector<size_t> _freeIndices;
+    std::vector<size_t> _heap;
+};
+
 class TimeConfiguration
 {
 public: //Ctor
@@ -39,15 +105,24 @@ public: //Ctor
 
 public: //Methods
     void SetBlockingMode(bool blocking);
-    void AddSynchronizedParticipant(const std::string& otherParticipantName);
+    void AddSynchronizedParticipant(const std::string& otherParticipantName, std::chrono::nanoseconds lookahead = 0ns);
     bool RemoveSynchronizedParticipant(const std::string& otherParticipantName);
     auto GetSynchronizedParticipantNames() -> std::vector<std::string>;
     void OnReceiveNextSimStep(const std::string& participantName, NextSimTask nextStep);
+    //! Update the time bound granted by the time sync coordinator. In contrast to a NextSimTask, a grant may decrease,
+    //! e.g., when a participant joins the simulation.
+    void OnReceiveTimeGrant(const std::string& coordinatorName, NextSimTask grant);
     void SynchronizedParticipantRemoved(const std::string& otherParticipantName);
     void SetStepDuration(std::chrono::nanoseconds duration);
     void AdvanceTimeStep();
     auto CurrentSimStep() const -> NextSimTask;
     auto NextSimStep() const -> NextSimTask;
+    //! Schedule the next step at the given time, skipping the steps in between. Times before the end of the current
+    //! step schedule the next step at the end of the current step, and so does a pending wake-up.
+    void SetNextEventTime(std::chrono::nanoseconds nextEventTime);
+    //! Move the already announced next step to a later time. An earlier time is kept as a pending wake-up, which
+    //! applies when the next step is announced. Returns true if the announced step was moved.
+    bool PostponeNextEventTime(std::chrono::nanoseconds nextEventTime);
     bool OtherParticipantHasLowerTimepoint() const;
     void Initialize();
     bool IsBlocking() const;
@@ -62,7 +137,9 @@ private: //Members
     using Lock = std::unique_lock<decltype(_mx)>;
     NextSimTask _currentTask;
     NextSimTask _myNextTask;
-    std::map<std::string, NextSimTask> _otherNextTasks;
+    //! Earliest wake-up requested after the next step was announced
+    std::chrono::nanoseconds _pendingNextEventTime{std::chrono::nanoseconds::max()};
+    OtherNextSimTasks _otherNextTasks;
     bool _blocking;
 
     bool _hoppedOn = false;
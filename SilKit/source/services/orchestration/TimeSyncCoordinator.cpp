@@ -0,0 +1,194 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "TimeSyncCoordinator.hpp"
+
+namespace SilKit {
+namespace Services {
+namespace Orchestration {
+
+namespace {
+
+//! The grant is the time bound of the other participant. The start of its last step is kept, so the hop-on detection
+//! of the receiver still works.
+auto MakeGrant(const OtherNextSimTasks::Entry& entry) -> NextSimTask
+{
+    NextSimTask grant;
+    grant.timePoint = entry.TimeBound();
+    grant.duration = entry.task.duration + (grant.timePoint - entry.task.timePoint);
+    return grant;
+}
+
+} // namespace
+
+TimeSyncCoordinator::TimeSyncCoordinator(GrantHandler grantHandler)
+    : _grantHandler{std::move(grantHandler)}
+{
+}
+
+void TimeSyncCoordinator::AddParticipant(const std::string& participantName, std::chrono::nanoseconds lookahead)
+{
+    Grants grants;
+    {
+        Lock lock{_mx};
+
+        NextSimTask task;
+        task.timePoint = -1ns;
+        task.duration = 0ns;
+        if (!_nextTasks.Add(participantName, task, lookahead))
+        {
+            return;
+        }
+        _grantStates[participantName] = GrantState{};
+
+        UpdateGrants(grants);
+        UpdateGrant(_nextTasks.Get(_nextTasks.Find(participantName)), false, grants);
+    }
+    SendGrants(grants);
+}
+
+void TimeSyncCoordinator::RemoveParticipant(const std::string& participantName)
+{
+    Grants grants;
+    {
+        Lock lock{_mx};
+
+        if (!_nextTasks.Remove(participantName))
+        {
+            return;
+        }
+        _grantStates.erase(participantName);
+
+        UpdateGrants(grants);
+    }
+    SendGrants(grants);
+}
+
+void TimeSyncCoordinator::OnReceiveNextSimTask(const std::string& participantName, const NextSimTask& task)
+{
+    Grants grants;
+    {
+        Lock lock{_mx};
+
+        const auto index = _nextTasks.Find(participantName);
+        if (index == OtherNextSimTasks::npos)
+        {
+            return;
+        }
+        _nextTasks.Update(index, task);
+
+        UpdateGrants(grants);
+
+        // The first report of a participant is always answered, because a grant which was sent before the participant
+        // knew the coordinator may have been dropped
+        auto& grantState = _grantStates[participantName];
+        if (!grantState.reported)
+        {
+            grantState.reported = true;
+            UpdateGrant(_nextTasks.Get(index), true, grants);
+        }
+    }
+    SendGrants(grants);
+}
+
+void TimeSyncCoordinator::UpdateGrants(Grants& grants)
+{
+    const auto* earliest = _nextTasks.Earliest();
+    if (earliest == nullptr)
+    {
+        _earliestParticipantName.clear();
+        _earliestGrant = NextSimTask{};
+        return;
+    }
+
+    const auto earliestGrant = MakeGrant(*earliest);
+    if (earliestGrant.timePoint != _earliestGrant.timePoint || earliestGrant.duration != _earliestGrant.duration)
+    {
+        // The lowest time bound has changed, which is the grant of all but the earliest participant
+        _nextTasks.ForEach([this, &grants](const OtherNextSimTasks::Entry& entry) {
+            UpdateGrant(entry, false, grants);
+        });
+    }
+    else
+    {
+        // Only the grants of the earliest participant, and of the formerly earliest one, may have changed
+        UpdateGrant(*earliest, false, grants);
+        if (earliest->participantName != _earliestParticipantName)
+        {
+            const auto index = _nextTasks.Find(_earliestParticipantName);
+            if (index != OtherNextSimTasks::npos)
+            {
+                UpdateGrant(_nextTasks.Get(index), false, grants);
+            }
+        }
+    }
+
+    _earliestParticipantName = earliest->participantName;
+    _earliestGrant = earliestGrant;
+}
+
+void TimeSyncCoordinator::UpdateGrant(const OtherNextSimTasks::Entry& entry, bool force, Grants& grants)
+{
+    NextSimTask grant;
+    if (!ComputeGrant(entry, grant))
+    {
+        return;
+    }
+
+    auto& grantState = _grantStates[entry.participantName];
+    if (force || !grantState.granted || grantState.grant.timePoint != grant.timePoint
+        || grantState.grant.duration != grant.duration)
+    {
+        grantState.grant = grant;
+        grantState.granted = true;
+        grants.emplace_back(entry.participantName, grant);
+    }
+}
+
+bool TimeSyncCoordinator::ComputeGrant(const OtherNextSimTasks::Entry& entry, NextSimTask& grant) const
+{
+    const auto* other = _nextTasks.Earliest();
+    if (other == &entry)
+    {
+        other = _nextTasks.SecondEarliest();
+    }
+    if (other == nullptr)
+    {
+        // there is no other participant
+        return false;
+    }
+
+    grant = MakeGrant(*other);
+    return true;
+}
+
+void TimeSyncCoordinator::SendGrants(const Grants& grants)
+{
+    for (const auto& grant : grants)
+    {
+        _grantHandler(grant.first, grant.second);
+    }
+}
+
+} // namespace Orchestration
+} // namespace Services
+} // namespace SilKit
@@ -0,0 +1,90 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "TimeConfiguration.hpp"
+
+namespace SilKit {
+namespace Services {
+namespace Orchestration {
+
+//! Computes the time grants of the coordinator mode of the distributed time synchronization. Instead of broadcasting
+//! their NextSimTask to all other participants, the participants report it to the coordinator only. The coordinator
+//! grants each participant the lowest time bound of all other participants, and only sends a grant if it has changed.
+//! The grant of the participant with the lowest time bound is the second lowest time bound, the grant of all others is
+//! the lowest one. Thus, an update of a single participant changes the grants of all participants only if the lowest
+//! time bound changes, and otherwise at most two grants.
+class TimeSyncCoordinator
+{
+public:
+    using GrantHandler = std::function<void(const std::string& participantName, const NextSimTask& grant)>;
+
+public:
+    TimeSyncCoordinator(GrantHandler grantHandler);
+
+public:
+    //! The participant starts at the initial time point, which holds back the grants of all other participants until
+    //! it reports its first NextSimTask. Already known participants are ignored.
+    void AddParticipant(const std::string& participantName, std::chrono::nanoseconds lookahead = 0ns);
+    void RemoveParticipant(const std::string& participantName);
+    void OnReceiveNextSimTask(const std::string& participantName, const NextSimTask& task);
+
+private:
+    struct GrantState
+    {
+        NextSimTask grant;
+        bool granted{false};
+        bool reported{false};
+    };
+
+    using Grants = std::vector<std::pair<std::string, NextSimTask>>;
+
+private:
+    // The following must be called with the mutex held. The changed grants are collected and sent after unlocking.
+    void UpdateGrants(Grants& grants);
+    void UpdateGrant(const OtherNextSimTasks::Entry& entry, bool force, Grants& grants);
+    bool ComputeGrant(const OtherNextSimTasks::Entry& entry, NextSimTask& grant) const;
+    void SendGrants(const Grants& grants);
+
+private:
+    std::mutex _mx;
+    using Lock = std::unique_lock<decltype(_mx)>;
+    GrantHandler _grantHandler;
+    OtherNextSimTasks _nextTasks;
+    std::unordered_map<std::string, GrantState> _grantStates;
+
+    std::string _earliestParticipantName;
+    //! Grant of all but the earliest participant
+    NextSimTask _earliestGrant;
+};
+
+} // namespace Orchestration
+} // namespace Services
+} // namespace SilKit
@@ -19,6 +19,7 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <algorithm>
 #include <future>
 #include <functional>
 #include <atomic>
@@ -46,6 +47,7 @@ public:
     virtual void SetSimStepCompleted() = 0;
     virtual void ReceiveNextSimTask(const Core::IServiceEndpoint* from, const NextSimTask& task) = 0;
     virtual void ProcessSimulationTimeUpdate() = 0;
+    virtual void SetNextEventTime(std::chrono::nanoseconds nextEventTime) = 0;
 };
 
 //! brief Synchronization policy for unsynchronized participants
@@ -58,28 +60,40 @@ public:
     void SetSimStepCompleted() override {}
     void ReceiveNextSimTask(const Core::IServiceEndpoint* /*from*/, const NextSimTask& /*task*/) override {}
     void ProcessSimulationTimeUpdate() override {};
+    void SetNextEventTime(std::chrono::nanoseconds /*nextEventTime*/) override {}
 };
 
 //! brief Synchronization policy of the VAsio middleware
 struct SynchronizedPolicy : public ITimeSyncPolicy
 {
 public:
-    SynchronizedPolicy(TimeSyncService& controller, Core::IParticipantInternal* participant, TimeConfiguration* configuration)
+    SynchronizedPolicy(TimeSyncService& controller, Core::IParticipantInternal* participant,
+                       TimeConfiguration* configuration, size_t asyncPipelineDepth)
         : _controller(controller)
         , _participant(participant)
         , _configuration(configuration)
+        , _asyncPipelineDepth(asyncPipelineDepth)
     {
     }
 
     void Initialize() override
     {
         _configuration->Initialize();
+        _outstandingSimSteps = 0;
+        _isNextSimStepAnnounced = false;
     }
 
     void SetSimStepCompleted() override
     {
-        // after completing the SimTask in Async mode, reset the _isExecutingSimStep guard
-        _isExecutingSimStep = false;
+        // after completing the SimTask in Async mode, release one of the outstanding steps
+        auto outstandingSimSteps = _outstandingSimSteps.load();
+        do
+        {
+            if (outstandingSimSteps == 0)
+            {
+                return;
+            }
+        } while (!_outstandingSimSteps.compare_exchange_weak(outstandingSimSteps, outstandingSimSteps - 1));
     }
 
     void RequestNextStep() override
@@ -87,7 +101,21 @@ public:
         if (_controller.State() == ParticipantState::Running
             && !_controller.StopRequested()) // ensure that a call to Stop() in a SimTask won't send out a new step and eventually call the SimTask again
         {
-            _controller.SendMsg(_configuration->NextSimStep());
+            if (_isNextSimStepAnnounced)
+            {
+                // A pipelined step was announced when its predecessor returned, but could not be executed while the
+                // pipeline was full
+                _participant->ExecuteDeferred([this]() {
+                    this->ProcessSimulationTimeUpdate();
+                });
+                return;
+            }
+
+            _isInSimStep = false;
+            _isNextSimStepAnnounced = true;
+            _controller.SendNextSimTask(_configuration->NextSimStep());
+            // End of the simulation step: send the messages of the step, which may be held back in message batches
+            _participant->FlushSendBuffers();
             // Bootstrap checked execution, in case there is no other participant.
             // Else, checked execution is initiated when we receive their NextSimTask messages.
             _participant->ExecuteDeferred([this]() {
@@ -98,7 +126,7 @@ public:
 
     void ReceiveNextSimTask(const Core::IServiceEndpoint* from, const NextSimTask& task) override
     {
-        _configuration->OnReceiveNextSimStep(from->GetServiceDescriptor().GetParticipantName(), task);
+        _controller.OnReceiveNextSimTask(from->GetServiceDescriptor().GetParticipantName(), task);
 
         switch (_controller.State())
         {
@@ -128,7 +156,7 @@ public:
     void ProcessSimulationTimeUpdate() override
     {
         // Check if we meet the conditions to trigger our local time advancement
-        if (IsTimeAdvancePossible())
+        if (IsTimeAdvancePossible() && IsRealTimeDeadlineReached())
         {
             if (IsSimStepSync())
             {
@@ -141,6 +169,34 @@ public:
         }
     }
 
+    void SetNextEventTime(std::chrono::nanoseconds nextEventTime) override
+    {
+        // Within a simulation step, the next step is announced when the step is completed
+        if (_isInSimStep)
+        {
+            _configuration->SetNextEventTime(nextEventTime);
+            return;
+        }
+
+        // Otherwise, the next step was already announced. It is only re-announced if it moves later, the others may
+        // already have advanced beyond an earlier time.
+        _participant->ExecuteDeferred([this, nextEventTime] {
+            if (_isInSimStep)
+            {
+                _configuration->SetNextEventTime(nextEventTime);
+                return;
+            }
+
+            const auto state = _controller.State();
+            if ((state == ParticipantState::Running || state == ParticipantState::Paused)
+                && _configuration->PostponeNextEventTime(nextEventTime))
+            {
+                _controller.SendNextSimTask(_configuration->NextSimStep());
+                ProcessSimulationTimeUpdate();
+            }
+        });
+    }
+
 private:
     bool IsSimStepSync() const
     {
@@ -168,6 +224,12 @@ private:
             return false;
         }
 
+        // In the coordinator mode, the time only advances with the grants of the coordinator
+        if (_controller.IsWaitingForTimeSyncCoordinator())
+        {
+            return false;
+        }
+
         if (_configuration->OtherParticipantHasLowerTimepoint())
         {
             return false;
@@ -177,6 +239,34 @@ private:
         return true;
     }
 
+    //! With real-time pacing, a step which is not yet due is executed from a timer expiring at its deadline. The
+    //! thread processing the messages is not blocked in the meantime.
+    bool IsRealTimeDeadlineReached()
+    {
+        auto& realTimePacer = _controller.GetRealTimePacer();
+        if (!realTimePacer.IsEnabled())
+        {
+            return true;
+        }
+
+        const auto timePoint = _configuration->NextSimStep().timePoint;
+        if (realTimePacer.IsDue(timePoint))
+        {
+            return true;
+        }
+
+        if (!_isWaitingForRealTimeDeadline.exchange(true))
+        {
+            const auto deadline = std::chrono::steady_clock::time_point{
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(realTimePacer.GetDeadline(timePoint))};
+            _participant->ExecuteDeferredAt(deadline, [this] {
+                _isWaitingForRealTimeDeadline = false;
+                ProcessSimulationTimeUpdate();
+            });
+        }
+        return false;
+    }
+
     void AdvanceTimeSimStepSync() 
     {
         AdvanceTimeAndExecuteSimStep();
@@ -187,23 +277,33 @@ private:
 
     void AdvanceTimeSimStepAsync() 
     {
-        // when running in Async mode, set the _isExecutingSimStep guard
-        // which will be cleared in CompleteSimulationStep()
-        auto test = false;
-        auto newval = true;
-        if (!_isExecutingSimStep.compare_exchange_strong(test, newval))
+        // when running in Async mode, count the steps which are not yet completed by CompleteSimulationStep().
+        // Without pipelining, only one async SimStep is executed until completed by the user.
+        auto outstandingSimSteps = _outstandingSimSteps.load();
+        do
         {
-            //_isExecutingSimStep was not modified, it was already true
+            if (outstandingSimSteps > _asyncPipelineDepth)
+            {
+                //_outstandingSimSteps was not modified, the pipeline is already full
+                return;
+            }
+        } while (!_outstandingSimSteps.compare_exchange_weak(outstandingSimSteps, outstandingSimSteps + 1));
+
+        if (!AdvanceTimeAndExecuteSimStep())
+        {
+            _outstandingSimSteps -= 1;
             return;
         }
 
-        AdvanceTimeAndExecuteSimStep();
-
-        // Do nothing until a user calls CompleteSimulationStep()
-        // This ensures that only one async SimStep is executed until completed by the user
+        // With pipelining, the next step is announced as soon as the handler has returned, so the other participants
+        // can advance while the user completes this step. The messages sent by the handler are flushed with it.
+        if (_outstandingSimSteps <= _asyncPipelineDepth)
+        {
+            RequestNextStep();
+        }
     }
 
-    void AdvanceTimeAndExecuteSimStep()
+    bool AdvanceTimeAndExecuteSimStep()
     {
         if (_controller.State() == ParticipantState::Paused ||
             _controller.State() == ParticipantState::Running)
@@ -213,35 +313,65 @@ private:
                 if (_controller.AbortHopOnForCoordinatedParticipants())
                 {
                     // Prevent that the sim task is triggered
-                    return;
+                    return false;
                 }
             }
 
             // update the current and next sim. step timestamps
+            _isInSimStep = true;
+            _isNextSimStepAnnounced = false;
             _configuration->AdvanceTimeStep();
             // Execute the simulation step callback with the current simulation time
             auto currentStep = _configuration->CurrentSimStep();
             _controller.ExecuteSimStep(currentStep.timePoint, currentStep.duration);
             // if the participant was paused, wait until it is unpaused
             _controller.AwaitNotPaused();
+            return true;
         }
+        return false;
     }
 
-    std::atomic<bool> _isExecutingSimStep{false};
+    //! Async steps executed, but not yet completed by CompleteSimulationStep()
+    std::atomic<size_t> _outstandingSimSteps{0};
+    //! Set once the step following the current one was announced to the other participants
+    std::atomic<bool> _isNextSimStepAnnounced{false};
+    //! Set from advancing the time until the next step is announced
+    std::atomic<bool> _isInSimStep{false};
+    //! Set while a timer waits for the real-time deadline of the next step
+    std::atomic<bool> _isWaitingForRealTimeDeadline{false};
     TimeSyncService& _controller;
     Core::IParticipantInternal* _participant;
     TimeConfiguration* _configuration;
+    size_t _asyncPipelineDepth;
 };
 
 TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeProvider* timeProvider,
-                                 const Config::HealthCheck& healthCheckConfig, LifecycleService* lifecycleService)
+                                 const Config::HealthCheck& healthCheckConfig, LifecycleService* lifecycleService,
+                                 const Config::TimeSynchronization& timeSyncConfig)
     : _participant{participant}
     , _lifecycleService{lifecycleService}
     , _logger{participant->GetLogger()}
     , _timeProvider{timeProvider}
     , _timeConfiguration{participant->GetLogger()}
+    , _lookahead{timeSyncConfig.lookahead}
+    , _coordinatorName{timeSyncConfig.coordinator}
+    , _asyncPipelineDepth{static_cast<size_t>(std::max(timeSyncConfig.asyncPipelineDepth, 0))}
     , _watchDog{healthCheckConfig}
+    , _realTimePacer{timeSyncConfig, participant->GetLogger()}
 {
+    if (!_coordinatorName.empty() && _coordinatorName == _participant->GetParticipantName())
+    {
+        _coordinator = std::make_unique<TimeSyncCoordinator>(
+            [this](const std::string& participantName, const NextSimTask& grant) {
+                // our own grant is computed from the NextSimTasks we receive, as in the full mesh
+                if (participantName != _participant->GetParticipantName())
+                {
+                    _participant->SendMsg(this, participantName, grant);
+                }
+            });
+        _coordinator->AddParticipant(_participant->GetParticipantName(), _lookahead);
+    }
+
     _watchDog.SetWarnHandler([logger = _logger](std::chrono::milliseconds timeout) {
         Warn(logger, "SimStep did not finish within soft time limit. Timeout detected after {} ms",
                      std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(timeout).count());
@@ -279,7 +409,8 @@ TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeP
                             // Check capabilities of newly discovered participants. 
                             // This might happen before TimeSyncService and LifecycleService are finally configured,
                             // so this check happens also in TimeSyncService::StartTime() 
-                            if (!ParticipantHasAutonomousSynchronousCapability(descriptorParticipantName))
+                            if (!ParticipantHasAutonomousSynchronousCapability(descriptorParticipantName)
+                                || !ParticipantHasSameTimeSyncCoordinator(descriptor))
                             {
                                 _participant->GetSystemController()->AbortSimulation();
                                 return;
@@ -288,7 +419,38 @@ TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeP
                             Debug(_participant->GetLogger(), "TimeSyncService: Participant \'{}\' is added to the distributed time synchronization",
                                   descriptorParticipantName);
 
-                            _timeConfiguration.AddSynchronizedParticipant(descriptorParticipantName);
+                            const auto lookahead = GetAnnouncedLookahead(descriptor);
+                            if (lookahead > 0ns)
+                            {
+                                Debug(_logger, "TimeSyncService: Participant \'{}\' announced a lookahead of {}ns",
+                                      descriptorParticipantName, lookahead.count());
+                            }
+
+                            if (_coordinator)
+                            {
+                                _coordinator->AddParticipant(descriptorParticipantName, lookahead);
+                            }
+                            else if (!_coordinatorName.empty())
+                            {
+                                // In the coordinator mode, the coordinator is the only other participant we know of
+                                if (descriptorParticipantName != _coordinatorName)
+                                {
+                                    return;
+                                }
+
+                                _timeConfiguration.AddSynchronizedParticipant(descriptorParticipantName);
+                                _coordinatorDiscovered = true;
+
+                                // Our NextSimTask was dropped if we started before the coordinator joined
+                                const auto state = State();
+                                if (state == ParticipantState::Running || state == ParticipantState::Paused)
+                                {
+                                    SendNextSimTask(_timeConfiguration.NextSimStep());
+                                }
+                                return;
+                            }
+
+                            _timeConfiguration.AddSynchronizedParticipant(descriptorParticipantName, lookahead);
 
                             // If our time has advanced, we just added a late-joining participant. 
                             if (_timeConfiguration.CurrentSimStep().timePoint >= 0ns)
@@ -303,6 +465,19 @@ TimeSyncService::TimeSyncService(Core::IParticipantInternal* participant, ITimeP
                         }
                         else if (discoveryEventType == Core::Discovery::ServiceDiscoveryEvent::Type::ServiceRemoved)
                         {
+                            if (_coordinator)
+                            {
+                                _coordinator->RemoveParticipant(descriptorParticipantName);
+                            }
+                            else if (!_coordinatorName.empty() && descriptorParticipantName == _coordinatorName)
+                            {
+                                _coordinatorDiscovered = false;
+                                Warn(_logger,
+                                     "TimeSyncService: The time sync coordinator \'{}\' left the simulation, the "
+                                     "simulation time cannot advance until it rejoins",
+                                     descriptorParticipantName);
+                            }
+
                             // Other participant hopped off
                             if (_timeConfiguration.RemoveSynchronizedParticipant(descriptorParticipantName))
                             {
@@ -370,7 +545,8 @@ bool TimeSyncService::SetupTimeSyncPolicy(bool isSynchronizingVirtualTime)
     _timeSyncConfigured = true;
     if (isSynchronizingVirtualTime)
     {
-        _timeSyncPolicy = std::make_shared<SynchronizedPolicy>(*this, _participant, &_timeConfiguration);
+        _timeSyncPolicy = std::make_shared<SynchronizedPolicy>(*this, _participant, &_timeConfiguration,
+                                                               _asyncPipelineDepth);
     }
     else
     {
@@ -390,6 +566,8 @@ void TimeSyncService::AwaitNotPaused()
     if (_lifecycleService->State() == ParticipantState::Paused)
     {
         _pauseDone.wait();
+        // do not try to catch up on the wall-clock time spent in the paused state
+        _realTimePacer.Rebase();
     }
 }
 
@@ -412,6 +590,11 @@ void TimeSyncService::ExecuteSimStep(std::chrono::nanoseconds timePoint, std::ch
     SILKIT_ASSERT(_simTask);
     using DoubleMSecs = std::chrono::duration<double, std::milli>;
 
+    if (_realTimePacer.IsEnabled())
+    {
+        _realTimePacer.StartStep(timePoint);
+    }
+
     _waitTimeMonitor.StopMeasurement();
     Trace(_logger, "Starting next Simulation Task. Waiting time was: {}ms",
                    std::chrono::duration_cast<DoubleMSecs>(_waitTimeMonitor.CurrentDuration()).count());
@@ -429,6 +612,11 @@ void TimeSyncService::ExecuteSimStep(std::chrono::nanoseconds timePoint, std::ch
     _waitTimeMonitor.StartMeasurement();
 }
 
+auto TimeSyncService::GetRealTimePacer() -> RealTimePacer&
+{
+    return _realTimePacer;
+}
+
 void TimeSyncService::CompleteSimulationStep()
 {
     _logger->Debug("CompleteSimulationStep: calling _timeSyncPolicy->RequestNextStep");
@@ -454,6 +642,21 @@ void TimeSyncService::InitializeTimeSyncPolicy(bool isSynchronizingVirtualTime)
         }
 
         _serviceDescriptor.SetSupplementalDataItem(SilKit::Core::Discovery::timeSyncActive, (isSynchronizingVirtualTime) ? "1" : "0");
+        if (isSynchronizingVirtualTime && _lookahead > 0ns)
+        {
+            _serviceDescriptor.SetSupplementalDataItem(SilKit::Core::Discovery::timeSyncLookahead,
+                                                       std::to_string(_lookahead.count()));
+        }
+        if (isSynchronizingVirtualTime && !_coordinatorName.empty())
+        {
+            _serviceDescriptor.SetSupplementalDataItem(SilKit::Core::Discovery::timeSyncCoordinator, _coordinatorName);
+        }
+        else if (_coordinator)
+        {
+            Warn(_logger,
+                 "TimeSyncService: This participant is configured as the time sync coordinator, but does not "
+                 "synchronize its simulation time. The other participants cannot advance their simulation time.");
+        }
         ResetTime();
     }
     catch (const std::exception& e)
@@ -505,6 +708,102 @@ auto TimeSyncService::Now() const -> std::chrono::nanoseconds
     return _timeProvider->Now();
 }
 
+void TimeSyncService::SetNextEventTime(std::chrono::nanoseconds nextEventTime)
+{
+    const auto timeSyncPolicy = GetTimeSyncPolicy();
+    if (timeSyncPolicy == nullptr)
+    {
+        throw SilKit::StateError{"The next event time can only be set after the lifecycle was started"};
+    }
+    timeSyncPolicy->SetNextEventTime(nextEventTime);
+}
+
+auto TimeSyncService::GetAnnouncedLookahead(const Core::ServiceDescriptor& descriptor) const -> std::chrono::nanoseconds
+{
+    std::string lookahead;
+    if (!descriptor.GetSupplementalDataItem(Core::Discovery::timeSyncLookahead, lookahead))
+    {
+        return 0ns;
+    }
+
+    try
+    {
+        const auto value = std::chrono::nanoseconds{std::stoll(lookahead)};
+        if (value >= 0ns)
+        {
+            return value;
+        }
+    }
+    catch (const std::exception&)
+    {
+    }
+
+    Warn(_logger, "TimeSyncService: Participant \'{}\' announced an invalid lookahead \'{}\', ignoring it",
+         descriptor.GetParticipantName(), lookahead);
+    return 0ns;
+}
+
+bool TimeSyncService::ParticipantHasSameTimeSyncCoordinator(const Core::ServiceDescriptor& descriptor) const
+{
+    std::string coordinatorName;
+    descriptor.GetSupplementalDataItem(Core::Discovery::timeSyncCoordinator, coordinatorName);
+    if (coordinatorName != _coordinatorName)
+    {
+        Error(_logger,
+              "Participant \'{}\' uses the time sync coordinator \'{}\', but this participant uses \'{}\'. All "
+              "synchronized participants must use the same time sync coordinator. Aborting simulation...",
+              descriptor.GetParticipantName(), coordinatorName, _coordinatorName);
+        return false;
+    }
+    return true;
+}
+
+void TimeSyncService::SendNextSimTask(const NextSimTask& task)
+{
+    if (_coordinator)
+    {
+        _coordinator->OnReceiveNextSimTask(_participant->GetParticipantName(), task);
+    }
+    else if (!_coordinatorName.empty())
+    {
+        // Without a connection to the coordinator, the targeted send would fail on the I/O thread.
+        // The discovery of the coordinator sends our current NextSimTask instead.
+        if (!_coordinatorDiscovered)
+        {
+            Debug(_logger, "TimeSyncService: Holding back the NextSimTask until the coordinator \'{}\' is discovered",
+                  _coordinatorName);
+            return;
+        }
+        _participant->SendMsg(this, _coordinatorName, task);
+    }
+    else
+    {
+        SendMsg(task);
+    }
+}
+
+void TimeSyncService::OnReceiveNextSimTask(const std::string& participantName, const NextSimTask& task)
+{
+    if (!_coordinatorName.empty() && !_coordinator)
+    {
+        _timeConfiguration.OnReceiveTimeGrant(participantName, task);
+        return;
+    }
+
+    _timeConfiguration.OnReceiveNextSimStep(participantName, task);
+    if (_coordinator)
+    {
+        _coordinator->OnReceiveNextSimTask(participantName, task);
+        // the grants must not wait for the message batches to be flushed
+        _participant->FlushSendBuffers();
+    }
+}
+
+bool TimeSyncService::IsWaitingForTimeSyncCoordinator() const
+{
+    return !_coordinatorName.empty() && !_coordinator && !_coordinatorDiscovered;
+}
+
 auto TimeSyncService::GetTimeConfiguration() -> TimeConfiguration*
 {
     return &_timeConfiguration;
@@ -33,8 +33,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "LifecycleService.hpp"
 #include "ParticipantConfiguration.hpp"
 #include "PerformanceMonitor.hpp"
+#include "RealTimePacer.hpp"
 #include "TimeProvider.hpp"
 #include "TimeConfiguration.hpp"
+#include "TimeSyncCoordinator.hpp"
 #include "WatchDog.hpp"
 
 namespace SilKit {
@@ -61,7 +63,8 @@ public:
     // ----------------------------------------
     // Constructors, Destructor, and Assignment
     TimeSyncService(Core::IParticipantInternal* participant, ITimeProvider* timeProvider,
-                    const Config::HealthCheck& healthCheckConfig, LifecycleService* lifecycleService);
+                    const Config::HealthCheck& healthCheckConfig, LifecycleService* lifecycleService,
+                    const Config::TimeSynchronization& timeSyncConfig = {});
 
 public:
     // ----------------------------------------
@@ -74,11 +77,21 @@ public:
     void SetPeriod(std::chrono::nanoseconds period);
     void ReceiveMsg(const IServiceEndpoint* from, const NextSimTask& task) override;
     auto Now() const -> std::chrono::nanoseconds override;
+    //! Schedule the next simulation step at the given time, see SilKit::Experimental::Services::Orchestration
+    void SetNextEventTime(std::chrono::nanoseconds nextEventTime);
 
     // Used by Policies
     template <class MsgT>
     void SendMsg(MsgT&& msg) const;
+    //! Announce our next sim task, either to all other participants or to the time sync coordinator
+    void SendNextSimTask(const NextSimTask& task);
+    //! Process the next sim task, or the time grant of the coordinator, received from another participant
+    void OnReceiveNextSimTask(const std::string& participantName, const NextSimTask& task);
+    //! True, if the time is coordinated by another participant which was not discovered yet
+    bool IsWaitingForTimeSyncCoordinator() const;
     void ExecuteSimStep(std::chrono::nanoseconds timePoint, std::chrono::nanoseconds duration);
+    //! Paces the simulation steps to the wall clock, see Config::TimeSynchronization::realTimeFactor
+    auto GetRealTimePacer() -> RealTimePacer&;
 
     // Get the instance of the internal ITimeProvider that is updated with our simulation time
     void InitializeTimeSyncPolicy(bool isSynchronizingVirtualTime);
@@ -113,6 +126,12 @@ private:
 
     inline auto GetTimeSyncPolicy() const -> ITimeSyncPolicy *;
 
+    //! Returns the lookahead announced by the time sync service of another participant, 0 if it announced none.
+    auto GetAnnouncedLookahead(const Core::ServiceDescriptor& descriptor) const -> std::chrono::nanoseconds;
+
+    //! Returns false if the other participant uses a different time sync coordinator
+    bool ParticipantHasSameTimeSyncCoordinator(const Core::ServiceDescriptor& descriptor) const;
+
 private:
     // ----------------------------------------
     // private members
@@ -122,6 +141,16 @@ private:
     Services::Logging::ILogger* _logger{nullptr};
     ITimeProvider* _timeProvider{nullptr};
     TimeConfiguration _timeConfiguration;
+    std::chrono::nanoseconds _lookahead{0};
+
+    // Coordinator mode, see Config::TimeSynchronization::coordinator
+    std::string _coordinatorName;
+    //! Only set if this participant is the coordinator
+    std::unique_ptr<TimeSyncCoordinator> _coordinator;
+    std::atomic<bool> _coordinatorDiscovered{false};
+
+    // Number of pipelined async steps, see Config::TimeSynchronization::asyncPipelineDepth
+    size_t _asyncPipelineDepth{0};
 
     mutable std::mutex _timeSyncPolicyMx;
     std::shared_ptr<ITimeSyncPolicy> _timeSyncPolicy{nullptr};
@@ -138,6 +167,7 @@ private:
     Util::PerformanceMonitor _execTimeMonitor;
     Util::PerformanceMonitor _waitTimeMonitor;
     WatchDog _watchDog;
+    RealTimePacer _realTimePacer;
 
     // When pausing our participant, message processing is deferred
     // until Continue()'  is called;
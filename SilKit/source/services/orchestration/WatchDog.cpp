@@ -19,25 +19,16 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
-#include <iostream>
-
 #include "WatchDog.hpp"
-#include "SetThreadName.hpp"
 
 using namespace std::chrono_literals;
 
-namespace {
-
-auto GetDefaultClock() -> SilKit::Services::Orchestration::WatchDog::IClock*;
-
-} // namespace
-
 namespace SilKit {
 namespace Services {
 namespace Orchestration {
 
-WatchDog::WatchDog(const Config::HealthCheck& healthCheckConfig, IClock* clock)
-    : _clock{clock ? clock : GetDefaultClock()}
+WatchDog::WatchDog(const Config::HealthCheck& healthCheckConfig, std::shared_ptr<WatchDogScheduler> scheduler)
+    : _scheduler{scheduler ? std::move(scheduler) : WatchDogScheduler::GetShared()}
     , _warnHandler{[](std::chrono::milliseconds) {}}
     , _errorHandler{[](std::chrono::milliseconds) {}}
 {
@@ -54,23 +45,32 @@ WatchDog::WatchDog(const Config::HealthCheck& healthCheckConfig, IClock* clock)
         if (_errorTimeout <= 0ms)
             throw SilKitError{"WatchDog requires errorTimeout > 0ms"};
     }
-    _watchThread = std::thread{&WatchDog::Run, this};
 }
 
 WatchDog::~WatchDog()
 {
-    _stopPromise.set_value();
-    _watchThread.join();
+    _scheduler->Unregister(this);
 }
 
 void WatchDog::Start()
 {
-    _startTime.store(_clock->Now());
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    _run += 1;
+    _isRunning = true;
+    _startTime = _scheduler->Now();
+    _warned = false;
+    ArmNextDeadline();
 }
 
 void WatchDog::Reset()
 {
-    _startTime.store(std::chrono::nanoseconds::min());
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    _run += 1;
+    if (_isRunning)
+    {
+        _isRunning = false;
+        _scheduler->Disarm(this);
+    }
 }
 
 void WatchDog::SetWarnHandler(std::function<void(std::chrono::milliseconds)> handler)
@@ -83,68 +83,54 @@ void WatchDog::SetErrorHandler(std::function<void(std::chrono::milliseconds)> ha
     _errorHandler = std::move(handler);
 }
 
-void WatchDog::Run()
+void WatchDog::ArmNextDeadline()
 {
-    enum class WatchDogState
+    // The default timeout disables the warning or error. It must not be added to the start time, which would overflow.
+    if (!_warned && _warnTimeout != _defaultTimeout && _warnTimeout < _errorTimeout)
     {
-        Healthy,
-        Warn,
-        Error
-    };
-
-    SilKit::Util::SetThreadName("SilKit-Watchdog");
-    WatchDogState state = WatchDogState::Healthy;
-    auto stopFuture = _stopPromise.get_future();
-
-    while (true)
+        const auto run = _run;
+        _scheduler->Arm(this, _startTime + _warnTimeout, [this, run] {
+            OnDeadline(run, true);
+        });
+    }
+    else if (_errorTimeout != _defaultTimeout)
     {
-        auto futureStatus = stopFuture.wait_for(_resolution);
+        const auto run = _run;
+        _scheduler->Arm(this, _startTime + _errorTimeout, [this, run] {
+            OnDeadline(run, false);
+        });
+    }
+}
 
-        if (futureStatus == std::future_status::ready)
+void WatchDog::OnDeadline(uint64_t run, bool isWarnDeadline)
+{
+    std::chrono::milliseconds currentRunDuration;
+    bool isWarning;
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        if (run != _run)
         {
-            // stop was signaled; stopping thread;
+            // the step finished, or a new one started, before the deadline was processed
             return;
         }
 
-        const auto startTime = _startTime.load();
-
-        // We only communicate with the "main thread" via the atomic _startTime.
-        // If _startTime is duration::min(), Start() has not yet been called.
-        // Otherwise, _startTime is the duration since epoch when the Start() was called.
-        if (startTime == std::chrono::nanoseconds::min())
-        {
-            // no job is currently running. Reset state and continue.
-            state = WatchDogState::Healthy;
-            continue;
-        }
-
-        // These declarations are after the startTime check to prevent integer overflow
-        // by deferring arithmetic on duration::min() until Start() was called.
-        const auto now = _clock->Now();
-        const auto currentRunDuration = std::chrono::duration_cast<std::chrono::milliseconds>(now - startTime);
-
-        if (currentRunDuration > _warnTimeout && currentRunDuration <= _errorTimeout)
+        currentRunDuration = std::chrono::duration_cast<std::chrono::milliseconds>(_scheduler->Now() - _startTime);
+        // a late warning is skipped if the error timeout has passed as well
+        isWarning = isWarnDeadline && (_errorTimeout == _defaultTimeout || currentRunDuration < _errorTimeout);
+        _warned = true;
+        if (isWarning)
         {
-            if (state == WatchDogState::Healthy)
-            {
-                _warnHandler(currentRunDuration);
-                state = WatchDogState::Warn;
-            }
-            continue;
-        }
-
-        if (currentRunDuration > _errorTimeout)
-        {
-            if (state != WatchDogState::Error)
-            {
-                _errorHandler(currentRunDuration);
-                state = WatchDogState::Error;
-            }
-            continue;
+            ArmNextDeadline();
         }
+    }
 
-        // If neither warning, nor error timeouts were hit, the state is healthy.
-        state = WatchDogState::Healthy;
+    if (isWarning)
+    {
+        _warnHandler(currentRunDuration);
+    }
+    else
+    {
+        _errorHandler(currentRunDuration);
     }
 }
 
@@ -162,21 +148,3 @@ std::chrono::milliseconds WatchDog::GetErrorTimeout()
 } // namespace Orchestration
 } // namespace Services
 } // namespace SilKit
-
-namespace {
-
-struct SteadyClock : public SilKit::Services::Orchestration::WatchDog::IClock
-{
-    auto Now() const -> std::chrono::nanoseconds override
-    {
-        return std::chrono::steady_clock::now().time_since_epoch();
-    }
-};
-
-auto GetDefaultClock() -> SilKit::Services::Orchestration::WatchDog::IClock*
-{
-    static SteadyClock steadyClock{};
-    return &steadyClock;
-}
-
-} // namespace
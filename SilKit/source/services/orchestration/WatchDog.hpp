@@ -21,32 +21,30 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
-#include <atomic>
-#include <future>
 #include <chrono>
+#include <functional>
 #include <memory>
+#include <mutex>
 
 #include "ParticipantConfiguration.hpp"
+#include "WatchDogScheduler.hpp"
 
 namespace SilKit {
 namespace Services {
 namespace Orchestration {
 
+//! Reports simulation steps which exceed the soft or hard response timeout of the health check. Instead of polling,
+//! Start arms a deadline at the first timeout, and Reset disarms it.
 class WatchDog
 {
 public:
-    struct IClock
-    {
-        virtual ~IClock() = default;
-
-        /// Returns the current time in nanoseconds since the start of the current epoch.
-        virtual auto Now() const -> std::chrono::nanoseconds = 0;
-    };
+    using IClock = WatchDogScheduler::IClock;
 
 public:
     // ----------------------------------------
     // Constructors, Destructor, and Assignment
-    WatchDog(const Config::HealthCheck& healthCheckConfig, IClock* clock = nullptr);
+    //! Uses the scheduler shared by all watchdogs of the process, unless a scheduler is given
+    WatchDog(const Config::HealthCheck& healthCheckConfig, std::shared_ptr<WatchDogScheduler> scheduler = nullptr);
     ~WatchDog();
 
 public:
@@ -65,7 +63,11 @@ public:
 private:
     // ----------------------------------------
     // private methods
-    void Run();
+
+    //! Arms the deadline of the warn timeout, or the one of the error timeout after warning. Must be called with the
+    //! mutex held.
+    void ArmNextDeadline();
+    void OnDeadline(uint64_t run, bool isWarnDeadline);
 
 public:
     const std::chrono::milliseconds _defaultTimeout = std::chrono::milliseconds::max();
@@ -73,20 +75,20 @@ public:
 private:
     // ----------------------------------------
     // private members
-    std::promise<void> _stopPromise;
-    /// Clock used for watchdog timing. Can be injected via the constructor.
-    IClock* _clock;
-    // we use a duration instead of a timepoint to avoid a bug in clang6 (up to v9.0)
-    std::atomic<std::chrono::nanoseconds> _startTime{std::chrono::nanoseconds::min()};
+    std::shared_ptr<WatchDogScheduler> _scheduler;
 
-    std::chrono::milliseconds _resolution = std::chrono::milliseconds{2};
     std::chrono::milliseconds _warnTimeout = _defaultTimeout;
     std::chrono::milliseconds _errorTimeout = _defaultTimeout;
 
     std::function<void(std::chrono::milliseconds)> _warnHandler;
     std::function<void(std::chrono::milliseconds)> _errorHandler;
 
-    std::thread _watchThread;
+    std::mutex _mutex;
+    //! Incremented by Start and Reset, so a deadline of a previous step is ignored
+    uint64_t _run{0};
+    bool _isRunning{false};
+    std::chrono::nanoseconds _startTime{0};
+    bool _warned{false};
 };
 
 } // namespace Orchestration
@@ -0,0 +1,199 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#include "WatchDogScheduler.hpp"
+#include "SetThreadName.hpp"
+
+namespace {
+
+struct SteadyClock : public SilKit::Services::Orchestration::WatchDogScheduler::IClock
+{
+    auto Now() const -> std::chrono::nanoseconds override
+    {
+        return std::chrono::steady_clock::now().time_since_epoch();
+    }
+};
+
+auto GetSteadyClock() -> SteadyClock&
+{
+    static SteadyClock steadyClock{};
+    return steadyClock;
+}
+
+} // namespace
+
+namespace SilKit {
+namespace Services {
+namespace Orchestration {
+
+WatchDogScheduler::WatchDogScheduler()
+    : _clock{&GetSteadyClock()}
+{
+    _thread = std::thread{&WatchDogScheduler::Run, this};
+}
+
+WatchDogScheduler::WatchDogScheduler(IClock& clock)
+    : _clock{&clock}
+{
+}
+
+WatchDogScheduler::~WatchDogScheduler()
+{
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        _stop = true;
+    }
+    _deadlinesChanged.notify_all();
+
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+}
+
+auto WatchDogScheduler::GetShared() -> std::shared_ptr<WatchDogScheduler>
+{
+    static std::mutex mutex;
+    static std::weak_ptr<WatchDogScheduler> sharedScheduler;
+
+    std::unique_lock<decltype(mutex)> lock{mutex};
+    auto scheduler = sharedScheduler.lock();
+    if (scheduler == nullptr)
+    {
+        scheduler = std::make_shared<WatchDogScheduler>();
+        sharedScheduler = scheduler;
+    }
+    return scheduler;
+}
+
+auto WatchDogScheduler::Now() const -> std::chrono::nanoseconds
+{
+    return _clock->Now();
+}
+
+void WatchDogScheduler::Arm(const void* owner, std::chrono::nanoseconds deadline, std::function<void()> callback)
+{
+    bool isEarliest;
+    {
+        std::unique_lock<decltype(_mutex)> lock{_mutex};
+        Erase(owner);
+
+        const Key key{deadline, _nextSequenceNumber++};
+        _deadlines.emplace(key, Entry{owner, std::move(callback)});
+        _ownerDeadlines.emplace(owner, key);
+        isEarliest = _deadlines.begin()->first == key;
+    }
+
+    // the thread only needs to wake up if it sleeps until a later deadline
+    if (isEarliest)
+    {
+        _deadlinesChanged.notify_all();
+    }
+}
+
+void WatchDogScheduler::Disarm(const void* owner)
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    Erase(owner);
+}
+
+void WatchDogScheduler::Unregister(const void* owner)
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    Erase(owner);
+
+    // a callback may unregister its own owner
+    if (std::this_thread::get_id() != _runningThreadId)
+    {
+        _callbackDone.wait(lock, [this, owner] {
+            return _runningOwner != owner;
+        });
+    }
+}
+
+void WatchDogScheduler::ProcessDeadlines()
+{
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    while (!_deadlines.empty() && _deadlines.begin()->first.first <= _clock->Now())
+    {
+        InvokeEarliest(lock);
+    }
+}
+
+void WatchDogScheduler::Run()
+{
+    SilKit::Util::SetThreadName("SilKit-Watchdog");
+
+    std::unique_lock<decltype(_mutex)> lock{_mutex};
+    while (!_stop)
+    {
+        if (_deadlines.empty())
+        {
+            _deadlinesChanged.wait(lock);
+            continue;
+        }
+
+        const auto deadline = _deadlines.begin()->first.first;
+        if (deadline > _clock->Now())
+        {
+            using SteadyTimePoint = std::chrono::steady_clock::time_point;
+            _deadlinesChanged.wait_until(
+                lock, SteadyTimePoint{std::chrono::duration_cast<SteadyTimePoint::duration>(deadline)});
+            continue;
+        }
+
+        InvokeEarliest(lock);
+    }
+}
+
+void WatchDogScheduler::InvokeEarliest(std::unique_lock<std::mutex>& lock)
+{
+    auto it = _deadlines.begin();
+    auto entry = std::move(it->second);
+    _deadlines.erase(it);
+    _ownerDeadlines.erase(entry.owner);
+
+    _runningOwner = entry.owner;
+    _runningThreadId = std::this_thread::get_id();
+    lock.unlock();
+
+    entry.callback();
+
+    lock.lock();
+    _runningOwner = nullptr;
+    _runningThreadId = std::thread::id{};
+    _callbackDone.notify_all();
+}
+
+void WatchDogScheduler::Erase(const void* owner)
+{
+    auto it = _ownerDeadlines.find(owner);
+    if (it != _ownerDeadlines.end())
+    {
+        _deadlines.erase(it->second);
+        _ownerDeadlines.erase(it);
+    }
+}
+
+} // namespace Orchestration
+} // namespace Services
+} // namespace SilKit
@@ -0,0 +1,122 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include <cstdint>
+
+namespace SilKit {
+namespace Services {
+namespace Orchestration {
+
+//! Deadlines of the watchdogs of all participants in the process, kept in a map ordered by the deadline. A single
+//! thread sleeps until the earliest deadline and invokes its callback, nothing is polled while no deadline is armed.
+//! Each owner (i.e., watchdog) has at most one armed deadline.
+class WatchDogScheduler
+{
+public:
+    struct IClock
+    {
+        virtual ~IClock() = default;
+
+        /// Returns the current time in nanoseconds since the start of the current epoch.
+        virtual auto Now() const -> std::chrono::nanoseconds = 0;
+    };
+
+public:
+    // ----------------------------------------
+    // Constructors, Destructor, and Assignment
+
+    //! Uses the steady clock and a thread which invokes the callbacks when their deadline is reached
+    WatchDogScheduler();
+    //! Uses the given clock without a thread, the callbacks are only invoked by ProcessDeadlines
+    explicit WatchDogScheduler(IClock& clock);
+    ~WatchDogScheduler();
+
+    //! Returns the scheduler shared by all watchdogs of the process. Its thread stops with the last watchdog.
+    static auto GetShared() -> std::shared_ptr<WatchDogScheduler>;
+
+public:
+    // ----------------------------------------
+    // Public Methods
+    auto Now() const -> std::chrono::nanoseconds;
+
+    //! Replaces the armed deadline of the owner
+    void Arm(const void* owner, std::chrono::nanoseconds deadline, std::function<void()> callback);
+    void Disarm(const void* owner);
+    //! Disarms the deadline of the owner and waits until a callback of the owner that is currently running returns
+    void Unregister(const void* owner);
+
+    //! Invokes the callbacks of all deadlines that have been reached
+    void ProcessDeadlines();
+
+private:
+    // ----------------------------------------
+    // private data types
+    using Key = std::pair<std::chrono::nanoseconds, uint64_t>;
+
+    struct Entry
+    {
+        const void* owner;
+        std::function<void()> callback;
+    };
+
+private:
+    // ----------------------------------------
+    // private methods
+    void Run();
+    //! Must be called with the mutex held, which is released while the callback runs
+    void InvokeEarliest(std::unique_lock<std::mutex>& lock);
+    //! Must be called with the mutex held
+    void Erase(const void* owner);
+
+private:
+    // ----------------------------------------
+    // private members
+    IClock* _clock;
+
+    std::mutex _mutex;
+    std::condition_variable _deadlinesChanged;
+    std::condition_variable _callbackDone;
+    std::map<Key, Entry> _deadlines;
+    std::unordered_map<const void*, Key> _ownerDeadlines;
+    uint64_t _nextSequenceNumber{0};
+    const void* _runningOwner{nullptr};
+    std::thread::id _runningThreadId;
+    bool _stop{false};
+
+    std::thread _thread;
+};
+
+} // namespace Orchestration
+} // namespace Services
+} // namespace SilKit
@@ -23,6 +23,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "IParticipantInternal.hpp"
 #include "DataMessageDatatypeUtils.hpp"
 #include "WireDataMessages.hpp"
+#include "DataSerdes.hpp"
 #include "silkit/util/Span.hpp"
 
 namespace SilKit {
@@ -47,7 +48,11 @@ DataPublisher::DataPublisher(Core::IParticipantInternal* participant,
 
 void DataPublisher::PublishInternal(Util::Span<const uint8_t> data)
 {
-    WireDataMessageEvent msg{_timeProvider->Now(), data};
+    SendInternal(WireDataMessageEvent{_timeProvider->Now(), data});
+}
+
+void DataPublisher::SendInternal(const WireDataMessageEvent& msg)
+{
     _tracer.Trace(SilKit::Services::TransmitDirection::TX, msg.timestamp, ToDataMessageEvent(msg));
     _participant->SendMsg(this, msg);
 }
@@ -61,6 +66,20 @@ void DataPublisher::Publish(Util::Span<const uint8_t> data)
     PublishInternal(data);
 }
 
+auto DataPublisher::LoanBuffer(size_t size) -> std::vector<uint8_t>
+{
+    return AllocateSerializedDataMessage(size);
+}
+
+void DataPublisher::PublishLoan(std::vector<uint8_t> buffer)
+{
+    if (Tracing::IsReplayEnabledFor(_config.replay, Config::Replay::Direction::Send))
+    {
+        return;
+    }
+    SendInternal(MakeDataMessageFromSerialized(std::move(buffer), _timeProvider->Now()));
+}
+
 void DataPublisher::ReplayMessage(const SilKit::IReplayMessage* message)
 {
     using namespace SilKit::Tracing;
@@ -30,6 +30,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "IParticipantInternal.hpp"
 #include "ITraceMessageSource.hpp"
 #include "IReplayDataController.hpp"
+#include "WireDataMessages.hpp"
 
 namespace SilKit {
 namespace Services {
@@ -55,6 +56,12 @@ public:
 public: // Methods
     void Publish(Util::Span<const uint8_t> data) override;
 
+    //! Buffer for PublishLoan, laid out like the serialized message. The data of the given size starts at
+    //! SerializedDataMessageDataOffset and is filled in place.
+    auto LoanBuffer(size_t size) -> std::vector<uint8_t>;
+    //! Publish the data of a buffer obtained from LoanBuffer without copying it
+    void PublishLoan(std::vector<uint8_t> buffer);
+
     //SilKit::Services::Orchestration::ITimeConsumer
     void SetTimeProvider(Services::Orchestration::ITimeProvider* provider) override;
 
@@ -71,6 +78,7 @@ public: // Methods
     void ReplayMessage(const SilKit::IReplayMessage *message) override;
 private: // Methods
     void PublishInternal(Util::Span<const uint8_t> data);
+    void SendInternal(const WireDataMessageEvent& msg);
 
 private: // Member
     std::string _topic;
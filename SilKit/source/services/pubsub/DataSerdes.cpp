@@ -21,6 +21,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "DataSerdes.hpp"
 
+#include "silkit/participant/exception.hpp"
+
+#include <algorithm>
+
 namespace SilKit {
 namespace Services {
 namespace PubSub {
@@ -50,6 +54,83 @@ void Deserialize(SilKit::Core::MessageBuffer& buffer, WireDataMessageEvent& out)
     buffer >> out;
 }
 
+namespace {
+
+auto SerializeDataSize(size_t dataSize) -> std::vector<uint8_t>
+{
+    SilKit::Core::MessageBuffer buffer;
+    buffer << static_cast<uint32_t>(dataSize);
+    return buffer.ReleaseStorage();
+}
+
+auto SerializeTimestamp(std::chrono::nanoseconds timestamp) -> std::vector<uint8_t>
+{
+    SilKit::Core::MessageBuffer buffer;
+    buffer << timestamp;
+    return buffer.ReleaseStorage();
+}
+
+constexpr size_t SerializedTimestampSize{sizeof(std::chrono::nanoseconds::rep)};
+
+} // namespace
+
+auto AllocateSerializedDataMessage(size_t dataSize) -> std::vector<uint8_t>
+{
+    if (dataSize > std::numeric_limits<uint32_t>::max())
+    {
+        throw SilKitError{"The data of a DataMessageEvent must not exceed 4 GiB"};
+    }
+
+    auto buffer = SerializeDataSize(dataSize);
+    buffer.resize(SerializedDataMessageDataOffset + dataSize + SerializedTimestampSize);
+    return buffer;
+}
+
+auto MakeDataMessageFromSerialized(std::vector<uint8_t> buffer, std::chrono::nanoseconds timestamp)
+    -> WireDataMessageEvent
+{
+    if (buffer.size() < SerializedDataMessageDataOffset + SerializedTimestampSize)
+    {
+        throw SilKitError{"The buffer was not allocated by AllocateSerializedDataMessage"};
+    }
+
+    const auto dataSize = buffer.size() - SerializedDataMessageDataOffset - SerializedTimestampSize;
+    const auto serializedTimestamp = SerializeTimestamp(timestamp);
+    std::copy(serializedTimestamp.begin(), serializedTimestamp.end(), buffer.end() - SerializedTimestampSize);
+
+    auto storage = std::make_shared<const std::vector<uint8_t>>(std::move(buffer));
+    return WireDataMessageEvent{timestamp,
+                                Util::SharedVector<uint8_t>{std::move(storage), SerializedDataMessageDataOffset, dataSize}};
+}
+
+auto GetSerializedPayload(const WireDataMessageEvent& msg) -> std::shared_ptr<const std::vector<uint8_t>>
+{
+    const auto& storage = msg.data.Storage();
+    const auto dataSize = msg.data.AsSpan().size();
+    if (storage == nullptr || msg.data.Offset() != SerializedDataMessageDataOffset
+        || storage->size() != SerializedDataMessageDataOffset + dataSize + SerializedTimestampSize)
+    {
+        return nullptr;
+    }
+
+    // The storage is only the serialized message if the bytes around the data are exactly the serialized size and
+    // timestamp of the message
+    const auto serializedDataSize = SerializeDataSize(dataSize);
+    const auto serializedTimestamp = SerializeTimestamp(msg.timestamp);
+    if (!std::equal(serializedDataSize.begin(), serializedDataSize.end(), storage->begin())
+        || !std::equal(serializedTimestamp.begin(), serializedTimestamp.end(), storage->end() - SerializedTimestampSize))
+    {
+        return nullptr;
+    }
+
+    return storage;
+}
+
+bool PassesContentFilter(const WireDataMessageEvent& msg, const Util::ContentFilter& filter)
+{
+    return Util::MatchContentFilter(filter, msg.data.AsSpan());
+}
+
 } // namespace PubSub    
 } // namespace Services
 } // namespace SilKit
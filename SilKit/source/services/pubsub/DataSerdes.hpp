@@ -23,6 +23,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "MessageBuffer.hpp"
 #include "WireDataMessages.hpp"
+#include "ContentFilter.hpp"
 
 #include "silkit/services/pubsub/PubSubDatatypes.hpp"
 
@@ -33,6 +34,26 @@ namespace PubSub {
 void Serialize(SilKit::Core::MessageBuffer& buffer, const WireDataMessageEvent& msg);
 void Deserialize(SilKit::Core::MessageBuffer& buffer, WireDataMessageEvent& out);
 
+//! Offset of the data in a buffer allocated by AllocateSerializedDataMessage
+constexpr size_t SerializedDataMessageDataOffset{sizeof(uint32_t)};
+
+//! Allocate a buffer laid out like a serialized WireDataMessageEvent with dataSize bytes of data. The data starts at
+//! SerializedDataMessageDataOffset and is filled in place, the timestamp is written by MakeDataMessageFromSerialized.
+auto AllocateSerializedDataMessage(size_t dataSize) -> std::vector<uint8_t>;
+
+//! Write the timestamp into a buffer allocated by AllocateSerializedDataMessage. The data of the returned message
+//! refers to the buffer.
+auto MakeDataMessageFromSerialized(std::vector<uint8_t> buffer, std::chrono::nanoseconds timestamp)
+    -> WireDataMessageEvent;
+
+//! The serialized message body, if the data of the message is embedded in it (see MakeDataMessageFromSerialized),
+//! nullptr otherwise. Such messages are sent without serializing them again.
+auto GetSerializedPayload(const WireDataMessageEvent& msg) -> std::shared_ptr<const std::vector<uint8_t>>;
+
+//! True, if the data of the message matches the content filter of a remote subscriber. Messages which do not match
+//! are not sent to the subscriber.
+bool PassesContentFilter(const WireDataMessageEvent& msg, const Util::ContentFilter& filter);
+
 } // namespace PubSub    
 } // namespace Services
 } // namespace SilKit
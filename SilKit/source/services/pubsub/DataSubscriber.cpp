@@ -21,7 +21,6 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "DataSubscriber.hpp"
 #include "IServiceDiscovery.hpp"
-#include "YamlParser.hpp"
 #include "LabelMatching.hpp"
 
 #include "silkit/services/logging/ILogger.hpp"
@@ -46,8 +45,9 @@ DataSubscriber::DataSubscriber(Core::IParticipantInternal* participant, Config::
 
 void DataSubscriber::RegisterServiceDiscovery()
 {
-    auto matchHandler = [this](SilKit::Core::Discovery::ServiceDiscoveryEvent::Type discoveryType,
-                               const SilKit::Core::ServiceDescriptor& serviceDescriptor) {
+    auto matchHandler = [this, subscriberLabels = Util::CompileLabels(_labels)](
+                            SilKit::Core::Discovery::ServiceDiscoveryEvent::Type discoveryType,
+                            const SilKit::Core::ServiceDescriptor& serviceDescriptor) {
         auto getVal = [serviceDescriptor](const std::string& key) {
             std::string tmp;
             if (!serviceDescriptor.GetSupplementalDataItem(key, tmp))
@@ -66,27 +66,32 @@ void DataSubscriber::RegisterServiceDiscovery()
             return;
         }
 
+        // Only connected, i.e., matching publishers are removed, there is nothing to match again
+        if (discoveryType == SilKit::Core::Discovery::ServiceDiscoveryEvent::Type::ServiceRemoved)
+        {
+            std::unique_lock<decltype(_internalSubscribersMx)> lock(_internalSubscribersMx);
+            RemoveInternalSubscriber(pubUUID);
+            return;
+        }
+
         const auto topic = getVal(Core::Discovery::supplKeyDataPublisherTopic);
         if (topic == _topic)
         {
             const std::string pubMediaType{getVal(Core::Discovery::supplKeyDataPublisherMediaType)};
             if (MatchMediaType(_mediaType, pubMediaType))
             {
-                const std::string labelsStr = getVal(Core::Discovery::supplKeyDataPublisherPubLabels);
-                const std::vector<SilKit::Services::MatchingLabel> publisherLabels =
-                    SilKit::Config::Deserialize<std::vector<SilKit::Services::MatchingLabel>>(labelsStr);
-                if (Util::MatchLabels(_labels, publisherLabels))
+                const auto publisherLabels = _participant->GetServiceDiscovery()->GetServiceLabels(serviceDescriptor);
+                if (Util::MatchLabels(subscriberLabels, *publisherLabels))
                 {
                     std::unique_lock<decltype(_internalSubscribersMx)> lock(_internalSubscribersMx);
 
-                    if (discoveryType == SilKit::Core::Discovery::ServiceDiscoveryEvent::Type::ServiceCreated)
-                    {
-                        AddInternalSubscriber(pubUUID, pubMediaType, publisherLabels);
-                    }
-                    else if (discoveryType == SilKit::Core::Discovery::ServiceDiscoveryEvent::Type::ServiceRemoved)
-                    {
-                        RemoveInternalSubscriber(pubUUID);
-                    }
+                    // Only the links of publishers without history can be shared, a history is sent per link
+                    std::string history;
+                    const bool shareable =
+                        serviceDescriptor.GetSupplementalDataItem(Core::Discovery::supplKeyDataPublisherHistory,
+                                                                  history)
+                        && history == "0";
+                    AddInternalSubscriber(pubUUID, pubMediaType, publisherLabels->labels, shareable);
                 }
             }
         }
@@ -104,15 +109,16 @@ void DataSubscriber::SetDataMessageHandler(DataMessageHandler callback)
     _defaultDataHandler = tracingCallback;
     for (auto internalSubscriber : _internalSubscribers)
     {
-        internalSubscriber.second->SetDataMessageHandler(tracingCallback);
+        internalSubscriber.second->SetDataMessageHandler(this, tracingCallback);
     }
 }
 
 void DataSubscriber::AddInternalSubscriber(const std::string& pubUUID, const std::string& joinedMediaType,
-                                           const std::vector<SilKit::Services::MatchingLabel>& publisherLabels)
+                                           const std::vector<SilKit::Services::MatchingLabel>& publisherLabels,
+                                           bool shareable)
 {
     auto internalSubscriber = dynamic_cast<DataSubscriberInternal*>(_participant->CreateDataSubscriberInternal(
-        _topic, pubUUID, joinedMediaType, publisherLabels, _defaultDataHandler, this));
+        _topic, pubUUID, joinedMediaType, publisherLabels, _defaultDataHandler, this, shareable));
     
     _internalSubscribers.emplace(pubUUID, internalSubscriber);
 }
@@ -122,7 +128,12 @@ void DataSubscriber::RemoveInternalSubscriber(const std::string& pubUUID)
     auto internalSubscriber = _internalSubscribers.find(pubUUID);
     if (internalSubscriber != _internalSubscribers.end())
     {
-        _participant->GetServiceDiscovery()->NotifyServiceRemoved(internalSubscriber->second->GetServiceDescriptor());
+        // A shared internal subscriber is removed with the last of its subscribers
+        if (internalSubscriber->second->RemoveSubscriber(this))
+        {
+            _participant->GetServiceDiscovery()->NotifyServiceRemoved(
+                internalSubscriber->second->GetServiceDescriptor());
+        }
         _internalSubscribers.erase(pubUUID);
     }
 }
@@ -73,7 +73,7 @@ public: //methods
 
 private: //methods
     void AddInternalSubscriber(const std::string& pubUUID, const std::string& joinedMediaType,
-        const std::vector<SilKit::Services::MatchingLabel>& publisherLabels);
+        const std::vector<SilKit::Services::MatchingLabel>& publisherLabels, bool shareable);
 
     void RemoveInternalSubscriber(const std::string& pubUUID);
 
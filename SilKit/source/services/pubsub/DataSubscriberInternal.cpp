@@ -19,6 +19,8 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
+#include <algorithm>
+
 #include "DataSubscriberInternal.hpp"
 #include "DataSubscriber.hpp"
 
@@ -31,11 +33,13 @@ namespace PubSub {
 DataSubscriberInternal::DataSubscriberInternal(Core::IParticipantInternal* participant, Services::Orchestration::ITimeProvider* timeProvider,
                                                const std::string& topic, const std::string& mediaType,
                                                const std::vector<SilKit::Services::MatchingLabel>& labels,
-                                               DataMessageHandler defaultHandler, IDataSubscriber* parent)
+                                               DataMessageHandler defaultHandler, IDataSubscriber* parent,
+                                               Util::ContentFilter contentFilter)
     : _topic{topic}
     , _mediaType{mediaType}
     , _labels{labels}
-    , _defaultHandler{std::move(defaultHandler)}
+    , _contentFilter{std::move(contentFilter)}
+    , _routes{std::make_shared<RouteTable>(RouteTable{Route{parent, std::move(defaultHandler)}})}
     , _parent{parent}
     , _timeProvider{timeProvider}
     , _participant{participant}
@@ -50,7 +54,51 @@ DataSubscriberInternal::DataSubscriberInternal(Core::IParticipantInternal* parti
 
 void DataSubscriberInternal::SetDataMessageHandler(DataMessageHandler handler)
 {
-    _defaultHandler = std::move(handler);
+    SetDataMessageHandler(_parent, std::move(handler));
+}
+
+void DataSubscriberInternal::SetDataMessageHandler(IDataSubscriber* subscriber, DataMessageHandler handler)
+{
+    std::unique_lock<decltype(_routesMx)> lock{_routesMx};
+    auto routes = std::make_shared<RouteTable>(*_routes);
+    for (auto& route : *routes)
+    {
+        if (route.subscriber == subscriber)
+        {
+            route.handler = handler;
+        }
+    }
+    _routes = std::move(routes);
+}
+
+bool DataSubscriberInternal::AddSubscriber(IDataSubscriber* subscriber, DataMessageHandler handler)
+{
+    std::unique_lock<decltype(_routesMx)> lock{_routesMx};
+    if (_routes->empty())
+    {
+        return false;
+    }
+    auto routes = std::make_shared<RouteTable>(*_routes);
+    routes->push_back(Route{subscriber, std::move(handler)});
+    _routes = std::move(routes);
+    return true;
+}
+
+bool DataSubscriberInternal::RemoveSubscriber(IDataSubscriber* subscriber)
+{
+    std::unique_lock<decltype(_routesMx)> lock{_routesMx};
+    auto routes = std::make_shared<RouteTable>(*_routes);
+    routes->erase(std::remove_if(routes->begin(), routes->end(),
+                                 [subscriber](const Route& route) { return route.subscriber == subscriber; }),
+                  routes->end());
+    _routes = std::move(routes);
+    return _routes->empty();
+}
+
+auto DataSubscriberInternal::GetRoutes() -> std::shared_ptr<const RouteTable>
+{
+    std::unique_lock<decltype(_routesMx)> lock{_routesMx};
+    return _routes;
 }
 
 void DataSubscriberInternal::ReceiveMsg(const IServiceEndpoint* /*from*/, const WireDataMessageEvent& dataMessageEvent)
@@ -65,15 +113,27 @@ void DataSubscriberInternal::ReceiveMsg(const IServiceEndpoint* /*from*/, const
 
 void DataSubscriberInternal::ReceiveInternal(const WireDataMessageEvent& dataMessageEvent)
 {
-
-    if (_defaultHandler)
+    // Publishers filter the data sent to this participant, but they may be of an older version, and the data of local
+    // publishers and of the subscribers sharing the link of this participant is not filtered for this subscriber
+    if (!_contentFilter.empty() && !Util::MatchContentFilter(_contentFilter, dataMessageEvent.data.AsSpan()))
     {
-        _defaultHandler(_parent, ToDataMessageEvent(dataMessageEvent));
+        return;
     }
 
-    if (!_defaultHandler)
+    const auto routes = GetRoutes();
+    const auto event = ToDataMessageEvent(dataMessageEvent);
+
+    for (const auto& route : *routes)
     {
-        _participant->GetLogger()->Warn("DataSubscriber on topic " + _topic + " received data, but has no default handler assigned");
+        if (route.handler)
+        {
+            route.handler(route.subscriber, event);
+        }
+        else
+        {
+            _participant->GetLogger()->Warn("DataSubscriber on topic " + _topic
+                                            + " received data, but has no default handler assigned");
+        }
     }
 }
 
@@ -21,6 +21,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "ITimeConsumer.hpp"
 
 #include "IMsgForDataSubscriberInternal.hpp"
@@ -28,6 +32,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "DataMessageDatatypeUtils.hpp"
 #include "SynchronizedHandlers.hpp"
 #include "IReplayDataController.hpp"
+#include "ContentFilter.hpp"
 
 namespace SilKit {
 namespace Services {
@@ -44,10 +49,18 @@ public: //Ctor
                            Services::Orchestration::ITimeProvider* timeProvider, const std::string& topic,
                            const std::string& mediaType, const std::vector<SilKit::Services::MatchingLabel>& labels,
                            DataMessageHandler defaultHandler,
-                           IDataSubscriber* parent);
+                           IDataSubscriber* parent, Util::ContentFilter contentFilter = {});
 
 public: //Methods
     void SetDataMessageHandler(DataMessageHandler handler);
+    //! \brief Sets the handler of one of the subscribers the messages are delivered to.
+    void SetDataMessageHandler(IDataSubscriber* subscriber, DataMessageHandler handler);
+
+    //! \brief Delivers the messages also to another subscriber matching the same publisher (topic multiplexing).
+    //! Returns false, if all subscribers have already been removed.
+    bool AddSubscriber(IDataSubscriber* subscriber, DataMessageHandler handler);
+    //! \brief Stops delivering the messages to the subscriber. Returns true, if no subscriber is left.
+    bool RemoveSubscriber(IDataSubscriber* subscriber);
     
     //! \brief Accepts messages originating from SilKit communications.
     void ReceiveMsg(const IServiceEndpoint* from, const WireDataMessageEvent& dataMessageEvent) override;
@@ -57,6 +70,8 @@ public: //Methods
 
     std::string GetMediaType() { return _mediaType; };
     auto GetLabels() -> const std::vector<SilKit::Services::MatchingLabel>& { return _labels; };
+    //! Only data matching the filter is delivered to the subscribers
+    auto GetContentFilter() const -> const Util::ContentFilter& { return _contentFilter; }
 
     // IServiceEndpoint
     inline void SetServiceDescriptor(const Core::ServiceDescriptor& serviceDescriptor) override;
@@ -65,13 +80,27 @@ public: //Methods
     // IReplayDataProvider
     void ReplayMessage(const IReplayMessage* replayMessage) override;
 
+private: //Types
+    struct Route
+    {
+        IDataSubscriber* subscriber;
+        DataMessageHandler handler;
+    };
+    using RouteTable = std::vector<Route>;
+
 private: //Methods
     void ReceiveInternal(const WireDataMessageEvent& dataMessageEvent);
+    auto GetRoutes() -> std::shared_ptr<const RouteTable>;
 private: // Member
     std::string _topic;
     std::string _mediaType;
     std::vector<SilKit::Services::MatchingLabel> _labels;
-    DataMessageHandler _defaultHandler;
+    Util::ContentFilter _contentFilter;
+
+    // The subscribers the messages are delivered to. The table is replaced on every change, so the receive path only
+    // holds the lock to copy the pointer.
+    std::mutex _routesMx;
+    std::shared_ptr<const RouteTable> _routes;
     
     Config::Replay _replayConfig;
 
@@ -27,6 +27,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "MockParticipant.hpp"
 
 #include "DataMessageDatatypeUtils.hpp"
+#include "DataSerdes.hpp"
 #include "silkit/services/pubsub/PubSubSpec.hpp"
 
 namespace {
@@ -76,4 +77,16 @@ TEST_F(Test_DataPublisher, publish)
     publisher.Publish(sampleData);
 }
 
+TEST_F(Test_DataPublisher, publish_loaned_buffer)
+{
+    WireDataMessageEvent msg{0ns, sampleData};
+
+    EXPECT_CALL(participant, SendMsg(&publisher, msg))
+        .Times(1);
+
+    auto buffer = publisher.LoanBuffer(sampleData.size());
+    std::copy(sampleData.begin(), sampleData.end(), buffer.begin() + SerializedDataMessageDataOffset);
+    publisher.PublishLoan(std::move(buffer));
+}
+
 } // anonymous namespace
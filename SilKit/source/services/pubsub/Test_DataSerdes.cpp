@@ -55,3 +55,32 @@ TEST(Test_DataSerdes, SimData_LargeDataMessage)
     EXPECT_EQ(in, out);
 }
 
+
+TEST(Test_DataSerdes, SimData_LoanedBufferIsTheSerializedMessage)
+{
+    using namespace SilKit::Services::PubSub;
+
+    const std::vector<uint8_t> referenceData{1, 2, 3, 4, 5};
+
+    auto loanedBuffer = AllocateSerializedDataMessage(referenceData.size());
+    std::copy(referenceData.begin(), referenceData.end(), loanedBuffer.begin() + SerializedDataMessageDataOffset);
+    const auto loanedMessage = MakeDataMessageFromSerialized(std::move(loanedBuffer), 0xabcdefns);
+
+    const WireDataMessageEvent copiedMessage{0xabcdefns, referenceData};
+    EXPECT_EQ(loanedMessage, copiedMessage);
+
+    SilKit::Core::MessageBuffer buffer;
+    Serialize(buffer, copiedMessage);
+
+    const auto payload = GetSerializedPayload(loanedMessage);
+    ASSERT_NE(payload, nullptr);
+    EXPECT_EQ(*payload, buffer.ReleaseStorage());
+
+    // the data of a regular message is not embedded in its serialized form
+    EXPECT_EQ(GetSerializedPayload(copiedMessage), nullptr);
+
+    // the timestamp of a modified copy no longer matches the buffer
+    auto modifiedMessage = loanedMessage;
+    modifiedMessage.timestamp = 1ns;
+    EXPECT_EQ(GetSerializedPayload(modifiedMessage), nullptr);
+}
@@ -51,7 +51,8 @@ public:
     MOCK_METHOD(Services::PubSub::DataSubscriberInternal*, CreateDataSubscriberInternal,
                 (const std::string& /*topic*/, const std::string& /*linkName*/, const std::string& /*mediaType*/,
                  (const std::vector<SilKit::Services::MatchingLabel>&)/*publisherLabels*/,
-                 Services::PubSub::DataMessageHandler /*callback*/, Services::PubSub::IDataSubscriber* /*parent*/),
+                 Services::PubSub::DataMessageHandler /*callback*/, Services::PubSub::IDataSubscriber* /*parent*/,
+                 bool /*shareable*/),
                 (override));
 };
 
@@ -116,7 +117,7 @@ struct CreateSubscriberInternalMock
     auto operator()(const std::string& topic, const std::string& /*linkName*/, const std::string& mediaType,
                     const std::vector<SilKit::Services::MatchingLabel>& labels,
                     Services::PubSub::DataMessageHandler defaultHandler,
-                    Services::PubSub::IDataSubscriber* parent) -> DataSubscriberInternal*
+                    Services::PubSub::IDataSubscriber* parent, bool /*shareable*/) -> DataSubscriberInternal*
     {
         dataSubscriberInternal = std::make_unique<DataSubscriberInternal>(
             participant, participant->GetTimeProvider(), topic, mediaType, labels, std::move(defaultHandler), parent);
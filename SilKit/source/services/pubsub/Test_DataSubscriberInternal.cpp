@@ -20,6 +20,7 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "DataSubscriberInternal.hpp"
+#include "DataSubscriber.hpp"
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -79,4 +80,64 @@ TEST_F(Test_DataSubscriberInternal, trigger_default_data_handler)
 
     subscriber.ReceiveMsg(&subscriberOther, msg);
 }
+
+TEST_F(Test_DataSubscriberInternal, delivers_to_all_added_subscribers)
+{
+    const WireDataMessageEvent msg{0ns, {0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u}};
+
+    DataSubscriber otherSubscriber{&participant, {}, participant.GetTimeProvider(), PubSubSpec{"Topic", {}}, {}};
+    IDataSubscriber* otherParent = &otherSubscriber;
+    ASSERT_TRUE(subscriber.AddSubscriber(
+        otherParent, SilKit::Util::bind_method(&callbacks, &Callbacks::ReceiveDataExplicit)));
+
+    {
+        InSequence seq;
+        EXPECT_CALL(callbacks, ReceiveDataDefault(nullptr, ToDataMessageEvent(msg))).Times(1);
+        EXPECT_CALL(callbacks, ReceiveDataExplicit(otherParent, ToDataMessageEvent(msg))).Times(1);
+    }
+
+    subscriber.ReceiveMsg(&subscriberOther, msg);
+}
+
+TEST_F(Test_DataSubscriberInternal, removed_subscribers_receive_nothing)
+{
+    const WireDataMessageEvent msg{0ns, {0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u}};
+
+    DataSubscriber otherSubscriber{&participant, {}, participant.GetTimeProvider(), PubSubSpec{"Topic", {}}, {}};
+    IDataSubscriber* otherParent = &otherSubscriber;
+    ASSERT_TRUE(subscriber.AddSubscriber(
+        otherParent, SilKit::Util::bind_method(&callbacks, &Callbacks::ReceiveDataExplicit)));
+
+    EXPECT_FALSE(subscriber.RemoveSubscriber(nullptr));
+
+    EXPECT_CALL(callbacks, ReceiveDataDefault(_, _)).Times(0);
+    EXPECT_CALL(callbacks, ReceiveDataExplicit(otherParent, ToDataMessageEvent(msg))).Times(1);
+    subscriber.ReceiveMsg(&subscriberOther, msg);
+
+    // once the last subscriber is removed, no subscriber can be added anymore
+    EXPECT_TRUE(subscriber.RemoveSubscriber(otherParent));
+    EXPECT_FALSE(subscriber.AddSubscriber(
+        otherParent, SilKit::Util::bind_method(&callbacks, &Callbacks::ReceiveDataExplicit)));
+    subscriber.ReceiveMsg(&subscriberOther, msg);
+}
+
+TEST_F(Test_DataSubscriberInternal, content_filter_drops_data_not_matching)
+{
+    const SilKit::Util::ContentFilter contentFilter{{1, {0x10, 0x20}, {0xF0, 0xFF}}};
+    DataSubscriberInternal filteringSubscriber{
+        &participant, participant.GetTimeProvider(), "Topic", {}, {}, {}, nullptr, contentFilter};
+    filteringSubscriber.SetDataMessageHandler(SilKit::Util::bind_method(&callbacks, &Callbacks::ReceiveDataDefault));
+
+    const WireDataMessageEvent matching{0ns, {0u, 0x1Fu, 0x20u, 3u}};
+    const WireDataMessageEvent notMatching{0ns, {0u, 0x1Fu, 0x21u, 3u}};
+    const WireDataMessageEvent tooShort{0ns, {0u, 0x1Fu}};
+
+    EXPECT_CALL(callbacks, ReceiveDataDefault(nullptr, ToDataMessageEvent(matching))).Times(1);
+    EXPECT_CALL(callbacks, ReceiveDataDefault(nullptr, ToDataMessageEvent(notMatching))).Times(0);
+    EXPECT_CALL(callbacks, ReceiveDataDefault(nullptr, ToDataMessageEvent(tooShort))).Times(0);
+
+    filteringSubscriber.ReceiveMsg(&subscriberOther, matching);
+    filteringSubscriber.ReceiveMsg(&subscriberOther, notMatching);
+    filteringSubscriber.ReceiveMsg(&subscriberOther, tooShort);
+}
 } // anonymous namespace
@@ -25,7 +25,6 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include "RpcServer.hpp"
 #include "RpcDatatypeUtils.hpp"
 #include "Uuid.hpp"
-#include "YamlParser.hpp"
 #include "Assert.hpp"
 #include "LabelMatching.hpp"
 
@@ -45,8 +44,9 @@ RpcServer::RpcServer(Core::IParticipantInternal* participant, Services::Orchestr
 
 void RpcServer::RegisterServiceDiscovery()
 {
-    auto matchHandler = [this](SilKit::Core::Discovery::ServiceDiscoveryEvent::Type discoveryType,
-                               const SilKit::Core::ServiceDescriptor& serviceDescriptor) {
+    auto matchHandler = [this, serverLabels = Util::CompileLabels(_dataSpec.Labels())](
+                            SilKit::Core::Discovery::ServiceDiscoveryEvent::Type discoveryType,
+                            const SilKit::Core::ServiceDescriptor& serviceDescriptor) {
         if (discoveryType == SilKit::Core::Discovery::ServiceDiscoveryEvent::Type::ServiceCreated)
         {
             auto getVal = [serviceDescriptor](const std::string& key) {
@@ -61,13 +61,13 @@ void RpcServer::RegisterServiceDiscovery()
             auto functionName = getVal(Core::Discovery::supplKeyRpcClientFunctionName);
             auto clientMediaType = getVal(Core::Discovery::supplKeyRpcClientMediaType);
             auto clientUUID = getVal(Core::Discovery::supplKeyRpcClientUUID);
-            std::string labelsStr = getVal(Core::Discovery::supplKeyRpcClientLabels);
-            auto clientLabels = SilKit::Config::Deserialize<std::vector<SilKit::Services::MatchingLabel>>(labelsStr);
-
-            if (functionName == _dataSpec.FunctionName() && MatchMediaType(clientMediaType, _dataSpec.MediaType())
-                && Util::MatchLabels(_dataSpec.Labels(), clientLabels))
+            if (functionName == _dataSpec.FunctionName() && MatchMediaType(clientMediaType, _dataSpec.MediaType()))
             {
-                AddInternalRpcServer(clientUUID, clientMediaType, clientLabels);
+                const auto clientLabels = _participant->GetServiceDiscovery()->GetServiceLabels(serviceDescriptor);
+                if (Util::MatchLabels(serverLabels, *clientLabels))
+                {
+                    AddInternalRpcServer(clientUUID, clientMediaType, clientLabels->labels);
+                }
             }
         }
     };
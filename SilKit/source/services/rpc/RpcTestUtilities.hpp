@@ -77,6 +77,13 @@ struct MockConnection
     {
     }
 
+    template <class SilKitServiceT>
+    void SetRemoteSubscriptionForLink(SilKitServiceT* /*service*/, const std::string& /*participantName*/,
+                                      SilKit::Core::EndpointId /*subscriberId*/,
+                                      std::shared_ptr<const SilKit::Core::RemoteSubscription> /*subscription*/)
+    {
+    }
+
     template <typename SilKitMessageT>
     void SendMsg(const SilKit::Core::IServiceEndpoint* /*from*/, SilKitMessageT&& /*msg*/)
     {
@@ -111,6 +118,9 @@ struct MockConnection
     void OnAllMessagesDelivered(std::function<void()> /*callback*/) {}
     void FlushSendBuffers() {}
     void ExecuteDeferred(std::function<void()> /*callback*/) {}
+    void ExecuteDeferredAt(std::chrono::steady_clock::time_point /*deadline*/, std::function<void()> /*callback*/) {}
+    auto GetTransportMetrics() -> SilKit::Core::TransportMetrics { return {}; }
+    auto GetSendQueueStatus() -> std::map<std::string, SilKit::Core::SendQueueStatus> { return {}; }
     void NotifyShutdown() {}
 
     void RegisterMessageReceiver(
@@ -0,0 +1,198 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "ContentFilter.hpp"
+
+#include "silkit/participant/exception.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace SilKit {
+namespace Util {
+
+namespace {
+
+// Format version of EncodeContentFilter, followed by the number of predicates and offset, value and mask of each
+constexpr uint8_t EncodedContentFilterVersion{1};
+
+void ValidatePredicate(const ContentPredicate& predicate)
+{
+    if (predicate.value.empty())
+    {
+        throw SilKitError{"ContentFilter: the value of a predicate must not be empty"};
+    }
+    if (!predicate.mask.empty() && predicate.mask.size() != predicate.value.size())
+    {
+        throw SilKitError{"ContentFilter: the mask of a predicate must be empty or as long as its value"};
+    }
+}
+
+void WriteSize(std::string& out, size_t size)
+{
+    if (size > (std::numeric_limits<uint32_t>::max)())
+    {
+        throw SilKitError{"EncodeContentFilter: the filter is too large"};
+    }
+    for (int shift = 0; shift != 32; shift += 8)
+    {
+        out.push_back(static_cast<char>((size >> shift) & 0xff));
+    }
+}
+
+void WriteBytes(std::string& out, const std::vector<uint8_t>& bytes)
+{
+    WriteSize(out, bytes.size());
+    out.append(bytes.begin(), bytes.end());
+}
+
+class EncodedContentFilterReader
+{
+public:
+    explicit EncodedContentFilterReader(const std::string& in)
+        : _in{in}
+    {
+    }
+
+    auto ReadByte() -> uint8_t
+    {
+        Require(1);
+        return static_cast<uint8_t>(_in[_pos++]);
+    }
+
+    auto ReadSize() -> size_t
+    {
+        size_t size{0};
+        for (int shift = 0; shift != 32; shift += 8)
+        {
+            size |= static_cast<size_t>(ReadByte()) << shift;
+        }
+        return size;
+    }
+
+    auto ReadBytes() -> std::vector<uint8_t>
+    {
+        const auto size = ReadSize();
+        Require(size);
+        std::vector<uint8_t> bytes(_in.begin() + _pos, _in.begin() + _pos + size);
+        _pos += size;
+        return bytes;
+    }
+
+    bool AtEnd() const
+    {
+        return _pos == _in.size();
+    }
+
+private:
+    void Require(size_t size) const
+    {
+        if (_in.size() - _pos < size)
+        {
+            throw SilKitError{"DecodeContentFilter: the encoded filter is truncated"};
+        }
+    }
+
+private:
+    const std::string& _in;
+    size_t _pos{0};
+};
+
+bool MatchPredicate(const ContentPredicate& predicate, Span<const uint8_t> content)
+{
+    const auto size = predicate.value.size();
+    if (predicate.offset > content.size() || content.size() - predicate.offset < size)
+    {
+        return false;
+    }
+
+    const auto* bytes = content.data() + predicate.offset;
+    if (predicate.mask.empty())
+    {
+        return std::equal(predicate.value.begin(), predicate.value.end(), bytes);
+    }
+    for (size_t index = 0; index != size; ++index)
+    {
+        if (((bytes[index] ^ predicate.value[index]) & predicate.mask[index]) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool MatchContentFilter(const ContentFilter& filter, Span<const uint8_t> content)
+{
+    for (const auto& predicate : filter)
+    {
+        if (!MatchPredicate(predicate, content))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+auto EncodeContentFilter(const ContentFilter& filter) -> std::string
+{
+    std::string out;
+    out.push_back(static_cast<char>(EncodedContentFilterVersion));
+    WriteSize(out, filter.size());
+    for (const auto& predicate : filter)
+    {
+        ValidatePredicate(predicate);
+        WriteSize(out, predicate.offset);
+        WriteBytes(out, predicate.value);
+        WriteBytes(out, predicate.mask);
+    }
+    return out;
+}
+
+auto DecodeContentFilter(const std::string& encodedFilter) -> ContentFilter
+{
+    EncodedContentFilterReader reader{encodedFilter};
+    if (reader.ReadByte() != EncodedContentFilterVersion)
+    {
+        throw SilKitError{"DecodeContentFilter: unknown version of the encoded filter"};
+    }
+
+    ContentFilter filter;
+    const auto count = reader.ReadSize();
+    for (size_t index = 0; index != count; ++index)
+    {
+        ContentPredicate predicate;
+        predicate.offset = reader.ReadSize();
+        predicate.value = reader.ReadBytes();
+        predicate.mask = reader.ReadBytes();
+        ValidatePredicate(predicate);
+        filter.push_back(std::move(predicate));
+    }
+    if (!reader.AtEnd())
+    {
+        throw SilKitError{"DecodeContentFilter: unexpected data after the encoded filter"};
+    }
+    return filter;
+}
+
+} // namespace Util
+} // namespace SilKit
@@ -0,0 +1,57 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+#include "silkit/util/Span.hpp"
+
+namespace SilKit {
+namespace Util {
+
+//! The bytes of the content at the offset are equal to the value, compared bitwise under the mask. An empty mask
+//! compares all bits. Content which ends before the value does not match.
+struct ContentPredicate
+{
+    size_t offset{0};
+    std::vector<uint8_t> value;
+    std::vector<uint8_t> mask;
+};
+
+//! Content matches the filter if it matches all of its predicates. The empty filter matches all content.
+using ContentFilter = std::vector<ContentPredicate>;
+
+bool MatchContentFilter(const ContentFilter& filter, Span<const uint8_t> content);
+
+//! Compact binary form of the filter, e.g., for the supplemental data of a ServiceDescriptor. Throws SilKitError if a
+//! predicate is malformed, i.e., its value is empty or its mask differs in size.
+auto EncodeContentFilter(const ContentFilter& filter) -> std::string;
+
+//! Decode a filter encoded by EncodeContentFilter. Throws SilKitError if the encoding is malformed.
+auto DecodeContentFilter(const std::string& encodedFilter) -> ContentFilter;
+
+} // namespace Util
+} // namespace SilKit
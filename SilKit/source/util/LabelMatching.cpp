@@ -20,67 +20,215 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "LabelMatching.hpp"
-#include "Optional.hpp"
+
+#include "silkit/participant/exception.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include <cstdint>
 
 namespace SilKit {
 namespace Util {
 
 using namespace SilKit::Services;
 
-Optional<MatchingLabel> TryFindLabelByKey(const std::string& key, const std::vector<MatchingLabel>& labels)
+namespace {
+
+bool KeyLess(const MatchingLabel& lhs, const MatchingLabel& rhs)
+{
+    return lhs.key < rhs.key;
+}
+
+// Format version of EncodeLabels, followed by the number of labels and kind, key and value of each label
+constexpr uint8_t EncodedLabelsVersion{1};
+
+void WriteSize(std::string& out, size_t size)
 {
-    for (auto it : labels)
+    if (size > (std::numeric_limits<uint32_t>::max)())
     {
-        if (it.key == key)
-        {
-            return {it};
-        }
+        throw SilKitError{"EncodeLabels: the labels are too large"};
+    }
+    for (int shift = 0; shift != 32; shift += 8)
+    {
+        out.push_back(static_cast<char>((size >> shift) & 0xff));
     }
-    return Optional<MatchingLabel>();
 }
 
-bool LabelMatchesLabelList(MatchingLabel label, const std::vector<MatchingLabel>& labels)
+void WriteString(std::string& out, const std::string& value)
 {
-    auto foundLabel = TryFindLabelByKey(label.key, labels);
+    WriteSize(out, value.size());
+    out.append(value);
+}
 
-    if (!foundLabel.has_value()) // Key not found
+class EncodedLabelsReader
+{
+public:
+    explicit EncodedLabelsReader(const std::string& in)
+        : _in{in}
     {
-        if (label.kind == MatchingLabel::Kind::Mandatory)
+    }
+
+    auto ReadByte() -> uint8_t
+    {
+        Require(1);
+        return static_cast<uint8_t>(_in[_pos++]);
+    }
+
+    auto ReadSize() -> size_t
+    {
+        size_t size{0};
+        for (int shift = 0; shift != 32; shift += 8)
         {
-            // Mandatory labels must exist
-            return false;
+            size |= static_cast<size_t>(ReadByte()) << shift;
         }
-        // Optional labels that do not exist are ignored
+        return size;
     }
-    else if (label.value != foundLabel.value().value) 
+
+    auto ReadString() -> std::string
+    {
+        const auto size = ReadSize();
+        Require(size);
+        auto value = _in.substr(_pos, size);
+        _pos += size;
+        return value;
+    }
+
+    bool AtEnd() const
     {
-       // Key found and value does not match -> no match
-       return false;
+        return _pos == _in.size();
     }
 
-    return true;
+private:
+    void Require(size_t size) const
+    {
+        if (_in.size() - _pos < size)
+        {
+            throw SilKitError{"DecodeLabels: the encoded labels are truncated"};
+        }
+    }
+
+private:
+    const std::string& _in;
+    size_t _pos{0};
+};
+
+} // namespace
+
+auto CompileLabels(std::vector<MatchingLabel> labels) -> CompiledLabels
+{
+    // Stable, so that the first of several labels with the same key stays first, like in a search by key
+    std::stable_sort(labels.begin(), labels.end(), KeyLess);
+    return CompiledLabels{std::move(labels)};
 }
 
-bool MatchLabels(const std::vector<MatchingLabel>& labels1,
-                 const std::vector<MatchingLabel>& labels2)
+bool MatchLabels(const CompiledLabels& compiledLabels1, const CompiledLabels& compiledLabels2)
 {
-    // Check each labels1 against labels2 and bailout on negative match
-    for (auto&& label : labels1)
+    const auto& labels1 = compiledLabels1.labels;
+    const auto& labels2 = compiledLabels2.labels;
+
+    auto it1 = labels1.begin();
+    auto it2 = labels2.begin();
+    while (it1 != labels1.end() || it2 != labels2.end())
     {
-        if (!LabelMatchesLabelList(label, labels2))
+        // A key which only one side has: mandatory labels must exist, optional labels are ignored
+        if (it2 == labels2.end() || (it1 != labels1.end() && it1->key < it2->key))
+        {
+            if (it1->kind == MatchingLabel::Kind::Mandatory)
+            {
+                return false;
+            }
+            ++it1;
+            continue;
+        }
+        if (it1 == labels1.end() || it2->key < it1->key)
+        {
+            if (it2->kind == MatchingLabel::Kind::Mandatory)
+            {
+                return false;
+            }
+            ++it2;
+            continue;
+        }
+
+        // A key which both sides have: each label must have the value of the first label with the key on the other side
+        const auto& key = it1->key;
+        const auto& value1 = it1->value;
+        const auto& value2 = it2->value;
+        for (; it1 != labels1.end() && it1->key == key; ++it1)
+        {
+            if (it1->value != value2)
+            {
+                return false;
+            }
+        }
+        for (; it2 != labels2.end() && it2->key == key; ++it2)
         {
-            return false;
+            if (it2->value != value1)
+            {
+                return false;
+            }
         }
     }
-    // Matching is symmetric: Do the reverse
-    for (auto&& label : labels2)
+    return true; // All of the labels match according to their rules -> match
+}
+
+bool MatchLabels(const std::vector<MatchingLabel>& labels1, const std::vector<MatchingLabel>& labels2)
+{
+    return MatchLabels(CompileLabels(labels1), CompileLabels(labels2));
+}
+
+auto EncodeLabels(const std::vector<MatchingLabel>& labels) -> std::string
+{
+    const auto compiledLabels = CompileLabels(labels);
+
+    std::string out;
+    out.push_back(static_cast<char>(EncodedLabelsVersion));
+    WriteSize(out, compiledLabels.labels.size());
+    for (const auto& label : compiledLabels.labels)
+    {
+        out.push_back(static_cast<char>(label.kind));
+        WriteString(out, label.key);
+        WriteString(out, label.value);
+    }
+    return out;
+}
+
+auto DecodeLabels(const std::string& encodedLabels) -> CompiledLabels
+{
+    EncodedLabelsReader reader{encodedLabels};
+    if (reader.ReadByte() != EncodedLabelsVersion)
     {
-        if (!LabelMatchesLabelList(label, labels1))
+        throw SilKitError{"DecodeLabels: unknown encoding version"};
+    }
+
+    CompiledLabels compiledLabels;
+    const auto count = reader.ReadSize();
+    // every label takes at least nine bytes, do not trust the count for the allocation
+    compiledLabels.labels.reserve((std::min)(count, encodedLabels.size() / 9));
+    for (size_t index = 0; index != count; ++index)
+    {
+        MatchingLabel label;
+        label.kind = static_cast<MatchingLabel::Kind>(reader.ReadByte());
+        if (label.kind != MatchingLabel::Kind::Optional && label.kind != MatchingLabel::Kind::Mandatory)
         {
-            return false;
+            throw SilKitError{"DecodeLabels: unknown label kind"};
         }
+        label.key = reader.ReadString();
+        label.value = reader.ReadString();
+        compiledLabels.labels.emplace_back(std::move(label));
     }
-    return true; // All of the labels match according to their rules -> match
+    if (!reader.AtEnd())
+    {
+        throw SilKitError{"DecodeLabels: unexpected bytes after the labels"};
+    }
+
+    // The encoder stores the labels sorted, only an encoding of a different origin needs sorting
+    if (!std::is_sorted(compiledLabels.labels.begin(), compiledLabels.labels.end(), KeyLess))
+    {
+        return CompileLabels(std::move(compiledLabels.labels));
+    }
+    return compiledLabels;
 }
 
 } // namespace Util
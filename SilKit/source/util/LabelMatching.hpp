@@ -21,6 +21,7 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #pragma once
 
+#include <string>
 #include <vector>
 
 #include "silkit/services/datatypes.hpp"
@@ -28,8 +29,25 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 namespace SilKit {
 namespace Util {
 
+//! Labels prepared for matching: stably sorted by their key, so that two label lists are matched in a single pass
+struct CompiledLabels
+{
+    std::vector<SilKit::Services::MatchingLabel> labels;
+};
+
+auto CompileLabels(std::vector<SilKit::Services::MatchingLabel> labels) -> CompiledLabels;
+
+bool MatchLabels(const CompiledLabels& labels1, const CompiledLabels& labels2);
+
 bool MatchLabels(const std::vector<SilKit::Services::MatchingLabel>& labels1,
                  const std::vector<SilKit::Services::MatchingLabel>& labels2);
 
+//! Compact binary form of the labels, e.g., for the supplemental data of a ServiceDescriptor. The labels are stored
+//! in their compiled order.
+auto EncodeLabels(const std::vector<SilKit::Services::MatchingLabel>& labels) -> std::string;
+
+//! Decode labels encoded by EncodeLabels. Throws SilKitError if the encoding is malformed.
+auto DecodeLabels(const std::string& encodedLabels) -> CompiledLabels;
+
 } // namespace Util
 } // namespace SilKit
@@ -0,0 +1,91 @@
+/* Copyright (c) 2022 Vector Informatik GmbH
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+
+#include "gtest/gtest.h"
+
+#include "ContentFilter.hpp"
+
+#include "silkit/participant/exception.hpp"
+
+namespace {
+
+using namespace SilKit::Util;
+
+const std::vector<uint8_t> content{0x10, 0x2A, 0x3C, 0x4F};
+
+TEST(Test_ContentFilter, empty_filter_matches_all_content)
+{
+    EXPECT_TRUE(MatchContentFilter({}, content));
+    EXPECT_TRUE(MatchContentFilter({}, std::vector<uint8_t>{}));
+}
+
+TEST(Test_ContentFilter, predicate_compares_value_at_offset)
+{
+    EXPECT_TRUE(MatchContentFilter({{1, {0x2A, 0x3C}, {}}}, content));
+    EXPECT_FALSE(MatchContentFilter({{1, {0x2A, 0x3D}, {}}}, content));
+    EXPECT_TRUE(MatchContentFilter({{3, {0x4F}, {}}}, content));
+
+    // Content ending before the value does not match
+    EXPECT_FALSE(MatchContentFilter({{3, {0x4F, 0x00}, {}}}, content));
+    EXPECT_FALSE(MatchContentFilter({{10, {0x00}, {}}}, content));
+}
+
+TEST(Test_ContentFilter, predicate_compares_masked_bits)
+{
+    EXPECT_TRUE(MatchContentFilter({{2, {0x30, 0x40}, {0xF0, 0xF0}}}, content));
+    EXPECT_FALSE(MatchContentFilter({{2, {0x30, 0x40}, {0xF0, 0xFF}}}, content));
+}
+
+TEST(Test_ContentFilter, all_predicates_must_match)
+{
+    EXPECT_TRUE(MatchContentFilter({{0, {0x10}, {}}, {3, {0x4F}, {}}}, content));
+    EXPECT_FALSE(MatchContentFilter({{0, {0x10}, {}}, {3, {0x4E}, {}}}, content));
+}
+
+TEST(Test_ContentFilter, encoded_filter_round_trip)
+{
+    const ContentFilter filter{{0, {0x10}, {}}, {70000, {0x30, 0x40}, {0xF0, 0x0F}}};
+
+    const auto decoded = DecodeContentFilter(EncodeContentFilter(filter));
+    ASSERT_EQ(decoded.size(), filter.size());
+    for (size_t index = 0; index != filter.size(); ++index)
+    {
+        EXPECT_EQ(decoded[index].offset, filter[index].offset);
+        EXPECT_EQ(decoded[index].value, filter[index].value);
+        EXPECT_EQ(decoded[index].mask, filter[index].mask);
+    }
+
+    EXPECT_TRUE(DecodeContentFilter(EncodeContentFilter({})).empty());
+}
+
+TEST(Test_ContentFilter, malformed_filters_throw)
+{
+    EXPECT_THROW(EncodeContentFilter({{0, {}, {}}}), SilKit::SilKitError);
+    EXPECT_THROW(EncodeContentFilter({{0, {0x10, 0x20}, {0xFF}}}), SilKit::SilKitError);
+
+    const auto encoded = EncodeContentFilter({{0, {0x10}, {0xFF}}});
+    EXPECT_THROW(DecodeContentFilter(""), SilKit::SilKitError);
+    EXPECT_THROW(DecodeContentFilter(encoded.substr(0, encoded.size() - 1)), SilKit::SilKitError);
+    EXPECT_THROW(DecodeContentFilter(encoded + '\0'), SilKit::SilKitError);
+    EXPECT_THROW(DecodeContentFilter('\2' + encoded.substr(1)), SilKit::SilKitError);
+}
+
+} // namespace
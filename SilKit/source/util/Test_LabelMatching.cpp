@@ -24,6 +24,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 
 #include "LabelMatching.hpp"
 
+#include "silkit/participant/exception.hpp"
+
 namespace {
 
 using namespace testing;
@@ -221,4 +223,47 @@ TEST_F(Test_LabelMatching, match_multiple_labels)
     }
 }
 
+TEST_F(Test_LabelMatching, match_labels_in_any_order)
+{
+    const std::vector<MatchingLabel> labels1{MatchingLabel{"KeyC", "ValC", MatchingLabel::Kind::Optional},
+                                             MatchingLabel{"KeyA", "ValA", MatchingLabel::Kind::Mandatory},
+                                             MatchingLabel{"KeyB", "ValB", MatchingLabel::Kind::Optional}};
+    const std::vector<MatchingLabel> labels2{MatchingLabel{"KeyB", "ValB", MatchingLabel::Kind::Mandatory},
+                                             MatchingLabel{"KeyD", "ValD", MatchingLabel::Kind::Optional},
+                                             MatchingLabel{"KeyA", "ValA", MatchingLabel::Kind::Optional}};
+    EXPECT_TRUE(MatchLabels(labels1, labels2));
+    EXPECT_TRUE(MatchLabels(CompileLabels(labels2), CompileLabels(labels1)));
+
+    auto otherValue = labels2;
+    otherValue[0].value = "ValX";
+    EXPECT_FALSE(MatchLabels(labels1, otherValue));
+    EXPECT_FALSE(MatchLabels(CompileLabels(otherValue), CompileLabels(labels1)));
+}
+
+TEST_F(Test_LabelMatching, encoded_labels_round_trip)
+{
+    const std::vector<MatchingLabel> labels{MatchingLabel{"KeyB", "ValB", MatchingLabel::Kind::Optional},
+                                            MatchingLabel{"KeyA", "", MatchingLabel::Kind::Mandatory}};
+
+    const auto decodedLabels = DecodeLabels(EncodeLabels(labels)).labels;
+    ASSERT_EQ(decodedLabels.size(), 2u);
+    EXPECT_EQ(decodedLabels[0].key, "KeyA");
+    EXPECT_EQ(decodedLabels[0].value, "");
+    EXPECT_EQ(decodedLabels[0].kind, MatchingLabel::Kind::Mandatory);
+    EXPECT_EQ(decodedLabels[1].key, "KeyB");
+    EXPECT_EQ(decodedLabels[1].value, "ValB");
+    EXPECT_EQ(decodedLabels[1].kind, MatchingLabel::Kind::Optional);
+
+    EXPECT_TRUE(DecodeLabels(EncodeLabels({})).labels.empty());
+}
+
+TEST_F(Test_LabelMatching, malformed_encoded_labels_throw)
+{
+    const auto encodedLabels = EncodeLabels({MatchingLabel{"KeyA", "ValA", MatchingLabel::Kind::Optional}});
+
+    EXPECT_THROW(DecodeLabels(""), SilKit::SilKitError);
+    EXPECT_THROW(DecodeLabels(encodedLabels.substr(0, encodedLabels.size() - 1)), SilKit::SilKitError);
+    EXPECT_THROW(DecodeLabels(encodedLabels + "x"), SilKit::SilKitError);
+}
+
 } // anonymous namespace
@@ -26,6 +26,8 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 #include <chrono>
 #include <memory>
 #include <algorithm>
+#include <stdexcept>
+#include <vector>
 
 namespace SilKit {
 namespace Util {
@@ -45,10 +47,20 @@ public:
 
     SharedVector(const Span<const T> span, size_t minimumSize = 0, T padValue = T{});
 
+    //! Share the items [offset, offset + size) of the storage without copying them.
+    SharedVector(std::shared_ptr<const std::vector<T>> storage, size_t offset, size_t size);
+
     auto AsSpan() const& -> Span<const T>;
 
+    //! The vector holding the items, which may contain further items before and after them.
+    auto Storage() const -> const std::shared_ptr<const std::vector<T>>&;
+    //! Index of the first item in the storage.
+    auto Offset() const -> size_t;
+
 private:
-    std::shared_ptr<std::vector<T>> _data;
+    std::shared_ptr<const std::vector<T>> _data;
+    size_t _offset{0};
+    size_t _size{0};
 };
 
 template <typename T>
@@ -67,14 +79,29 @@ SharedVector<T>::SharedVector(std::initializer_list<T> initializerList)
 template <typename T>
 SharedVector<T>::SharedVector(std::vector<T> vector)
     : _data{std::make_shared<std::vector<T>>(std::move(vector))}
+    , _size{_data->size()}
 {
 }
 
 template <typename T>
 SharedVector<T>::SharedVector(const Span<const T> span, const size_t minimumSize, const T padValue)
-    : _data{std::make_shared<std::vector<T>>(span.begin(), span.end())}
 {
-    _data->resize((std::max)(_data->size(), minimumSize), padValue);
+    auto data = std::make_shared<std::vector<T>>(span.begin(), span.end());
+    data->resize((std::max)(data->size(), minimumSize), padValue);
+    _size = data->size();
+    _data = std::move(data);
+}
+
+template <typename T>
+SharedVector<T>::SharedVector(std::shared_ptr<const std::vector<T>> storage, const size_t offset, const size_t size)
+    : _data{std::move(storage)}
+    , _offset{offset}
+    , _size{size}
+{
+    if (_data == nullptr || _offset + _size > _data->size())
+    {
+        throw std::out_of_range{"SharedVector: the items are not within the storage"};
+    }
 }
 
 template <typename T>
@@ -82,7 +109,7 @@ auto SharedVector<T>::AsSpan() const& -> Span<const T>
 {
     if (_data)
     {
-        return {_data->data(), _data->size()};
+        return {_data->data() + _offset, _size};
     }
     else
     {
@@ -90,6 +117,18 @@ auto SharedVector<T>::AsSpan() const& -> Span<const T>
     }
 }
 
+template <typename T>
+auto SharedVector<T>::Storage() const -> const std::shared_ptr<const std::vector<T>>&
+{
+    return _data;
+}
+
+template <typename T>
+auto SharedVector<T>::Offset() const -> size_t
+{
+    return _offset;
+}
+
 template <typename T>
 bool ItemsAreEqual(const SharedVector<T>& lhs, const SharedVector<T>& rhs)
 {
@@ -205,7 +205,7 @@ auto GenerateRandomCharacters(const std::string& generatedConfigurationPath, siz
 
 auto StartRegistry(std::shared_ptr<SilKit::Config::IParticipantConfiguration> configuration, std::string listenUri,
         std::string dashboardUri, bool enableDashboard,
-        CommandlineParser::Option generatedConfigurationPathOpt) -> SilKitRegistry::RegistryInstance
+        CommandlineParser::Option generatedConfigurationPathOpt, std::string timeSyncCoordinator) -> SilKitRegistry::RegistryInstance
 {
     auto registry = SilKit::Vendor::Vector::CreateSilKitRegistryImpl(configuration);
     const auto chosenListenUri = registry->StartListening(listenUri);
@@ -218,6 +218,7 @@ auto StartRegistry(std::shared_ptr<SilKit::Config::IParticipantConfiguration> co
 
         SilKit::Config::ParticipantConfiguration generatedConfiguration;
         generatedConfiguration.middleware.registryUri = chosenListenUri;
+        generatedConfiguration.timeSynchronization.coordinator = timeSyncCoordinator;
 
         namespace fs = SilKit::Filesystem;
 
@@ -293,6 +294,10 @@ int main(int argc, char** argv)
         "generate-configuration", "g", "", "[--generate-configuration <configuration>]",
         "-g, --generate-configuration <configuration>: Generate a configuration file which includes the URI the "
         "registry listens on. ");
+    commandlineParser.Add<CliParser::Option>(
+        "time-sync-coordinator", "t", "", "[--time-sync-coordinator <participant-name>]",
+        "-t, --time-sync-coordinator <participant-name>: The participant which coordinates the time synchronization, "
+        "written to the configuration generated with --generate-configuration.");
     commandlineParser.Add<CliParser::Option>(
         "dashboard-uri", "d", "http://localhost:8082", "[--dashboard-uri <uri>]",
         "-d, --dashboard-uri <dashboard-uri>: The http:// URI the data should be sent to. Defaults to 'http://localhost:8082'.", CliParser::Hidden);
@@ -427,18 +432,25 @@ int main(int argc, char** argv)
         listenUri = ExtractRegistryUriFromConfiguration(configuration);
 
         const auto generatedConfigurationPathOpt = commandlineParser.Get<CliParser::Option>("generate-configuration");
+        const auto timeSyncCoordinator = commandlineParser.Get<CliParser::Option>("time-sync-coordinator").Value();
+
+        if (!timeSyncCoordinator.empty() && !generatedConfigurationPathOpt.HasValue())
+        {
+            std::cerr << "Warning: --time-sync-coordinator / -t has no effect without --generate-configuration / -g."
+                      << std::endl;
+        }
 
         if (windowsService)
         {
             SilKitRegistry::RunWindowsService([=] {
                 return StartRegistry(configuration, listenUri,
-                    dashboardUri, enableDashboard, generatedConfigurationPathOpt);
+                    dashboardUri, enableDashboard, generatedConfigurationPathOpt, timeSyncCoordinator);
             });
         }
         else
         {
             const auto registry = StartRegistry(configuration, listenUri,
-                dashboardUri,  enableDashboard, generatedConfigurationPathOpt);
+                dashboardUri,  enableDashboard, generatedConfigurationPathOpt, timeSyncCoordinator);
 
             if (useSignalHandler)
             {